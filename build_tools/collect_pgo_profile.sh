@@ -0,0 +1,68 @@
+#!/usr/bin/env bash
+# Copyright (c) Facebook, Inc. and its affiliates. All Rights Reserved.
+#
+# Runs an instrumented db_bench to collect a profile for profile-guided
+# optimization (PGO) builds. Invoked by the `pgo_profile` CMake target:
+#
+#   cmake -DWITH_PGO_INSTRUMENTATION=ON .. && make db_bench && make pgo_profile
+#
+# then rebuild with -DPGO_PROFILE_DATA=<profile> (and the instrumentation
+# option off). For clang the profile is the merged .profdata file this script
+# emits; for gcc it is the build directory holding the .gcda files written by
+# the instrumented run.
+#
+# Environment:
+#   PGO_TRACE_FILE  trace captured with `db_bench --trace_file=...`. When set,
+#                   the trace is replayed against PGO_DB_DIR, which must be
+#                   the database the trace was captured against. Replaying a
+#                   production trace gives a far more representative profile
+#                   than the default synthetic workload.
+#   PGO_DB_DIR      database directory used for the replay.
+#   PGO_BENCH_ARGS  extra arguments appended to the db_bench invocation.
+
+set -e
+
+if [ "$#" -lt 2 ]; then
+  echo "Usage: $0 <db_bench-binary> <output-dir>"
+  exit 1
+fi
+
+DB_BENCH="$1"
+OUT_DIR="$2"
+
+mkdir -p "$OUT_DIR"
+
+# Only effective for clang's -fprofile-instr-generate; harmless for gcc.
+export LLVM_PROFILE_FILE="$OUT_DIR/db_bench-%p.profraw"
+
+if [ -n "$PGO_TRACE_FILE" ]; then
+  if [ -z "$PGO_DB_DIR" ]; then
+    echo "PGO_TRACE_FILE requires PGO_DB_DIR (the database the trace" \
+         "was captured against)"
+    exit 1
+  fi
+  "$DB_BENCH" --benchmarks=replay --trace_file="$PGO_TRACE_FILE" \
+    --use_existing_db --db="$PGO_DB_DIR" $PGO_BENCH_ARGS
+else
+  echo "PGO_TRACE_FILE not set; running a generic fillrandom/readrandom" \
+       "workload. Replay a captured trace for a representative profile."
+  "$DB_BENCH" --benchmarks=fillrandom,readrandom --num=1000000 \
+    --db="$OUT_DIR/db" $PGO_BENCH_ARGS
+fi
+
+RAW_PROFILES=$(ls "$OUT_DIR"/*.profraw 2>/dev/null || true)
+if [ -n "$RAW_PROFILES" ]; then
+  if command -v llvm-profdata > /dev/null; then
+    llvm-profdata merge -output="$OUT_DIR/rocksdb.profdata" $RAW_PROFILES
+    echo "Profile written to $OUT_DIR/rocksdb.profdata; rebuild with" \
+         "-DWITH_PGO_INSTRUMENTATION=OFF" \
+         "-DPGO_PROFILE_DATA=$OUT_DIR/rocksdb.profdata"
+  else
+    echo "llvm-profdata not found; merge $OUT_DIR/*.profraw manually"
+    exit 1
+  fi
+else
+  echo "No .profraw files found (gcc build); .gcda files were written next" \
+       "to the object files. Rebuild with -DWITH_PGO_INSTRUMENTATION=OFF" \
+       "-DPGO_PROFILE_DATA=<this build directory>"
+fi
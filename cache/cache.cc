@@ -155,6 +155,16 @@ Status Cache::CreateFromString(const ConfigOptions& config_options,
   return status;
 }
 
+void Cache::MultiLookup(size_t num_keys, const Slice* keys, Handle** handles,
+                        const CacheItemHelper* helper,
+                        CreateContext* create_context, Priority priority,
+                        Statistics* stats) {
+  assert(num_keys == 0 || (keys != nullptr && handles != nullptr));
+  for (size_t i = 0; i < num_keys; ++i) {
+    handles[i] = Lookup(keys[i], helper, create_context, priority, stats);
+  }
+}
+
 bool Cache::AsyncLookupHandle::IsReady() {
   return pending_handle == nullptr || pending_handle->IsReady();
 }
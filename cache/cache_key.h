@@ -76,7 +76,12 @@ constexpr uint8_t kCacheKeySize = static_cast<uint8_t>(sizeof(CacheKey));
 //
 // If the db_id, db_session_id, and file_number come from the file's table
 // properties, then the keys will be stable across DB::Open/Close, backup/
-// restore, import/export, etc.
+// restore, import/export, etc. A consequence worth calling out: because the
+// identifiers are those recorded by the session that wrote the file, not the
+// session reading it, byte-identical files (e.g. side-by-side instances
+// restored from the same checkpoint, even under different current file
+// numbers) produce the same base key, so their blocks are cached once when
+// the DB handles share a Cache object.
 //
 // This class "is a" CacheKey only privately so that it is not misused as
 // a ready-to-use CacheKey.
@@ -365,6 +365,44 @@ TEST_P(CacheTest, HitAndMiss) {
   }
 }
 
+TEST_P(CacheTest, MultiLookup) {
+  Insert(100, 101);
+  Insert(200, 201);
+  Insert(300, 301);
+
+  // Mix of hits and misses, with enough keys that several should land in
+  // the same shard and be resolved in one group.
+  std::vector<int> lookup_keys = {100, 400, 200, 500, 300, 100};
+  std::vector<std::string> key_strs;
+  std::vector<Slice> keys;
+  for (int k : lookup_keys) {
+    key_strs.push_back(EncodeKey(k));
+  }
+  for (const std::string& s : key_strs) {
+    keys.emplace_back(s);
+  }
+  std::vector<Cache::Handle*> handles(keys.size(), nullptr);
+  cache_->MultiLookup(keys.size(), keys.data(), handles.data());
+
+  ASSERT_NE(handles[0], nullptr);
+  ASSERT_EQ(101, DecodeValue(cache_->Value(handles[0])));
+  ASSERT_EQ(handles[1], nullptr);
+  ASSERT_NE(handles[2], nullptr);
+  ASSERT_EQ(201, DecodeValue(cache_->Value(handles[2])));
+  ASSERT_EQ(handles[3], nullptr);
+  ASSERT_NE(handles[4], nullptr);
+  ASSERT_EQ(301, DecodeValue(cache_->Value(handles[4])));
+  // Duplicate key gets its own handle.
+  ASSERT_NE(handles[5], nullptr);
+  ASSERT_EQ(101, DecodeValue(cache_->Value(handles[5])));
+
+  for (Cache::Handle* h : handles) {
+    if (h != nullptr) {
+      cache_->Release(h);
+    }
+  }
+}
+
 TEST_P(CacheTest, InsertSameKey) {
   if (IsHyperClock()) {
     ROCKSDB_GTEST_BYPASS(
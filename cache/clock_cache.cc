@@ -1644,7 +1644,8 @@ void FixedHyperClockCache::ReportProblems(
           "FixedHyperClockCache@%p unable to use estimated %.1f%% capacity "
           "because of full occupancy in %d/%u cache shards "
           "(estimated_entry_charge too high). "
-          "Recommend estimated_entry_charge=%zu",
+          "Recommend estimated_entry_charge=%zu, or estimated_entry_charge=0 "
+          "for automatic table sizing, which handles mixed entry sizes",
           this, lost_portion * 100.0, over_count, (unsigned)shard_count,
           min_recommendation);
     }
@@ -1664,7 +1665,9 @@ void FixedHyperClockCache::ReportProblems(
           info_log, level,
           "FixedHyperClockCache@%p table has low occupancy at full capacity. "
           "Higher estimated_entry_charge (about %.1fx) would likely improve "
-          "performance. Recommend estimated_entry_charge=%zu",
+          "performance. Recommend estimated_entry_charge=%zu, or "
+          "estimated_entry_charge=0 for automatic table sizing, which handles "
+          "mixed entry sizes",
           this, kMidSpecLoadFactor / average_load_factor, min_recommendation);
     }
   }
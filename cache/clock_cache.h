@@ -1088,6 +1088,20 @@ class ALIGN_AS(CACHE_LINE_SIZE) ClockCacheShard final : public CacheShardBase {
     return Lookup(key, hashed_key);
   }
 
+  // Like Lookup(), but for a group of keys that all hash to this shard.
+  // Lookups here are already lock-free, so there is no per-group
+  // synchronization to amortize; this just satisfies the sharded
+  // MultiLookup dispatch.
+  void MultiLookup(size_t num_keys, const Slice* keys,
+                   const UniqueId64x2* hashed_keys, HandleImpl** handles,
+                   const Cache::CacheItemHelper* /*helper*/,
+                   Cache::CreateContext* /*create_context*/,
+                   Cache::Priority /*priority*/, Statistics* /*stats*/) {
+    for (size_t i = 0; i < num_keys; i++) {
+      handles[i] = Lookup(keys[i], hashed_keys[i]);
+    }
+  }
+
   Table& GetTable() { return table_; }
   const Table& GetTable() const { return table_; }
 
@@ -24,10 +24,28 @@ CompressedSecondaryCache::CompressedSecondaryCache(
       cache_res_mgr_(std::make_shared<ConcurrentCacheReservationManager>(
           std::make_shared<CacheReservationManagerImpl<CacheEntryRole::kMisc>>(
               cache_))),
-      disable_cache_(opts.capacity == 0) {}
+      disable_cache_(opts.capacity == 0),
+      compression_contexts_(new ThreadLocalPtr(&UnrefCompressionContext)) {}
 
 CompressedSecondaryCache::~CompressedSecondaryCache() = default;
 
+void CompressedSecondaryCache::UnrefCompressionContext(void* ptr) {
+  // Called when a thread exits or the ThreadLocalPtr gets destroyed.
+  delete static_cast<CompressionContext*>(ptr);
+}
+
+CompressionContext*
+CompressedSecondaryCache::GetThreadLocalCompressionContext() {
+  auto* context =
+      static_cast<CompressionContext*>(compression_contexts_->Get());
+  if (context == nullptr) {
+    context = new CompressionContext(cache_options_.compression_type,
+                                     cache_options_.compression_opts);
+    compression_contexts_->Reset(context);
+  }
+  return context;
+}
+
 std::unique_ptr<SecondaryCacheResultHandle> CompressedSecondaryCache::Lookup(
     const Slice& key, const Cache::CacheItemHelper* helper,
     Cache::CreateContext* create_context, bool /*wait*/, bool advise_erase,
@@ -198,11 +216,11 @@ Status CompressedSecondaryCache::InsertInternal(
       type == kNoCompression &&
       !cache_options_.do_not_compress_roles.Contains(helper->role)) {
     PERF_COUNTER_ADD(compressed_sec_cache_uncompressed_bytes, data_size);
-    CompressionContext compression_context(cache_options_.compression_type,
-                                           cache_options_.compression_opts);
+    CompressionContext* compression_context =
+        GetThreadLocalCompressionContext();
     uint64_t sample_for_compression{0};
     CompressionInfo compression_info(
-        cache_options_.compression_opts, compression_context,
+        cache_options_.compression_opts, *compression_context,
         CompressionDict::GetEmptyDict(), cache_options_.compression_type,
         sample_for_compression);
 
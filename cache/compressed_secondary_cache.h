@@ -17,6 +17,7 @@
 #include "rocksdb/status.h"
 #include "util/compression.h"
 #include "util/mutexlock.h"
+#include "util/thread_local.h"
 
 namespace ROCKSDB_NAMESPACE {
 
@@ -141,6 +142,15 @@ class CompressedSecondaryCache : public SecondaryCache {
 
   size_t TEST_GetCharge(const Slice& key);
 
+  // Returns a per-thread CompressionContext for cache_options_.compression_type
+  // so inserts don't construct a fresh native context (e.g. a ZSTD CCtx) for
+  // every compressed value.
+  CompressionContext* GetThreadLocalCompressionContext();
+
+  // Deleter for the contexts handed out above, called when a thread exits or
+  // the ThreadLocalPtr gets destroyed.
+  static void UnrefCompressionContext(void* ptr);
+
   // TODO: clean up to use cleaner interfaces in typed_cache.h
   const Cache::CacheItemHelper* GetHelper(bool enable_custom_split_merge) const;
   std::shared_ptr<Cache> cache_;
@@ -148,6 +158,9 @@ class CompressedSecondaryCache : public SecondaryCache {
   mutable port::Mutex capacity_mutex_;
   std::shared_ptr<ConcurrentCacheReservationManager> cache_res_mgr_;
   bool disable_cache_;
+  // Lazily created per-thread CompressionContexts, see
+  // GetThreadLocalCompressionContext()
+  std::unique_ptr<ThreadLocalPtr> compression_contexts_;
 };
 
 }  // namespace ROCKSDB_NAMESPACE
@@ -18,6 +18,7 @@
 #include "monitoring/perf_context_imp.h"
 #include "monitoring/statistics_impl.h"
 #include "port/lang.h"
+#include "port/port.h"
 #include "util/distributed_mutex.h"
 
 namespace ROCKSDB_NAMESPACE {
@@ -73,9 +74,23 @@ LRUHandle* LRUHandleTable::Remove(const Slice& key, uint32_t hash) {
 }
 
 LRUHandle** LRUHandleTable::FindPointer(const Slice& key, uint32_t hash) {
+  // This runs with the shard mutex held, so every cache miss taken here
+  // directly extends the critical section. Walk the chain with the next
+  // handle prefetched so the (rare) collision case does not serialize two
+  // dependent misses per node.
   LRUHandle** ptr = &list_[hash >> (32 - length_bits_)];
-  while (*ptr != nullptr && ((*ptr)->hash != hash || key != (*ptr)->key())) {
-    ptr = &(*ptr)->next_hash;
+  LRUHandle* h = *ptr;
+  while (h != nullptr) {
+    LRUHandle* next = h->next_hash;
+    if (next != nullptr) {
+      // Overlap fetching the successor with the comparisons below.
+      PREFETCH(next, 0, 3);
+    }
+    if (h->hash == hash && key == h->key()) {
+      break;
+    }
+    ptr = &h->next_hash;
+    h = next;
   }
   return ptr;
 }
@@ -447,6 +462,29 @@ LRUHandle* LRUCacheShard::Lookup(const Slice& key, uint32_t hash,
   return e;
 }
 
+void LRUCacheShard::MultiLookup(size_t num_keys, const Slice* keys,
+                                const uint32_t* hashes, LRUHandle** handles,
+                                const Cache::CacheItemHelper* /*helper*/,
+                                Cache::CreateContext* /*create_context*/,
+                                Cache::Priority /*priority*/,
+                                Statistics* /*stats*/) {
+  DMutexLock l(mutex_);
+  for (size_t i = 0; i < num_keys; i++) {
+    LRUHandle* e = table_.Lookup(keys[i], hashes[i]);
+    if (e != nullptr) {
+      assert(e->InCache());
+      if (!e->HasRefs()) {
+        // The entry is in LRU since it's in hash and has no external
+        // references.
+        LRU_Remove(e);
+      }
+      e->Ref();
+      e->SetHit();
+    }
+    handles[i] = e;
+  }
+}
+
 bool LRUCacheShard::Ref(LRUHandle* e) {
   DMutexLock l(mutex_);
   // To create another reference - entry must be already externally referenced.
@@ -312,6 +312,14 @@ class ALIGN_AS(CACHE_LINE_SIZE) LRUCacheShard final : public CacheShardBase {
                     Cache::CreateContext* create_context,
                     Cache::Priority priority, Statistics* stats);
 
+  // Like Lookup(), but for a group of keys that all hash to this shard,
+  // resolved under a single mutex acquisition. handles[i] receives the
+  // result for keys[i] (nullptr if not found).
+  void MultiLookup(size_t num_keys, const Slice* keys, const uint32_t* hashes,
+                   LRUHandle** handles, const Cache::CacheItemHelper* helper,
+                   Cache::CreateContext* create_context,
+                   Cache::Priority priority, Statistics* stats);
+
   bool Release(LRUHandle* handle, bool useful, bool erase_if_last_ref);
   bool Ref(LRUHandle* handle);
   void Erase(const Slice& key, uint32_t hash);
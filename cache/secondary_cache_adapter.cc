@@ -196,6 +196,8 @@ Cache::Handle* CacheWithSecondaryAdapter::Promote(
 
   // Note: SecondaryCache::Size() is really charge (from the CreateCallback)
   size_t charge = secondary_handle->Size();
+  sec_cache_hit_count_.fetch_add(1, std::memory_order_relaxed);
+  sec_cache_hit_bytes_.fetch_add(charge, std::memory_order_relaxed);
   Handle* result = nullptr;
   // Insert into primary cache, possibly as a standalone+dummy entries.
   if (secondary_cache_->SupportForceErase() && !found_dummy_entry) {
@@ -642,6 +644,11 @@ Status CacheWithSecondaryAdapter::UpdateAdmissionPolicy(
   return Status::OK();
 }
 
+double CacheWithSecondaryAdapter::GetCacheReservationRatio() const {
+  MutexLock m(&cache_res_mutex_);
+  return sec_cache_res_ratio_;
+}
+
 std::shared_ptr<Cache> NewTieredCache(const TieredCacheOptions& _opts) {
   if (!_opts.cache_opts) {
     return nullptr;
@@ -741,4 +748,26 @@ Status UpdateTieredCache(const std::shared_ptr<Cache>& cache,
   }
   return s;
 }
+
+Status GetTieredCacheUsageInfo(const std::shared_ptr<Cache>& cache,
+                               TieredCacheUsageInfo* info) {
+  if (!cache || !info || strcmp(cache->Name(), kTieredCacheName)) {
+    return Status::InvalidArgument();
+  }
+  CacheWithSecondaryAdapter* tiered_cache =
+      static_cast<CacheWithSecondaryAdapter*>(cache.get());
+
+  // The primary cache is configured with the total budget when cache
+  // reservations are distributed (always the case for NewTieredCache).
+  info->total_capacity = tiered_cache->GetCapacity();
+  Status s = tiered_cache->GetSecondaryCacheCapacity(
+      info->compressed_secondary_capacity);
+  if (!s.ok()) {
+    return s;
+  }
+  info->compressed_secondary_ratio = tiered_cache->GetCacheReservationRatio();
+  info->secondary_hit_count = tiered_cache->GetSecondaryCacheHitCount();
+  info->secondary_hit_bytes = tiered_cache->GetSecondaryCacheHitBytes();
+  return s;
+}
 }  // namespace ROCKSDB_NAMESPACE
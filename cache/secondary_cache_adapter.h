@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "cache/cache_reservation_manager.h"
 #include "rocksdb/secondary_cache.h"
 
@@ -55,6 +57,16 @@ class CacheWithSecondaryAdapter : public CacheWrapper {
 
   Status UpdateAdmissionPolicy(TieredAdmissionPolicy adm_policy);
 
+  double GetCacheReservationRatio() const;
+
+  uint64_t GetSecondaryCacheHitCount() const {
+    return sec_cache_hit_count_.load(std::memory_order_relaxed);
+  }
+
+  uint64_t GetSecondaryCacheHitBytes() const {
+    return sec_cache_hit_bytes_.load(std::memory_order_relaxed);
+  }
+
   Cache* TEST_GetCache() { return target_.get(); }
 
   SecondaryCache* TEST_GetSecondaryCache() { return secondary_cache_.get(); }
@@ -98,6 +110,12 @@ class CacheWithSecondaryAdapter : public CacheWrapper {
   // Amount of memory reserved in the secondary cache. This should be
   // reserved_usage_ * sec_cache_res_ratio_ in steady state.
   size_t sec_reserved_;
+  // Cumulative count/bytes of entries found in the secondary cache and
+  // promoted to the primary. Scoped to this cache (rather than a
+  // Statistics object) so they stay meaningful when the cache is shared
+  // across DBs. See GetTieredCacheUsageInfo().
+  std::atomic<uint64_t> sec_cache_hit_count_{0};
+  std::atomic<uint64_t> sec_cache_hit_bytes_{0};
 };
 
 }  // namespace ROCKSDB_NAMESPACE
@@ -12,6 +12,7 @@
 #include <atomic>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "port/lang.h"
 #include "port/port.h"
@@ -61,6 +62,13 @@ class CacheShardBase {
                         Cache::CreateContext* create_context,
                         Cache::Priority priority,
                         Statistics* stats) = 0;
+  // Like Lookup(), but for a group of keys that all map to this shard,
+  // with the result for keys[i] in handles[i]. Mutex-based shards resolve
+  // the whole group under a single mutex acquisition.
+  void MultiLookup(size_t num_keys, const Slice* keys, const HashVal* hashes,
+                   HandleImpl** handles, const Cache::CacheItemHelper* helper,
+                   Cache::CreateContext* create_context,
+                   Cache::Priority priority, Statistics* stats) = 0;
   bool Release(HandleImpl* handle, bool useful, bool erase_if_last_ref) = 0;
   bool Ref(HandleImpl* handle) = 0;
   void Erase(const Slice& key, HashCref hash) = 0;
@@ -205,6 +213,54 @@ class ShardedCache : public ShardedCacheBase {
     return static_cast<Handle*>(result);
   }
 
+  void MultiLookup(size_t num_keys, const Slice* keys, Handle** handles,
+                   const CacheItemHelper* helper = nullptr,
+                   CreateContext* create_context = nullptr,
+                   Priority priority = Priority::LOW,
+                   Statistics* stats = nullptr) override {
+    // Hash all keys up front, then resolve each shard's group of keys with
+    // a single call into the shard, so that shards synchronizing per
+    // operation pay for one operation per group rather than one per key.
+    std::vector<HashVal> hashes(num_keys);
+    for (size_t i = 0; i < num_keys; i++) {
+      hashes[i] = CacheShard::ComputeHash(keys[i], hash_seed_);
+    }
+    // Batches are expected to be small (the handful of blocks involved in
+    // one read), so gathering each shard's group with a quadratic scan is
+    // cheaper than sorting.
+    std::vector<bool> done(num_keys, false);
+    std::vector<Slice> group_keys;
+    std::vector<HashVal> group_hashes;
+    std::vector<HandleImpl*> group_handles;
+    std::vector<size_t> group_indices;
+    for (size_t i = 0; i < num_keys; i++) {
+      if (done[i]) {
+        continue;
+      }
+      uint32_t shard_idx =
+          CacheShard::HashPieceForSharding(hashes[i]) & shard_mask_;
+      group_keys.clear();
+      group_hashes.clear();
+      group_indices.clear();
+      for (size_t j = i; j < num_keys; j++) {
+        if (!done[j] && (CacheShard::HashPieceForSharding(hashes[j]) &
+                         shard_mask_) == shard_idx) {
+          group_keys.push_back(keys[j]);
+          group_hashes.push_back(hashes[j]);
+          group_indices.push_back(j);
+          done[j] = true;
+        }
+      }
+      group_handles.assign(group_keys.size(), nullptr);
+      shards_[shard_idx].MultiLookup(group_keys.size(), group_keys.data(),
+                                     group_hashes.data(), group_handles.data(),
+                                     helper, create_context, priority, stats);
+      for (size_t k = 0; k < group_indices.size(); k++) {
+        handles[group_indices[k]] = static_cast<Handle*>(group_handles[k]);
+      }
+    }
+  }
+
   void Erase(const Slice& key) override {
     HashVal hash = CacheShard::ComputeHash(key, hash_seed_);
     GetShard(hash).Erase(key, hash);
@@ -65,8 +65,10 @@ void ArenaWrappedDBIter::Init(
 
 void ArenaWrappedDBIter::MaybeAutoRefresh(bool is_seek,
                                           DBIter::Direction direction) {
-  if (cfh_ != nullptr && read_options_.snapshot != nullptr && allow_refresh_ &&
-      read_options_.auto_refresh_iterator_with_snapshot) {
+  // Callers have already checked auto_refresh_iterator_with_snapshot, so the
+  // common case (option disabled) never pays for this call.
+  assert(read_options_.auto_refresh_iterator_with_snapshot);
+  if (cfh_ != nullptr && read_options_.snapshot != nullptr && allow_refresh_) {
     // The intent here is to capture the superversion number change
     // reasonably soon from the time it actually happened. As such,
     // we're fine with weaker synchronization / ordering guarantees
@@ -150,10 +152,17 @@ void ArenaWrappedDBIter::DoRefresh(const Snapshot* snapshot,
   // present in the error log, but won't be reflected in the iterator status.
   // This is by design as we expect compaction to clean up those obsolete files
   // eventually.
+  // Remember how large the old iterator's demand-grown buffers got so the
+  // replacement can start out warmed up instead of growing them again.
+  size_t saved_key_capacity = 0;
+  size_t pinned_capacity = 0;
+  db_iter_->GetBufferHighWater(&saved_key_capacity, &pinned_capacity);
+
   db_iter_->~DBIter();
 
-  arena_.~Arena();
-  new (&arena_) Arena();
+  // Recycle the arena rather than reconstructing it so that repeated
+  // refreshes reuse the same block instead of going back to the allocator.
+  arena_.Reset();
 
   auto cfd = cfh_->cfd();
   auto db_impl = cfh_->db();
@@ -167,6 +176,7 @@ void ArenaWrappedDBIter::DoRefresh(const Snapshot* snapshot,
   Init(env, read_options_, cfd->ioptions(), sv->mutable_cf_options, sv->current,
        read_seq, sv->version_number, read_callback_, cfh_, expose_blob_index_,
        allow_refresh_, allow_mark_memtable_for_flush_ ? sv->mem : nullptr);
+  db_iter_->PrewarmBuffers(saved_key_capacity, pinned_capacity);
 
   InternalIterator* internal_iter = db_impl->NewInternalIterator(
       read_options_, cfd, sv, &arena_, read_seq,
@@ -65,23 +65,31 @@ class ArenaWrappedDBIter : public Iterator {
   // 'target' does not contain timestamp, even if user timestamp feature is
   // enabled.
   void Seek(const Slice& target) override {
-    MaybeAutoRefresh(true /* is_seek */, DBIter::kForward);
+    if (read_options_.auto_refresh_iterator_with_snapshot) {
+      MaybeAutoRefresh(true /* is_seek */, DBIter::kForward);
+    }
     db_iter_->Seek(target);
   }
 
   void SeekForPrev(const Slice& target) override {
-    MaybeAutoRefresh(true /* is_seek */, DBIter::kReverse);
+    if (read_options_.auto_refresh_iterator_with_snapshot) {
+      MaybeAutoRefresh(true /* is_seek */, DBIter::kReverse);
+    }
     db_iter_->SeekForPrev(target);
   }
 
   void Next() override {
     db_iter_->Next();
-    MaybeAutoRefresh(false /* is_seek */, DBIter::kForward);
+    if (read_options_.auto_refresh_iterator_with_snapshot) {
+      MaybeAutoRefresh(false /* is_seek */, DBIter::kForward);
+    }
   }
 
   void Prev() override {
     db_iter_->Prev();
-    MaybeAutoRefresh(false /* is_seek */, DBIter::kReverse);
+    if (read_options_.auto_refresh_iterator_with_snapshot) {
+      MaybeAutoRefresh(false /* is_seek */, DBIter::kReverse);
+    }
   }
 
   Slice key() const override { return db_iter_->key(); }
@@ -200,7 +200,7 @@ Status BlobSource::GetBlob(const ReadOptions& read_options,
 
   const bool no_io = read_options.read_tier == kBlockCacheTier;
   if (no_io) {
-    s = Status::Incomplete("Cannot read blob(s): no disk I/O allowed");
+    s = Status::Incomplete(Status::SubCode::kBlockingIoNotAllowed);
     return s;
   }
 
@@ -355,7 +355,7 @@ void BlobSource::MultiGetBlobFromOneFile(const ReadOptions& read_options,
         assert(req.status);
 
         *req.status =
-            Status::Incomplete("Cannot read blob(s): no disk I/O allowed");
+            Status::Incomplete(Status::SubCode::kBlockingIoNotAllowed);
       }
     }
     return;
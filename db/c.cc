@@ -1611,6 +1611,52 @@ void rocksdb_batched_multi_get_cf(rocksdb_t* db,
   delete[] statuses;
 }
 
+size_t rocksdb_multi_get_cf_into_buffer(
+    rocksdb_t* db, const rocksdb_readoptions_t* options,
+    rocksdb_column_family_handle_t* column_family, size_t num_keys,
+    const char* const* keys_list, const size_t* keys_list_sizes,
+    char* value_buf, size_t value_buf_size, size_t* value_offsets,
+    size_t* value_sizes, unsigned char* found_list, char** errs,
+    const bool sorted_input) {
+  Slice* key_slices = new Slice[num_keys];
+  PinnableSlice* value_slices = new PinnableSlice[num_keys];
+  Status* statuses = new Status[num_keys];
+  for (size_t i = 0; i < num_keys; ++i) {
+    key_slices[i] = Slice(keys_list[i], keys_list_sizes[i]);
+  }
+
+  db->rep->MultiGet(options->rep, column_family->rep, num_keys, key_slices,
+                    value_slices, statuses, sorted_input);
+
+  size_t needed = 0;
+  for (size_t i = 0; i < num_keys; ++i) {
+    value_offsets[i] = needed;
+    if (statuses[i].ok()) {
+      const size_t size = value_slices[i].size();
+      if (needed + size <= value_buf_size) {
+        memcpy(value_buf + needed, value_slices[i].data(), size);
+      }
+      value_sizes[i] = size;
+      needed += size;
+      found_list[i] = 1;
+      errs[i] = nullptr;
+    } else {
+      value_sizes[i] = 0;
+      found_list[i] = 0;
+      if (!statuses[i].IsNotFound()) {
+        errs[i] = strdup(statuses[i].ToString().c_str());
+      } else {
+        errs[i] = nullptr;
+      }
+    }
+  }
+
+  delete[] key_slices;
+  delete[] value_slices;
+  delete[] statuses;
+  return needed;
+}
+
 unsigned char rocksdb_key_may_exist(rocksdb_t* db,
                                     const rocksdb_readoptions_t* options,
                                     const char* key, size_t key_len,
@@ -2006,6 +2052,34 @@ void rocksdb_iter_seek_for_prev(rocksdb_iterator_t* iter, const char* k,
 
 void rocksdb_iter_next(rocksdb_iterator_t* iter) { iter->rep->Next(); }
 
+size_t rocksdb_iter_next_batch(rocksdb_iterator_t* iter, size_t num_pairs,
+                               char* buf, size_t buf_size, size_t* key_offsets,
+                               size_t* key_sizes, size_t* value_offsets,
+                               size_t* value_sizes) {
+  size_t copied = 0;
+  size_t used = 0;
+  while (copied < num_pairs && iter->rep->Valid()) {
+    Slice key = iter->rep->key();
+    Slice value = iter->rep->value();
+    if (used + key.size() + value.size() > buf_size) {
+      // Leave the iterator on the pair that did not fit so the caller can
+      // continue with another buffer.
+      break;
+    }
+    key_offsets[copied] = used;
+    key_sizes[copied] = key.size();
+    memcpy(buf + used, key.data(), key.size());
+    used += key.size();
+    value_offsets[copied] = used;
+    value_sizes[copied] = value.size();
+    memcpy(buf + used, value.data(), value.size());
+    used += value.size();
+    ++copied;
+    iter->rep->Next();
+  }
+  return copied;
+}
+
 void rocksdb_iter_prev(rocksdb_iterator_t* iter) { iter->rep->Prev(); }
 
 const char* rocksdb_iter_key(const rocksdb_iterator_t* iter, size_t* klen) {
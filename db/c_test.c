@@ -1839,6 +1839,43 @@ int main(int argc, char** argv) {
       }
     }
 
+    {
+      const char* flat_keys[4] = {"box", "buff", "barfooxx", "box"};
+      const size_t flat_keys_sizes[4] = {3, 4, 8, 3};
+      char flat_buf[64];
+      size_t flat_offsets[4];
+      size_t flat_sizes[4];
+      unsigned char flat_found[4];
+      char* flat_errs[4];
+
+      size_t needed = rocksdb_multi_get_cf_into_buffer(
+          db, roptions, handles[1], 4, flat_keys, flat_keys_sizes, flat_buf,
+          sizeof(flat_buf), flat_offsets, flat_sizes, flat_found, flat_errs,
+          false);
+      CheckCondition(needed == 9);  // "c" + "rocksdb" + "c"
+      CheckCondition(needed <= sizeof(flat_buf));
+      for (i = 0; i < 4; ++i) {
+        CheckNoError(flat_errs[i]);
+      }
+      CheckCondition(flat_found[0] && flat_found[1] && !flat_found[2] &&
+                     flat_found[3]);
+      CheckEqual("c", flat_buf + flat_offsets[0], flat_sizes[0]);
+      CheckEqual("rocksdb", flat_buf + flat_offsets[1], flat_sizes[1]);
+      CheckCondition(flat_sizes[2] == 0);
+      CheckEqual("c", flat_buf + flat_offsets[3], flat_sizes[3]);
+
+      // An undersized buffer reports the size needed without copying the
+      // values that did not fit.
+      needed = rocksdb_multi_get_cf_into_buffer(
+          db, roptions, handles[1], 4, flat_keys, flat_keys_sizes, flat_buf, 1,
+          flat_offsets, flat_sizes, flat_found, flat_errs, false);
+      CheckCondition(needed == 9);
+      CheckEqual("c", flat_buf + flat_offsets[0], flat_sizes[0]);
+      for (i = 0; i < 4; ++i) {
+        CheckNoError(flat_errs[i]);
+      }
+    }
+
     {
       unsigned char value_found = 0;
 
@@ -1876,6 +1913,34 @@ int main(int argc, char** argv) {
     CheckNoError(err);
     rocksdb_iter_destroy(iter);
 
+    {
+      char batch_buf[512];
+      size_t key_offs[8], key_lens[8], val_offs[8], val_lens[8];
+      rocksdb_iterator_t* batch_iter =
+          rocksdb_create_iterator_cf(db, roptions, handles[1]);
+      rocksdb_iter_seek_to_first(batch_iter);
+      size_t n = rocksdb_iter_next_batch(batch_iter, 8, batch_buf,
+                                         sizeof(batch_buf), key_offs, key_lens,
+                                         val_offs, val_lens);
+      CheckCondition(n == 4);
+      CheckCondition(!rocksdb_iter_valid(batch_iter));
+      CheckEqual("box", batch_buf + key_offs[0], key_lens[0]);
+      CheckEqual("c", batch_buf + val_offs[0], val_lens[0]);
+      CheckEqual("buff", batch_buf + key_offs[1], key_lens[1]);
+      CheckEqual("rocksdb", batch_buf + val_offs[1], val_lens[1]);
+
+      // A buffer too small for the first pair copies nothing and leaves the
+      // iterator in place.
+      rocksdb_iter_seek_to_first(batch_iter);
+      n = rocksdb_iter_next_batch(batch_iter, 8, batch_buf, 1, key_offs,
+                                  key_lens, val_offs, val_lens);
+      CheckCondition(n == 0);
+      CheckCondition(rocksdb_iter_valid(batch_iter));
+      rocksdb_iter_get_error(batch_iter, &err);
+      CheckNoError(err);
+      rocksdb_iter_destroy(batch_iter);
+    }
+
     rocksdb_column_family_handle_t* iters_cf_handles[2] = {handles[0],
                                                            handles[1]};
     rocksdb_iterator_t* iters_handles[2];
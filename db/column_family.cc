@@ -594,6 +594,7 @@ ColumnFamilyData::ColumnFamilyData(
       last_memtable_id_(0),
       db_paths_registered_(false),
       mempurge_used_(false),
+      memtable_garbage_ratio_(-1.0),
       next_epoch_number_(1) {
   if (id_ != kDummyColumnFamilyDataId) {
     // TODO(cc): RegisterDbPaths can be expensive, considering moving it
@@ -785,6 +786,20 @@ ColumnFamilyOptions ColumnFamilyData::GetLatestCFOptions() const {
   return BuildColumnFamilyOptions(initial_cf_options_, mutable_cf_options_);
 }
 
+void ColumnFamilyData::UpdateMemtableGarbageRatio(double observed) {
+  observed = std::min(std::max(observed, 0.0), 1.0);
+  double current = memtable_garbage_ratio_.load(std::memory_order_relaxed);
+  if (current < 0.0) {
+    memtable_garbage_ratio_.store(observed, std::memory_order_relaxed);
+  } else {
+    // Exponential moving average; recently flushed memtables are the best
+    // predictor of the next one.
+    constexpr double kAlpha = 0.25;
+    memtable_garbage_ratio_.store(current + kAlpha * (observed - current),
+                                  std::memory_order_relaxed);
+  }
+}
+
 uint64_t ColumnFamilyData::OldestLogToKeep() {
   auto current_log = GetLogNumber();
 
@@ -810,11 +825,26 @@ const double kNearStopSlowdownRatio = 0.6;
 const double kDelayRecoverSlowdownRatio = 1.4;
 
 namespace {
+// Maps how far a stall signal has advanced past its slowdown trigger toward
+// its stop trigger onto a rate ceiling factor in [0, 1]. Returns 1.0 at the
+// slowdown trigger and decays quadratically to 0 at the stop trigger, so
+// with `use_smooth_write_delay` the write rate ramps down (and recovers)
+// gradually instead of toggling between full speed and a hard throttle.
+double GetStallDistanceFactor(uint64_t position, uint64_t range) {
+  if (range == 0 || position >= range) {
+    return 0.0;
+  }
+  const double remaining = 1.0 - static_cast<double>(position) / range;
+  return remaining * remaining;
+}
+
 // If penalize_stop is true, we further reduce slowdown rate.
+// stall_distance_factor caps the write rate at a fraction of the maximum
+// rate; pass 1.0 to leave the rate uncapped.
 std::unique_ptr<WriteControllerToken> SetupDelay(
     WriteController* write_controller, uint64_t compaction_needed_bytes,
     uint64_t prev_compaction_need_bytes, bool penalize_stop,
-    bool auto_compactions_disabled) {
+    bool auto_compactions_disabled, double stall_distance_factor) {
   const uint64_t kMinWriteRate = 16 * 1024u;  // Minimum write rate 16KB/s.
 
   uint64_t max_write_rate = write_controller->max_delayed_write_rate();
@@ -871,6 +901,19 @@ std::unique_ptr<WriteControllerToken> SetupDelay(
       }
     }
   }
+
+  // The distance-to-stall factor acts as the proportional term of the
+  // controller: it caps the rate by how close this column family is to its
+  // stop trigger, so the rate degrades and recovers smoothly with the stall
+  // signal. The multiplicative adjustments above provide damping based on
+  // whether compaction debt is growing or shrinking.
+  if (!auto_compactions_disabled && max_write_rate > kMinWriteRate &&
+      stall_distance_factor < 1.0) {
+    uint64_t rate_ceiling = static_cast<uint64_t>(
+        static_cast<double>(max_write_rate) * stall_distance_factor);
+    rate_ceiling = std::max(rate_ceiling, kMinWriteRate);
+    write_rate = std::min(write_rate, rate_ceiling);
+  }
   return write_controller->GetDelayToken(write_rate);
 }
 
@@ -915,10 +958,7 @@ uint64_t GetPendingCompactionBytesForCompactionSpeedup(
   // Meaningful progress toward the slowdown trigger is another good indication.
   const uint64_t kSlowdownTriggerDivisor = 4;
 
-  uint64_t bottommost_files_size = 0;
-  for (const auto& level_and_file : vstorage->BottommostFiles()) {
-    bottommost_files_size += level_and_file.second->fd.GetFileSize();
-  }
+  const uint64_t bottommost_files_size = vstorage->BottommostFilesSize();
 
   // Slowdown trigger might be zero but that means compaction speedup should
   // always happen (undocumented/historical), so no special treatment is needed.
@@ -1042,7 +1082,8 @@ WriteStallCondition ColumnFamilyData::RecalculateWriteStallConditions(
       write_controller_token_ =
           SetupDelay(write_controller, compaction_needed_bytes,
                      prev_compaction_needed_bytes_, was_stopped,
-                     mutable_cf_options.disable_auto_compactions);
+                     mutable_cf_options.disable_auto_compactions,
+                     1.0 /* stall_distance_factor */);
       internal_stats_->AddCFStats(InternalStats::MEMTABLE_LIMIT_DELAYS, 1);
       ROCKS_LOG_WARN(
           ioptions_.logger,
@@ -1057,10 +1098,23 @@ WriteStallCondition ColumnFamilyData::RecalculateWriteStallConditions(
       // L0 is the last two files from stopping.
       bool near_stop = vstorage->l0_delay_trigger_count() >=
                        mutable_cf_options.level0_stop_writes_trigger - 2;
+      double stall_distance_factor = 1.0;
+      if (ioptions_.use_smooth_write_delay &&
+          mutable_cf_options.level0_stop_writes_trigger >
+              mutable_cf_options.level0_slowdown_writes_trigger) {
+        stall_distance_factor = GetStallDistanceFactor(
+            static_cast<uint64_t>(
+                vstorage->l0_delay_trigger_count() -
+                mutable_cf_options.level0_slowdown_writes_trigger),
+            static_cast<uint64_t>(
+                mutable_cf_options.level0_stop_writes_trigger -
+                mutable_cf_options.level0_slowdown_writes_trigger));
+      }
       write_controller_token_ =
           SetupDelay(write_controller, compaction_needed_bytes,
                      prev_compaction_needed_bytes_, was_stopped || near_stop,
-                     mutable_cf_options.disable_auto_compactions);
+                     mutable_cf_options.disable_auto_compactions,
+                     stall_distance_factor);
       internal_stats_->AddCFStats(InternalStats::L0_FILE_COUNT_LIMIT_DELAYS, 1);
       if (compaction_picker_->IsLevel0CompactionInProgress()) {
         internal_stats_->AddCFStats(
@@ -1086,10 +1140,21 @@ WriteStallCondition ColumnFamilyData::RecalculateWriteStallConditions(
                    mutable_cf_options.soft_pending_compaction_bytes_limit) /
                   4;
 
+      double stall_distance_factor = 1.0;
+      if (ioptions_.use_smooth_write_delay &&
+          mutable_cf_options.hard_pending_compaction_bytes_limit >
+              mutable_cf_options.soft_pending_compaction_bytes_limit) {
+        stall_distance_factor = GetStallDistanceFactor(
+            compaction_needed_bytes -
+                mutable_cf_options.soft_pending_compaction_bytes_limit,
+            mutable_cf_options.hard_pending_compaction_bytes_limit -
+                mutable_cf_options.soft_pending_compaction_bytes_limit);
+      }
       write_controller_token_ =
           SetupDelay(write_controller, compaction_needed_bytes,
                      prev_compaction_needed_bytes_, was_stopped || near_stop,
-                     mutable_cf_options.disable_auto_compactions);
+                     mutable_cf_options.disable_auto_compactions,
+                     stall_distance_factor);
       internal_stats_->AddCFStats(
           InternalStats::PENDING_COMPACTION_BYTES_LIMIT_DELAYS, 1);
       ROCKS_LOG_WARN(
@@ -1186,8 +1251,16 @@ uint64_t ColumnFamilyData::GetLiveSstFilesSize() const {
 
 MemTable* ColumnFamilyData::ConstructNewMemtable(
     const MutableCFOptions& mutable_cf_options, SequenceNumber earliest_seq) {
+  // The outgoing memtable's entry count right-sizes the new memtable's
+  // prefix bloom filter. mem_ may still be accepting writes (SwitchMemtable
+  // constructs the replacement before installing it); NumEntries() is a
+  // relaxed atomic read, and reading mem_ outside the DB mutex is safe here
+  // for the same reason SwitchMemtable accesses mem() after releasing it:
+  // memtable switches for this CF cannot run concurrently.
+  uint64_t prev_num_entries_hint = mem_ != nullptr ? mem_->NumEntries() : 0;
   return new MemTable(internal_comparator_, ioptions_, mutable_cf_options,
-                      write_buffer_manager_, earliest_seq, id_);
+                      write_buffer_manager_, earliest_seq, id_,
+                      prev_num_entries_hint);
 }
 
 void ColumnFamilyData::CreateNewMemtable(SequenceNumber earliest_seq) {
@@ -1210,6 +1283,14 @@ Compaction* ColumnFamilyData::PickCompaction(
     const MutableDBOptions& mutable_db_options,
     const std::vector<SequenceNumber>& existing_snapshots,
     const SnapshotChecker* snapshot_checker, LogBuffer* log_buffer) {
+  // Hand the picker the measured per-level compaction costs so it can
+  // prefer the candidate with the best debt reduction per unit of work.
+  std::vector<double> comp_cost_per_byte(ioptions_.num_levels, 0.0);
+  for (int level = 0; level < ioptions_.num_levels; level++) {
+    comp_cost_per_byte[level] = internal_stats_->GetCompactionCostPerByte(level);
+  }
+  current_->storage_info()->SetCompactionCostPerByte(
+      std::move(comp_cost_per_byte));
   auto* result = compaction_picker_->PickCompaction(
       GetName(), mutable_options, mutable_db_options, existing_snapshots,
       snapshot_checker, current_->storage_info(), log_buffer);
@@ -267,7 +267,10 @@ struct SuperVersion {
   static void* const kSVObsolete;
 
  private:
-  std::atomic<uint32_t> refs;
+  // On its own cache line so that ref count updates from readers that miss
+  // the thread-local cache don't invalidate the line holding the fields
+  // (mem, imm, current, ...) that every pinned reader dereferences.
+  ALIGN_AS(CACHE_LINE_SIZE) std::atomic<uint32_t> refs;
   // We need to_delete because during Cleanup(), imm->Unref() returns
   // all memtables that we need to free through this vector. We then
   // delete all those memtables outside of mutex, during destruction
@@ -577,6 +580,17 @@ class ColumnFamilyData {
   void SetMempurgeUsed() { mempurge_used_ = true; }
   bool GetMempurgeUsed() { return mempurge_used_; }
 
+  // Exponentially smoothed estimate of the fraction of memtable payload
+  // bytes found to be garbage (overwritten or deleted) by past flushes and
+  // mempurges of this column family. Used by FlushJob::MemPurgeDecider as a
+  // learned admission prior. Negative until the first observation.
+  double GetMemtableGarbageRatio() const {
+    return memtable_garbage_ratio_.load(std::memory_order_relaxed);
+  }
+  // Fold a new observation into the estimate. Updates from concurrent flush
+  // jobs may race, which is acceptable for a heuristic.
+  void UpdateMemtableGarbageRatio(double observed);
+
   // Allocate and return a new epoch number
   uint64_t NewEpochNumber() { return next_epoch_number_.fetch_add(1); }
 
@@ -706,6 +720,9 @@ class ColumnFamilyData {
   std::shared_ptr<CacheReservationManager> file_metadata_cache_res_mgr_;
   bool mempurge_used_;
 
+  // See GetMemtableGarbageRatio()
+  std::atomic<double> memtable_garbage_ratio_;
+
   std::atomic<uint64_t> next_epoch_number_;
 };
 
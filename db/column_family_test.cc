@@ -2843,6 +2843,60 @@ TEST_P(ColumnFamilyTest, CompactionSpeedupSingleColumnFamily) {
   ASSERT_EQ(1, dbfull()->TEST_BGCompactionsAllowed());
 }
 
+TEST_P(ColumnFamilyTest, WriteStallSmoothDelay) {
+  const uint64_t kBaseRate = 800000u;
+  db_options_.delayed_write_rate = kBaseRate;
+  db_options_.use_smooth_write_delay = true;
+
+  Open({"default"});
+  ColumnFamilyData* cfd =
+      static_cast<ColumnFamilyHandleImpl*>(db_->DefaultColumnFamily())->cfd();
+
+  VersionStorageInfo* vstorage = cfd->current()->storage_info();
+
+  MutableCFOptions mutable_cf_options(column_family_options_);
+  mutable_cf_options.level0_slowdown_writes_trigger = 20;
+  mutable_cf_options.level0_stop_writes_trigger = 10000;
+  mutable_cf_options.soft_pending_compaction_bytes_limit = 200;
+  mutable_cf_options.hard_pending_compaction_bytes_limit = 2200;
+  mutable_cf_options.disable_auto_compactions = false;
+
+  auto dbmu = dbfull()->TEST_Mutex();
+
+  // The rate ceiling decays with the square of the remaining distance
+  // between the soft (200) and hard (2200) limits.
+
+  // Halfway to the hard limit: ceiling is kBaseRate * 0.5^2.
+  vstorage->TEST_set_estimated_compaction_needed_bytes(1200, dbmu);
+  RecalculateWriteStallConditions(cfd, mutable_cf_options);
+  ASSERT_TRUE(!IsDbWriteStopped());
+  ASSERT_TRUE(dbfull()->TEST_write_controler().NeedsDelay());
+  ASSERT_EQ(kBaseRate / 4, GetDbDelayedWriteRate());
+
+  // Three quarters of the way: growing debt also applies the damping
+  // slowdown, but the ceiling of kBaseRate * 0.25^2 dominates.
+  vstorage->TEST_set_estimated_compaction_needed_bytes(1700, dbmu);
+  RecalculateWriteStallConditions(cfd, mutable_cf_options);
+  ASSERT_TRUE(!IsDbWriteStopped());
+  ASSERT_TRUE(dbfull()->TEST_write_controler().NeedsDelay());
+  ASSERT_EQ(kBaseRate / 16, GetDbDelayedWriteRate());
+
+  // Compaction catching up: the rate recovers gradually through the
+  // damping speedup instead of jumping back to the base rate.
+  vstorage->TEST_set_estimated_compaction_needed_bytes(700, dbmu);
+  RecalculateWriteStallConditions(cfd, mutable_cf_options);
+  ASSERT_TRUE(!IsDbWriteStopped());
+  ASSERT_TRUE(dbfull()->TEST_write_controler().NeedsDelay());
+  ASSERT_EQ(static_cast<uint64_t>(kBaseRate / 16 * 1.25),
+            GetDbDelayedWriteRate());
+
+  // Back under the soft limit: no more delay.
+  vstorage->TEST_set_estimated_compaction_needed_bytes(150, dbmu);
+  RecalculateWriteStallConditions(cfd, mutable_cf_options);
+  ASSERT_TRUE(!IsDbWriteStopped());
+  ASSERT_TRUE(!dbfull()->TEST_write_controler().NeedsDelay());
+}
+
 TEST_P(ColumnFamilyTest, WriteStallTwoColumnFamilies) {
   const uint64_t kBaseRate = 810000u;
   db_options_.delayed_write_rate = kBaseRate;
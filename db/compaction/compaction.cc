@@ -18,6 +18,7 @@
 #include "rocksdb/compaction_filter.h"
 #include "rocksdb/sst_partitioner.h"
 #include "test_util/sync_point.h"
+#include "util/hash_containers.h"
 #include "util/string_util.h"
 
 namespace ROCKSDB_NAMESPACE {
@@ -425,7 +426,7 @@ void Compaction::PopulateProximalLevelOutputRange() {
   if (immutable_options_.compaction_style == kCompactionStyleUniversal) {
     exclude_level = kInvalidLevel;
     proximal_output_range_type_ = ProximalOutputRangeType::kFullRange;
-    std::set<uint64_t> proximal_inputs;
+    UnorderedSet<uint64_t> proximal_inputs;
     for (const auto& input_lvl : inputs_) {
       if (input_lvl.level == proximal_level_) {
         for (const auto& file : input_lvl.files) {
@@ -933,6 +934,13 @@ bool Compaction::ShouldFormSubcompactions() const {
   if (cfd_->ioptions().compaction_style == kCompactionStyleLevel) {
     return (start_level_ == 0 || is_manual_compaction_) && output_level_ > 0;
   } else if (cfd_->ioptions().compaction_style == kCompactionStyleUniversal) {
+    // This covers full and size-amp compactions, which always output to the
+    // last level: the key-range partitioned outputs form one valid sorted
+    // run there, like they do for leveled compaction. Compactions that
+    // output to L0 (e.g. with num_levels = 1) cannot be subdivided: each L0
+    // file is its own sorted run ordered by sequence number, so the
+    // range-partitioned outputs would have to be tracked as a single
+    // multi-file run, which the sorted-run accounting does not support.
     return number_levels_ > 1 && output_level_ > 0;
   } else {
     return false;
@@ -981,6 +989,34 @@ uint64_t Compaction::MaxInputFileNewestKeyTime(const InternalKey* start,
   return newest_key_time;
 }
 
+uint64_t Compaction::MinInputFileOldestKeyTime(const InternalKey* start,
+                                               const InternalKey* end) const {
+  uint64_t oldest_key_time = kUnknownOldestKeyTime;
+  const InternalKeyComparator& icmp =
+      column_family_data()->internal_comparator();
+  for (const auto& level_files : inputs_) {
+    for (const auto& file : level_files.files) {
+      if (start != nullptr && icmp.Compare(file->largest, *start) < 0) {
+        continue;
+      }
+      if (end != nullptr && icmp.Compare(file->smallest, *end) > 0) {
+        continue;
+      }
+      uint64_t file_oldest_key_time = file->TryGetOldestKeyTime();
+      if (file_oldest_key_time == kUnknownOldestKeyTime) {
+        // Unknown for any input file means unknown for the output.
+        return kUnknownOldestKeyTime;
+      }
+      if (oldest_key_time == kUnknownOldestKeyTime) {
+        oldest_key_time = file_oldest_key_time;
+      } else {
+        oldest_key_time = std::min(oldest_key_time, file_oldest_key_time);
+      }
+    }
+  }
+  return oldest_key_time;
+}
+
 uint64_t Compaction::MinInputFileOldestAncesterTime(
     const InternalKey* start, const InternalKey* end) const {
   uint64_t min_oldest_ancester_time = std::numeric_limits<uint64_t>::max();
@@ -51,6 +51,12 @@ struct CompactionIterationStats {
   // Number of kTypeValuePreferredSeqno records we ended up swapping in
   // preferred seqno.
   uint64_t num_timed_put_swap_preferred_seqno = 0;
+
+  // Number of times the reusable per-key buffers had to grow beyond their
+  // high-water marks. Expected to stay near zero in steady state; useful for
+  // verifying that the merge loop is allocation-free.
+  uint64_t num_key_buffer_growths = 0;
+  uint64_t num_value_buffer_growths = 0;
 };
 
 }  // namespace ROCKSDB_NAMESPACE
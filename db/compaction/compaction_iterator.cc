@@ -95,6 +95,10 @@ CompactionIterator::CompactionIterator(
       enforce_single_del_contracts_(enforce_single_del_contracts),
       timestamp_size_(cmp_ ? cmp_->timestamp_size() : 0),
       full_history_ts_low_(full_history_ts_low),
+      simple_put_fast_path_(visible_at_tip_ && snapshot_checker == nullptr &&
+                            compaction_filter == nullptr &&
+                            timestamp_size_ == 0 &&
+                            full_history_ts_low == nullptr),
       current_user_key_sequence_(0),
       current_user_key_snapshot_(0),
       merge_out_iter_(merge_helper_),
@@ -145,6 +149,31 @@ void CompactionIterator::ResetRecordCounts() {
 void CompactionIterator::SeekToFirst() {
   NextFromInput();
   PrepareOutput();
+  UpdateBufferGrowthStats();
+}
+
+void CompactionIterator::UpdateBufferGrowthStats() {
+  const size_t key_cap = current_key_.BufferCapacity();
+  if (key_cap > current_key_buf_capacity_) {
+    if (current_key_buf_capacity_ > 0) {
+      iter_stats_.num_key_buffer_growths++;
+    }
+    current_key_buf_capacity_ = key_cap;
+  }
+  const size_t filter_value_cap = compaction_filter_value_.capacity();
+  if (filter_value_cap > compaction_filter_value_capacity_) {
+    if (compaction_filter_value_capacity_ > 0) {
+      iter_stats_.num_value_buffer_growths++;
+    }
+    compaction_filter_value_capacity_ = filter_value_cap;
+  }
+  const size_t blob_index_cap = blob_index_.capacity();
+  if (blob_index_cap > blob_index_capacity_) {
+    if (blob_index_capacity_ > 0) {
+      iter_stats_.num_value_buffer_growths++;
+    }
+    blob_index_capacity_ = blob_index_cap;
+  }
 }
 
 void CompactionIterator::Next() {
@@ -513,6 +542,30 @@ void CompactionIterator::NextFromInput() {
                                : 0;
     }
 
+    // Short-circuit for the dominant case in a snapshot-free, filter-free
+    // compaction: a plain Put for a new user key is always emitted unchanged,
+    // so skip the full state machine below. Older versions of the same user
+    // key, non-Put entry types, the Put following an uncompacted SingleDelete
+    // and anything potentially covered by a range tombstone all fall through
+    // to the general path.
+    if (simple_put_fast_path_ && ikey_.type == kTypeValue &&
+        (!has_current_user_key_ || !user_key_equal_without_ts) &&
+        !clear_and_output_next_key_ && range_del_agg_->IsEmpty()) {
+      key_ = current_key_.SetInternalKey(key_, &ikey_);
+      current_user_key_ = ikey_.user_key;
+      has_current_user_key_ = true;
+      has_outputted_key_ = false;
+      last_key_seq_zeroed_ = false;
+      current_key_committed_ = true;
+      // Same post-state as the general path: with no snapshots this entry is
+      // visible at the tip, and rule (A) below drops any older versions of
+      // this user key that follow.
+      current_user_key_sequence_ = ikey_.sequence;
+      current_user_key_snapshot_ = earliest_snapshot_;
+      validity_info_.SetValid(ValidContext::kNewUserKey);
+      break;
+    }
+
     // Check whether the user key changed. After this if statement current_key_
     // is a copy of the current input key (maybe converted to a delete by the
     // compaction filter). ikey_.user_key is pointing to the copy.
@@ -1117,6 +1170,8 @@ void CompactionIterator::NextFromInput() {
   if (!input_.Valid() && input_.status().IsCorruption()) {
     status_ = input_.status();
   }
+
+  UpdateBufferGrowthStats();
 }
 
 bool CompactionIterator::ExtractLargeValueIfNeededImpl() {
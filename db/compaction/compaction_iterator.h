@@ -324,6 +324,12 @@ class CompactionIterator {
     }
   }
 
+  // Update iter_stats_ with any growth of the reusable per-key buffers
+  // (current_key_, compaction_filter_value_, blob_index_) since the last
+  // call. Called once per output record; the buffers only ever grow, so
+  // growths between calls are not missed.
+  void UpdateBufferGrowthStats();
+
   static uint64_t ComputeBlobGarbageCollectionCutoffFileNumber(
       const CompactionProxy* compaction);
   static std::unique_ptr<BlobFetcher> CreateBlobFetcherIfNeeded(
@@ -374,6 +380,14 @@ class CompactionIterator {
   // If nullptr, NO GC will be performed and all history will be preserved.
   const std::string* const full_history_ts_low_;
 
+  // True when none of the inputs to the key-handling state machine in
+  // NextFromInput() can apply: no live snapshots, no snapshot checker, no
+  // compaction filter and no user-defined timestamps. In that configuration
+  // a plain Put for a new user key is always emitted as-is, so NextFromInput()
+  // takes a short-circuit path for it. Common for recompression compactions
+  // near the bottom of the LSM whose input files do not overlap each other.
+  const bool simple_put_fast_path_;
+
   // State
   //
   enum ValidContext : uint8_t {
@@ -461,6 +475,13 @@ class CompactionIterator {
   std::vector<size_t> level_ptrs_;
   CompactionIterationStats iter_stats_;
 
+  // Last observed capacities of the reusable per-key buffers, used by
+  // UpdateBufferGrowthStats() to detect reallocations. Zero means the
+  // baseline has not been established yet.
+  size_t current_key_buf_capacity_ = 0;
+  size_t compaction_filter_value_capacity_ = 0;
+  size_t blob_index_capacity_ = 0;
+
   // Used to avoid purging uncommitted values. The application can specify
   // uncommitted values by providing a SnapshotChecker object.
   bool current_key_committed_;
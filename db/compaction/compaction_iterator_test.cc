@@ -363,6 +363,31 @@ class CompactionIteratorTest : public testing::TestWithParam<bool> {
   FakeCompaction* compaction_proxy_;
 };
 
+// Keys with creeping sizes force the reusable key buffer to grow; geometric
+// growth keeps the number of reallocations well below the number of keys,
+// and the growth counters in the iteration stats make this observable.
+TEST_P(CompactionIteratorTest, BufferGrowthStats) {
+  std::vector<std::string> ks, vs;
+  for (int i = 0; i < 16; i++) {
+    ks.push_back(test::KeyStr(std::string(50 + 10 * i, 'a' + char(i)),
+                              100 - i, kTypeValue));
+    vs.push_back("val");
+  }
+  InitIterators(ks, vs, {}, {}, 200);
+  c_iter_->SeekToFirst();
+  size_t count = 0;
+  while (c_iter_->Valid()) {
+    count++;
+    c_iter_->Next();
+  }
+  ASSERT_OK(c_iter_->status());
+  ASSERT_EQ(ks.size(), count);
+  const CompactionIterationStats& stats = c_iter_->iter_stats();
+  ASSERT_GT(stats.num_key_buffer_growths, 0);
+  ASSERT_LT(stats.num_key_buffer_growths, ks.size() / 2);
+  ASSERT_EQ(0, stats.num_value_buffer_growths);
+}
+
 // It is possible that the output of the compaction iterator is empty even if
 // the input is not.
 TEST_P(CompactionIteratorTest, EmptyResult) {
@@ -1192,6 +1192,11 @@ void CompactionJob::ProcessKeyValueCompaction(SubcompactionState* sub_compact) {
   read_options.fill_cache = false;
   read_options.rate_limiter_priority = GetRateLimiterPriority();
   read_options.io_activity = Env::IOActivity::kCompaction;
+  // For compaction input iterators, auto_readahead_size opts into block
+  // cache lookups when sizing readahead so cache-resident input blocks are
+  // served from the cache instead of being re-read from storage.
+  read_options.auto_readahead_size =
+      db_options_.compaction_readahead_cache_lookup;
   // Compaction iterators shouldn't be confined to a single prefix.
   // Compactions use Seek() for
   // (a) concurrent compactions,
@@ -1490,6 +1495,10 @@ void CompactionJob::ProcessKeyValueCompaction(SubcompactionState* sub_compact) {
       c_iter_stats.total_input_raw_key_bytes;
   sub_compact->compaction_job_stats.total_input_raw_value_bytes +=
       c_iter_stats.total_input_raw_value_bytes;
+  sub_compact->compaction_job_stats.num_key_buffer_reallocations =
+      c_iter_stats.num_key_buffer_growths;
+  sub_compact->compaction_job_stats.num_value_buffer_reallocations =
+      c_iter_stats.num_value_buffer_growths;
 
   RecordTick(stats_, FILTER_OPERATION_TOTAL_TIME,
              c_iter_stats.total_filter_time);
@@ -2021,6 +2030,14 @@ Status CompactionJob::OpenCompactionOutputFile(SubcompactionState* sub_compact,
       sub_compact->start.has_value() ? &tmp_start : nullptr,
       sub_compact->end.has_value() ? &tmp_end : nullptr);
 
+  // Propagate the write-time range of the input keys so that the output
+  // file's oldest_key_time/newest_key_time properties stay usable for
+  // time-range file pruning (e.g. via ReadOptions::table_filter) and
+  // tiering decisions after the data has been compacted.
+  uint64_t oldest_key_time = sub_compact->compaction->MinInputFileOldestKeyTime(
+      sub_compact->start.has_value() ? &tmp_start : nullptr,
+      sub_compact->end.has_value() ? &tmp_end : nullptr);
+
   // Initialize a SubcompactionState::Output and add it to sub_compact->outputs
   uint64_t epoch_number = sub_compact->compaction->MinInputFileEpochNumber();
   {
@@ -2063,7 +2080,6 @@ Status CompactionJob::OpenCompactionOutputFile(SubcompactionState* sub_compact,
       db_options_.file_checksum_gen_factory.get(),
       tmp_set.Contains(FileType::kTableFile), false));
 
-  // TODO(hx235): pass in the correct `oldest_key_time` instead of `0`
   const ReadOptions read_options(Env::IOActivity::kCompaction);
   const WriteOptions write_options(Env::IOActivity::kCompaction);
   TableBuilderOptions tboptions(
@@ -2074,7 +2090,7 @@ Status CompactionJob::OpenCompactionOutputFile(SubcompactionState* sub_compact,
       sub_compact->compaction->output_compression_opts(), cfd->GetID(),
       cfd->GetName(), sub_compact->compaction->output_level(), newest_key_time,
       bottommost_level_, TableFileCreationReason::kCompaction,
-      0 /* oldest_key_time */, current_time, db_id_, db_session_id_,
+      oldest_key_time, current_time, db_id_, db_session_id_,
       sub_compact->compaction->max_output_file_size(), file_number,
       proximal_after_seqno_ /*last_level_inclusive_max_seqno_threshold*/);
 
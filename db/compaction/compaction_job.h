@@ -427,6 +427,12 @@ struct CompactionServiceInput {
 // CompactionServiceOutputFile is the metadata for the output SST file
 struct CompactionServiceOutputFile {
   std::string file_name;
+  // Size of the output file as reported by the remote worker. Carried in the
+  // result so that installation does not depend on the shared file system
+  // propagating the full size back to the primary (which could have metadata
+  // lag or caching bugs). 0 if the result came from a worker that predates
+  // this field.
+  uint64_t file_size = 0;
   SequenceNumber smallest_seqno;
   SequenceNumber largest_seqno;
   std::string smallest_internal_key;
@@ -445,8 +451,9 @@ struct CompactionServiceOutputFile {
 
   CompactionServiceOutputFile() = default;
   CompactionServiceOutputFile(
-      const std::string& name, SequenceNumber smallest, SequenceNumber largest,
-      std::string _smallest_internal_key, std::string _largest_internal_key,
+      const std::string& name, uint64_t _file_size, SequenceNumber smallest,
+      SequenceNumber largest, std::string _smallest_internal_key,
+      std::string _largest_internal_key,
       uint64_t _oldest_ancester_time, uint64_t _file_creation_time,
       uint64_t _epoch_number, const std::string& _file_checksum,
       const std::string& _file_checksum_func_name, uint64_t _paranoid_hash,
@@ -454,6 +461,7 @@ struct CompactionServiceOutputFile {
       const TableProperties& _table_properties, bool _is_proximal_level_output,
       Temperature _file_temperature)
       : file_name(name),
+        file_size(_file_size),
         smallest_seqno(smallest),
         largest_seqno(largest),
         smallest_internal_key(std::move(_smallest_internal_key)),
@@ -33,6 +33,20 @@ Status CompactionOutputs::Finish(
     relevant_mapping.SetCapacity(kMaxSeqnoTimePairsPerSST);
     builder_->SetSeqnoTimeTableProperties(relevant_mapping,
                                           meta->oldest_ancester_time);
+    // All data blocks have been written at this point. Kick off OS writeback
+    // of them now so that it proceeds in the background while the builder
+    // serializes the index, filter and footer blocks, leaving less dirty data
+    // for the blocking Sync() in WriterSyncClose() to wait on. Failures
+    // surface through the file writer on the next write or sync.
+    if (file_writer_ != nullptr) {
+      IOOptions io_opts;
+      IOStatus write_back_io_s = WritableFileWriter::PrepareIOOptions(
+          WriteOptions(Env::IOActivity::kCompaction), io_opts);
+      if (write_back_io_s.ok()) {
+        write_back_io_s = file_writer_->InitiateWriteback(io_opts);
+      }
+      write_back_io_s.PermitUncheckedError();
+    }
     s = builder_->Finish();
 
   } else {
@@ -241,8 +255,6 @@ bool CompactionOutputs::ShouldStopBefore(const CompactionIterator& c_iter) {
   }
 #endif  // NDEBUG
   const uint64_t previous_overlapped_bytes = grandparent_overlapped_bytes_;
-  const InternalKeyComparator* icmp =
-      &compaction_->column_family_data()->internal_comparator();
   size_t num_grandparent_boundaries_crossed = 0;
   bool should_stop_for_ttl = false;
   // Always update grandparent information like overlapped file number, size
@@ -283,6 +295,8 @@ bool CompactionOutputs::ShouldStopBefore(const CompactionIterator& c_iter) {
   // Check if it needs to split for RoundRobin
   // Invalid local_output_split_key indicates that we do not need to split
   if (local_output_split_key_ != nullptr && !is_split_) {
+    const InternalKeyComparator* icmp =
+        &compaction_->column_family_data()->internal_comparator();
     // Split occurs when the next key is larger than/equal to the cursor
     if (icmp->Compare(internal_key, local_output_split_key_->Encode()) >= 0) {
       is_split_ = true;
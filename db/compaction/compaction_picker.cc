@@ -62,6 +62,7 @@ bool FindIntraL0Compaction(const std::vector<FileMetaData*>& level_files,
       compact_bytes_per_del_file < max_compact_bytes_per_del_file) {
     assert(comp_inputs != nullptr);
     comp_inputs->level = 0;
+    comp_inputs->files.reserve(limit - start);
     for (size_t i = start; i < limit; ++i) {
       comp_inputs->files.push_back(level_files[i]);
     }
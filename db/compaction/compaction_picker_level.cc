@@ -9,6 +9,9 @@
 
 #include "db/compaction/compaction_picker_level.h"
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -77,6 +80,14 @@ class LevelCompactionBuilder {
   // in Intra-L0 compactions)
   void SetupInitialFiles();
 
+  // The order in which to consider entries of vstorage_->CompactionScore():
+  // score-descending (i.e. identity) unless measured per-level compaction
+  // costs are available, in which case the levels with score >= 1 are
+  // reordered by compaction debt reduction per unit of measured work. L0
+  // always stays first among them because its file count gates write
+  // stalls.
+  std::vector<int> CostAdjustedCandidateOrder() const;
+
   // If the initial files are from L0 level, pick other L0
   // files if needed.
   bool SetupOtherL0FilesIfNeeded();
@@ -199,13 +210,68 @@ void LevelCompactionBuilder::PickFileToCompact(
   start_level_inputs_.files.clear();
 }
 
+std::vector<int> LevelCompactionBuilder::CostAdjustedCandidateOrder() const {
+  const int num = compaction_picker_->NumberLevels() - 1;
+  std::vector<int> order(num);
+  std::iota(order.begin(), order.end(), 0);
+  // Scores are sorted in descending order, so the levels eligible for
+  // compaction form a prefix. With fewer than two there is nothing to
+  // reorder.
+  int num_eligible = 0;
+  while (num_eligible < num && vstorage_->CompactionScore(num_eligible) >= 1) {
+    assert(num_eligible == 0 ||
+           vstorage_->CompactionScore(num_eligible) <=
+               vstorage_->CompactionScore(num_eligible - 1));
+    num_eligible++;
+  }
+  if (num_eligible < 2) {
+    return order;
+  }
+  // Costs are tracked per output level; normalize against the mean so that
+  // levels without measurements (cost 0) are treated as average rather than
+  // free.
+  double cost_sum = 0;
+  int cost_cnt = 0;
+  auto output_level_cost = [&](int idx) {
+    int level = vstorage_->CompactionScoreLevel(idx);
+    return vstorage_->CompactionCostPerByte(
+        level == 0 ? vstorage_->base_level() : level + 1);
+  };
+  for (int i = 0; i < num_eligible; i++) {
+    double cost = output_level_cost(i);
+    if (cost > 0) {
+      cost_sum += cost;
+      cost_cnt++;
+    }
+  }
+  if (cost_cnt == 0) {
+    return order;
+  }
+  const double cost_mean = cost_sum / cost_cnt;
+  auto cost_adjusted_score = [&](int idx) {
+    if (vstorage_->CompactionScoreLevel(idx) == 0) {
+      // Reducing the L0 file count gates write stalls; never let measured
+      // cost demote it.
+      return std::numeric_limits<double>::infinity();
+    }
+    double cost = output_level_cost(idx);
+    double relative_cost = cost > 0 ? cost / cost_mean : 1.0;
+    return (vstorage_->CompactionScore(idx) - 1.0) / relative_cost;
+  };
+  std::stable_sort(order.begin(), order.begin() + num_eligible,
+                   [&](int a, int b) {
+                     return cost_adjusted_score(a) > cost_adjusted_score(b);
+                   });
+  return order;
+}
+
 void LevelCompactionBuilder::SetupInitialFiles() {
-  // Find the compactions by size on all levels.
+  // Find the compactions by size on all levels, in cost-adjusted order of
+  // urgency.
   bool skipped_l0_to_base = false;
-  for (int i = 0; i < compaction_picker_->NumberLevels() - 1; i++) {
+  for (int i : CostAdjustedCandidateOrder()) {
     start_level_score_ = vstorage_->CompactionScore(i);
     start_level_ = vstorage_->CompactionScoreLevel(i);
-    assert(i == 0 || start_level_score_ <= vstorage_->CompactionScore(i - 1));
     if (start_level_score_ >= 1) {
       if (skipped_l0_to_base && start_level_ == vstorage_->base_level()) {
         // If L0->base_level compaction is pending, don't schedule further
@@ -355,6 +355,42 @@ TEST_F(CompactionPickerTest, LevelMaxScore) {
             compaction->OutputFilePreallocationSize());
 }
 
+TEST_F(CompactionPickerTest, LevelMaxScoreCostAdjusted) {
+  // Same layout as LevelMaxScore, but with measured per-level compaction
+  // costs that make L2->L3 compaction much more expensive per byte than
+  // L1->L2. The picker should then prefer the L1 candidate even though L2
+  // has the higher score.
+  NewVersionStorage(6, kCompactionStyleLevel);
+  mutable_cf_options_.target_file_size_base = 10000000;
+  mutable_cf_options_.max_bytes_for_level_base = 10 * 1024 * 1024;
+  mutable_cf_options_.RefreshDerivedOptions(ioptions_);
+  Add(0, 1U, "150", "200", 1000000U);
+  // Level 1 score 1.2
+  Add(1, 66U, "150", "200", 6000000U);
+  Add(1, 88U, "201", "300", 6000000U);
+  // Level 2 score 1.8
+  Add(2, 6U, "150", "179", 60000000U);
+  Add(2, 7U, "180", "220", 60000001U);
+  Add(2, 8U, "221", "300", 60000000U);
+  // Level 3 score slightly larger than 1
+  Add(3, 26U, "150", "170", 260000000U);
+  Add(3, 27U, "171", "179", 260000000U);
+  Add(3, 28U, "191", "220", 260000000U);
+  Add(3, 29U, "221", "300", 260000000U);
+  UpdateVersionStorageInfo();
+
+  // Costs are indexed by compaction output level.
+  vstorage_->SetCompactionCostPerByte({0.0, 0.0, 1.0, 20.0, 1.0, 0.0});
+
+  std::unique_ptr<Compaction> compaction(level_compaction_picker.PickCompaction(
+      cf_name_, mutable_cf_options_, mutable_db_options_,
+      /*existing_snapshots=*/{}, /* snapshot_checker */ nullptr,
+      vstorage_.get(), &log_buffer_));
+  ASSERT_TRUE(compaction.get() != nullptr);
+  ASSERT_EQ(1, compaction->start_level());
+  ASSERT_EQ(2, compaction->output_level());
+}
+
 TEST_F(CompactionPickerTest, NeedsCompactionLevel) {
   const int kLevels = 6;
   const int kFileCount = 20;
@@ -2212,6 +2248,31 @@ TEST_F(CompactionPickerTest, FileTtlBooster) {
   }
 }
 
+TEST_F(CompactionPickerTest, FileOverwriteDensityBooster) {
+  FileOverwriteDensityBooster booster;
+  FileMetaData meta;
+
+  // No stats (e.g. file written before the property existed): no boost.
+  ASSERT_EQ(1, booster.GetBoostScore(&meta));
+
+  // No overwritten versions: no boost.
+  meta.num_entries = 1000;
+  meta.num_key_overwrites = 0;
+  ASSERT_EQ(1, booster.GetBoostScore(&meta));
+
+  // Half of the entries are dead versions.
+  meta.num_key_overwrites = 500;
+  ASSERT_EQ(8, booster.GetBoostScore(&meta));
+
+  // Entirely dead versions: maximum boost.
+  meta.num_key_overwrites = 1000;
+  ASSERT_EQ(16, booster.GetBoostScore(&meta));
+
+  // Inconsistent stats are clamped rather than overflowing the boost.
+  meta.num_key_overwrites = 2000;
+  ASSERT_EQ(16, booster.GetBoostScore(&meta));
+}
+
 TEST_F(CompactionPickerTest, NotScheduleL1IfL0WithHigherPri1) {
   NewVersionStorage(6, kCompactionStyleLevel);
   mutable_cf_options_.level0_file_num_compaction_trigger = 2;
@@ -216,17 +216,18 @@ CompactionJob::ProcessKeyValueCompactionWithCompactionService(
     }
 
     FileMetaData meta;
-    uint64_t file_size;
-    // FIXME: file_size should be part of CompactionServiceOutputFile so that
-    // we don't get DB corruption if the full file size has not been propagated
-    // back to the caller through the file system (which could have metadata
-    // lag or caching bugs).
-    s = fs_->GetFileSize(tgt_file, IOOptions(), &file_size, nullptr);
-    if (!s.ok()) {
-      sub_compact->status = s;
-      db_options_.compaction_service->OnInstallation(
-          response.scheduled_job_id, CompactionServiceJobStatus::kFailure);
-      return CompactionServiceJobStatus::kFailure;
+    uint64_t file_size = file.file_size;
+    if (file_size == 0) {
+      // The result came from a worker that predates the file_size field.
+      // Fall back to asking the file system, which may have metadata lag
+      // on shared storage.
+      s = fs_->GetFileSize(tgt_file, IOOptions(), &file_size, nullptr);
+      if (!s.ok()) {
+        sub_compact->status = s;
+        db_options_.compaction_service->OnInstallation(
+            response.scheduled_job_id, CompactionServiceJobStatus::kFailure);
+        return CompactionServiceJobStatus::kFailure;
+      }
     }
     meta.fd = FileDescriptor(file_num, compaction->output_path_id(), file_size,
                              file.smallest_seqno, file.largest_seqno);
@@ -416,8 +417,9 @@ Status CompactionServiceCompactionJob::Run() {
     for (const auto& output_file : sub_compact->GetOutputs()) {
       auto& meta = output_file.meta;
       compaction_result_->output_files.emplace_back(
-          MakeTableFileName(meta.fd.GetNumber()), meta.fd.smallest_seqno,
-          meta.fd.largest_seqno, meta.smallest.Encode().ToString(),
+          MakeTableFileName(meta.fd.GetNumber()), meta.fd.GetFileSize(),
+          meta.fd.smallest_seqno, meta.fd.largest_seqno,
+          meta.smallest.Encode().ToString(),
           meta.largest.Encode().ToString(), meta.oldest_ancester_time,
           meta.file_creation_time, meta.epoch_number, meta.file_checksum,
           meta.file_checksum_func_name, output_file.validator.GetHash(),
@@ -523,6 +525,10 @@ static std::unordered_map<std::string, OptionTypeInfo>
          {offsetof(struct CompactionServiceOutputFile, file_name),
           OptionType::kEncodedString, OptionVerificationType::kNormal,
           OptionTypeFlags::kNone}},
+        {"file_size",
+         {offsetof(struct CompactionServiceOutputFile, file_size),
+          OptionType::kUInt64T, OptionVerificationType::kNormal,
+          OptionTypeFlags::kNone}},
         {"smallest_seqno",
          {offsetof(struct CompactionServiceOutputFile, smallest_seqno),
           OptionType::kUInt64T, OptionVerificationType::kNormal,
@@ -348,6 +348,58 @@ TEST_P(DBBloomFilterTestWithPartitioningParam, GetFilterByPrefixBloom) {
   get_perf_context()->Reset();
 }
 
+TEST_F(DBBloomFilterTest, TopLevelPrefixBloomWithPartitionedFilters) {
+  Options options = CurrentOptions();
+  options.prefix_extractor.reset(NewFixedPrefixTransform(4));
+  options.statistics = ROCKSDB_NAMESPACE::CreateDBStatistics();
+  BlockBasedTableOptions bbto;
+  bbto.filter_policy.reset(NewBloomFilterPolicy(10));
+  bbto.whole_key_filtering = false;
+  bbto.partition_filters = true;
+  bbto.index_type = BlockBasedTableOptions::kTwoLevelIndexSearch;
+  bbto.metadata_block_size = 32;  // Force several filter partitions
+  bbto.partition_filter_top_level_prefix_bloom = true;
+  bbto.cache_index_and_filter_blocks = true;
+  options.table_factory.reset(NewBlockBasedTableFactory(bbto));
+  DestroyAndReopen(options);
+
+  for (int i = 100; i < 200; ++i) {
+    // Distinct 4-byte prefix per key
+    std::string key = "k" + std::to_string(i) + "_suffix";
+    ASSERT_OK(Put(key, "val" + std::to_string(i)));
+  }
+  ASSERT_OK(Flush());
+
+  // Filter partitions go through the block cache; the whole-file prefix
+  // bloom does not. Measure partition (and filter partition index) cache
+  // activity around seeks.
+  auto pop_filter_cache_activity = [&]() {
+    return PopTicker(options, BLOCK_CACHE_FILTER_MISS) +
+           PopTicker(options, BLOCK_CACHE_FILTER_HIT);
+  };
+  pop_filter_cache_activity();
+  PopTicker(options, NON_LAST_LEVEL_SEEK_FILTERED);
+
+  ReadOptions ro;
+  ro.prefix_same_as_start = true;
+  std::unique_ptr<Iterator> iter(db_->NewIterator(ro));
+
+  // Present prefix: consults a filter partition and finds the key
+  iter->Seek("k150");
+  ASSERT_OK(iter->status());
+  ASSERT_TRUE(iter->Valid());
+  ASSERT_EQ("k150_suffix", iter->key().ToString());
+  EXPECT_GT(pop_filter_cache_activity(), 0);
+
+  // Absent prefix: resolved by the top-level prefix bloom without touching
+  // any filter block in the block cache
+  iter->Seek("k950");
+  ASSERT_OK(iter->status());
+  ASSERT_FALSE(iter->Valid());
+  EXPECT_EQ(PopTicker(options, NON_LAST_LEVEL_SEEK_FILTERED), 1);
+  EXPECT_EQ(pop_filter_cache_activity(), 0);
+}
+
 TEST_P(DBBloomFilterTestWithPartitioningParam, FilterNumEntriesCoalesce) {
   for (bool prefix : {true, false}) {
     SCOPED_TRACE("prefix=" + std::to_string(prefix));
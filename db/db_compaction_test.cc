@@ -6140,6 +6140,61 @@ TEST_F(DBCompactionTest, CompactionHasEmptyOutput) {
   ASSERT_EQ(2, collector->num_ssts_creation_started());
 }
 
+TEST_F(DBCompactionTest, FairCompactionLimiter) {
+  std::unique_ptr<ConcurrentTaskLimiter> limiter(NewFairConcurrentTaskLimiter(
+      "fair_limiter", 4 /* limit */, 1 /* min_tasks_per_instance */));
+  auto* impl = static_cast<ConcurrentTaskLimiterImpl*>(limiter.get());
+
+  int client1 = 0;
+  int client2 = 0;
+
+  // A lone client may use the whole budget
+  std::vector<std::unique_ptr<TaskLimiterToken>> tokens1;
+  for (int i = 0; i < 4; i++) {
+    auto token = impl->GetToken(false /* force */, &client1);
+    ASSERT_NE(token, nullptr);
+    tokens1.emplace_back(std::move(token));
+  }
+  ASSERT_EQ(impl->GetToken(false /* force */, &client1), nullptr);
+  ASSERT_EQ(impl->GetOutstandingTask(), 4);
+
+  // Forced requests bypass the throttle
+  {
+    auto forced = impl->GetToken(true /* force */, &client2);
+    ASSERT_NE(forced, nullptr);
+    ASSERT_EQ(impl->GetOutstandingTask(), 5);
+  }
+
+  // Once a second client holds tasks, the first one is capped at its fair
+  // share (limit / active clients = 2) even while the global limit still
+  // has room
+  tokens1.pop_back();
+  tokens1.pop_back();
+  ASSERT_EQ(impl->GetOutstandingTask(), 2);
+
+  auto token2 = impl->GetToken(false /* force */, &client2);
+  ASSERT_NE(token2, nullptr);
+
+  ASSERT_EQ(impl->GetToken(false /* force */, &client1), nullptr);
+  ASSERT_EQ(impl->GetOutstandingTask(), 3);
+
+  // The second client may still grow to its fair share
+  auto token2b = impl->GetToken(false /* force */, &client2);
+  ASSERT_NE(token2b, nullptr);
+  ASSERT_EQ(impl->GetToken(false /* force */, &client2), nullptr);
+  ASSERT_EQ(impl->GetOutstandingTask(), 4);
+
+  // When the second client goes idle, its share is redistributed
+  token2.reset();
+  token2b.reset();
+  auto token1 = impl->GetToken(false /* force */, &client1);
+  ASSERT_NE(token1, nullptr);
+
+  token1.reset();
+  tokens1.clear();
+  ASSERT_EQ(impl->GetOutstandingTask(), 0);
+}
+
 TEST_F(DBCompactionTest, CompactionLimiter) {
   const int kNumKeysPerFile = 10;
   const int kMaxBackgroundThreads = 64;
@@ -10665,6 +10720,51 @@ TEST_F(DBCompactionTest, VerifyOutputRecordCountPlainTable) {
   ASSERT_TRUE(std::strstr(s.getState(), expect));
 }
 
+TEST_F(DBCompactionTest, CompactionReadaheadCacheLookup) {
+  // With compaction_readahead_cache_lookup, compaction input readers probe
+  // the block cache when sizing readahead and serve cache-resident input
+  // blocks from the cache instead of re-reading them from storage.
+  Options options = CurrentOptions();
+  options.compression = kNoCompression;
+  options.disable_auto_compactions = true;
+  options.compaction_readahead_cache_lookup = true;
+  options.compaction_readahead_size = 16 << 10;
+  options.statistics = CreateDBStatistics();
+  BlockBasedTableOptions table_options;
+  table_options.block_size = 1024;
+  table_options.block_cache = NewLRUCache(32 << 20);
+  options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+  DestroyAndReopen(options);
+
+  Random rnd(301);
+  std::map<std::string, std::string> expected;
+  for (int f = 0; f < 2; ++f) {
+    for (int i = 0; i < 200; ++i) {
+      std::string key = Key(i * 2 + f);
+      std::string value = rnd.RandomString(200);
+      expected[key] = value;
+      ASSERT_OK(Put(key, value));
+    }
+    ASSERT_OK(Flush());
+  }
+  ASSERT_EQ(2, NumTableFilesAtLevel(0));
+
+  // Warm the cache with the compaction inputs.
+  for (const auto& kv : expected) {
+    ASSERT_EQ(kv.second, Get(kv.first));
+  }
+
+  uint64_t hits_before = TestGetTickerCount(options, BLOCK_CACHE_DATA_HIT);
+  ASSERT_OK(db_->CompactRange(CompactRangeOptions(), nullptr, nullptr));
+  ASSERT_EQ(0, NumTableFilesAtLevel(0));
+  // The warm input blocks were served from the block cache.
+  ASSERT_GT(TestGetTickerCount(options, BLOCK_CACHE_DATA_HIT), hits_before);
+
+  for (const auto& kv : expected) {
+    ASSERT_EQ(kv.second, Get(kv.first));
+  }
+}
+
 TEST_F(DBCompactionTest, ErrorWhenReadFileHead) {
   // This is to test a bug that is fixed in
   // https://github.com/facebook/rocksdb/pull/11782.
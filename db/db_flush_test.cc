@@ -1059,6 +1059,38 @@ TEST_F(DBFlushTest, MemPurgeBasic) {
 }
 
 // RocksDB lite does not support dynamic options
+TEST_F(DBFlushTest, MemPurgeLearnedGarbageRatio) {
+  Options options = CurrentOptions();
+  options.compression = kNoCompression;
+  options.write_buffer_size = 1 << 20;
+  options.experimental_mempurge_threshold = 0.0;
+  ASSERT_OK(TryReopen(options));
+
+  auto* cfd = static_cast_with_check<ColumnFamilyHandleImpl>(
+                  db_->DefaultColumnFamily())
+                  ->cfd();
+  // No flush has been observed yet
+  ASSERT_LT(cfd->GetMemtableGarbageRatio(), 0.0);
+
+  Random rnd(403);
+  // Overwrite-heavy memtable: most of the payload is garbage at flush time
+  for (int i = 0; i < 500; i++) {
+    ASSERT_OK(Put("overwritten_key" + std::to_string(i % 10),
+                  rnd.RandomString(1024)));
+  }
+  ASSERT_OK(Flush());
+  const double ratio_after_overwrites = cfd->GetMemtableGarbageRatio();
+  ASSERT_GT(ratio_after_overwrites, 0.5);
+  ASSERT_LE(ratio_after_overwrites, 1.0);
+
+  // Unique-key memtable: almost no garbage, so the estimate must move down
+  for (int i = 0; i < 100; i++) {
+    ASSERT_OK(Put("unique_key" + std::to_string(i), rnd.RandomString(1024)));
+  }
+  ASSERT_OK(Flush());
+  ASSERT_LT(cfd->GetMemtableGarbageRatio(), ratio_after_overwrites);
+}
+
 TEST_F(DBFlushTest, MemPurgeBasicToggle) {
   Options options = CurrentOptions();
 
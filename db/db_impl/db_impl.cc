@@ -68,7 +68,9 @@
 #include "monitoring/instrumented_mutex.h"
 #include "monitoring/iostats_context_imp.h"
 #include "monitoring/perf_context_imp.h"
+#include "monitoring/query_timeline_imp.h"
 #include "monitoring/persistent_stats_history.h"
+#include "monitoring/stats_snapshot_ring.h"
 #include "monitoring/thread_status_updater.h"
 #include "monitoring/thread_status_util.h"
 #include "options/cf_options.h"
@@ -541,6 +543,8 @@ Status DBImpl::CloseHelper() {
   // Wait for background work to finish
   while (bg_bottom_compaction_scheduled_ || bg_compaction_scheduled_ ||
          bg_flush_scheduled_ || bg_purge_scheduled_ ||
+         bg_wal_prepare_scheduled_ ||
+         bg_wal_sync_scheduled_.load(std::memory_order_acquire) ||
          pending_purge_obsolete_files_ ||
          error_handler_.IsRecoveryInProgress()) {
     TEST_SYNC_POINT("DBImpl::~DBImpl:WaitJob");
@@ -860,6 +864,40 @@ Status DBImpl::RegisterRecordSeqnoTimeWorker() {
   return s;
 }
 
+Status DBImpl::EnableStatsSnapshotRing(const std::string& file_path,
+                                       uint32_t num_slots,
+                                       uint64_t period_ms) {
+  if (immutable_db_options_.statistics == nullptr) {
+    return Status::InvalidArgument(
+        "EnableStatsSnapshotRing requires statistics to be enabled");
+  }
+  if (period_ms == 0) {
+    return Status::InvalidArgument("period_ms must be positive");
+  }
+  std::shared_ptr<StatsSnapshotRing> ring;
+  Status s = StatsSnapshotRing::Open(file_path, num_slots, &ring);
+  if (!s.ok()) {
+    return s;
+  }
+  Statistics* statistics = immutable_db_options_.statistics.get();
+  SystemClock* clock = immutable_db_options_.clock;
+  s = periodic_task_scheduler_.RegisterMicros(
+      PeriodicTaskType::kPublishStats,
+      [ring, statistics, clock]() { ring->Publish(statistics, clock); },
+      period_ms * 1000);
+  if (s.ok()) {
+    stats_snapshot_ring_ = ring;
+  }
+  return s;
+}
+
+Status DBImpl::DisableStatsSnapshotRing() {
+  Status s =
+      periodic_task_scheduler_.Unregister(PeriodicTaskType::kPublishStats);
+  stats_snapshot_ring_.reset();
+  return s;
+}
+
 Status DBImpl::CancelPeriodicTaskScheduler() {
   Status s = Status::OK();
   for (uint8_t task_type = 0;
@@ -1537,6 +1575,80 @@ Status DBImpl::SyncWAL() {
   return s;
 }
 
+Status DBImpl::SyncWALAsync(std::function<void(Status)> callback) {
+  if (!callback) {
+    return Status::InvalidArgument("callback must not be empty");
+  }
+  if (shutdown_initiated_) {
+    return Status::ShutdownInProgress();
+  }
+  bool schedule = false;
+  {
+    InstrumentedMutexLock l(&wal_sync_async_mutex_);
+    wal_sync_async_queue_.push_back(std::move(callback));
+    if (!bg_wal_sync_scheduled_.load(std::memory_order_relaxed)) {
+      bg_wal_sync_scheduled_.store(true, std::memory_order_release);
+      schedule = true;
+    }
+    // Else the scheduled job picks this callback up; the sync it performs
+    // starts after this call, so it covers all prior completed writes.
+  }
+  if (schedule) {
+    env_->Schedule(&DBImpl::BGWorkSyncWAL, this, Env::Priority::HIGH, this,
+                   &DBImpl::UnscheduleWalSyncCallback);
+  }
+  return Status::OK();
+}
+
+void DBImpl::BGWorkSyncWAL(void* db) {
+  IOSTATS_SET_THREAD_POOL_ID(Env::Priority::HIGH);
+  TEST_SYNC_POINT("DBImpl::BGWorkSyncWAL");
+  static_cast<DBImpl*>(db)->BackgroundCallSyncWAL();
+}
+
+void DBImpl::BackgroundCallSyncWAL() {
+  std::deque<std::function<void(Status)>> callbacks;
+  while (true) {
+    {
+      InstrumentedMutexLock l(&wal_sync_async_mutex_);
+      if (wal_sync_async_queue_.empty()) {
+        bg_wal_sync_scheduled_.store(false, std::memory_order_release);
+        break;
+      }
+      std::swap(callbacks, wal_sync_async_queue_);
+    }
+    // One sync satisfies every callback drained above: they were all
+    // enqueued before it started, so their writes are covered. Invoking
+    // them in queue order preserves call order across batches too, since
+    // batches are drained FIFO by a single job.
+    Status s = SyncWAL();
+    for (auto& callback : callbacks) {
+      callback(s);
+    }
+    callbacks.clear();
+  }
+  // Wake up CloseHelper() if it is waiting for this job to finish.
+  InstrumentedMutexLock l(&mutex_);
+  bg_cv_.SignalAll();
+}
+
+void DBImpl::UnscheduleWalSyncCallback(void* arg) {
+  // The job was dropped from the thread pool queue before running, which
+  // happens during Close() with mutex_ held; fail the pending callbacks
+  // rather than leave them waiting forever.
+  auto* db = static_cast<DBImpl*>(arg);
+  std::deque<std::function<void(Status)>> callbacks;
+  {
+    InstrumentedMutexLock l(&db->wal_sync_async_mutex_);
+    std::swap(callbacks, db->wal_sync_async_queue_);
+    db->bg_wal_sync_scheduled_.store(false, std::memory_order_release);
+  }
+  for (auto& callback : callbacks) {
+    callback(Status::ShutdownInProgress());
+  }
+  TEST_SYNC_POINT("DBImpl::UnscheduleWalSyncCallback");
+}
+
 IOStatus DBImpl::SyncWalImpl(bool include_current_wal,
                              const WriteOptions& write_options,
                              JobContext* job_context, VersionEdit* synced_wals,
@@ -1937,6 +2049,56 @@ void DBImpl::BackgroundCallPurge() {
   mutex_.Unlock();
 }
 
+void DBImpl::MaybeSchedulePrepareWAL() {
+  mutex_.AssertHeld();
+  if (immutable_db_options_.prepare_log_file_num == 0 ||
+      bg_wal_prepare_scheduled_ > 0 ||
+      shutting_down_.load(std::memory_order_acquire) ||
+      prepared_wal_files_.size() + wal_recycle_files_.size() >=
+          immutable_db_options_.prepare_log_file_num) {
+    return;
+  }
+  // WAL preparation is put into the High priority queue, like purges
+  bg_wal_prepare_scheduled_++;
+  env_->Schedule(&DBImpl::BGWorkPrepareWAL, this, Env::Priority::HIGH,
+                 nullptr);
+}
+
+void DBImpl::BackgroundCallPrepareWAL() {
+  mutex_.Lock();
+
+  assert(bg_wal_prepare_scheduled_ > 0);
+
+  // Recycled WAL files serve the same purpose as prepared ones, so count
+  // them toward the target to avoid creating files that will never be used.
+  while (!shutting_down_.load(std::memory_order_acquire) &&
+         prepared_wal_files_.size() + wal_recycle_files_.size() <
+             immutable_db_options_.prepare_log_file_num) {
+    const uint64_t log_number = versions_->NewFileNumber();
+    const size_t preallocate_block_size = GetWalPreallocateBlockSize(
+        default_cf_handle_->cfd()->GetLatestMutableCFOptions()
+            .write_buffer_size);
+    mutex_.Unlock();
+    IOStatus io_s = PrepareWALFile(log_number, preallocate_block_size);
+    mutex_.Lock();
+    if (!io_s.ok()) {
+      // Fail soft: the next WAL switch falls back to creating the file on
+      // the write path, as if the pool were disabled.
+      ROCKS_LOG_WARN(immutable_db_options_.info_log,
+                     "Failed to prepare WAL file %" PRIu64 ": %s", log_number,
+                     io_s.ToString().c_str());
+      break;
+    }
+    prepared_wal_files_.push_back(log_number);
+  }
+
+  bg_wal_prepare_scheduled_--;
+
+  bg_cv_.SignalAll();
+  // IMPORTANT: see the comment at the end of BackgroundCallPurge.
+  mutex_.Unlock();
+}
+
 namespace {
 
 // A `SuperVersionHandle` holds a non-null `SuperVersion*` pointing at a
@@ -2019,6 +2181,10 @@ InternalIterator* DBImpl::NewInternalIterator(
       // here, and no unit test cares about the value provided here.
       !read_options.total_order_seek && prefix_extractor != nullptr,
       read_options.iterate_upper_bound);
+  if (read_options.deadline.count()) {
+    merge_iter_builder.SetDeadline(immutable_db_options_.clock,
+                                   read_options.deadline);
+  }
   // Collect iterator for mutable memtable
   auto mem_iter = super_version->mem->NewIterator(
       read_options, super_version->GetSeqnoToTimeMapping(), arena,
@@ -2276,6 +2442,7 @@ Status DBImpl::GetImpl(const ReadOptions& read_options, const Slice& key,
 
   GetWithTimestampReadCallback read_cb(0);  // Will call Refresh
 
+  QueryTimelineGuard timeline_guard(read_options.trace_timeline);
   PERF_CPU_TIMER_GUARD(get_cpu_nanos, immutable_db_options_.clock);
   StopWatch sw(immutable_db_options_.clock, stats_, DB_GET);
   PERF_TIMER_GUARD(get_snapshot_time);
@@ -2294,7 +2461,8 @@ Status DBImpl::GetImpl(const ReadOptions& read_options, const Slice& key,
     }
   }
 
-  if (get_impl_options.get_merge_operands_options != nullptr) {
+  if (get_impl_options.get_merge_operands_options != nullptr &&
+      get_impl_options.merge_operands != nullptr) {
     for (int i = 0; i < get_impl_options.get_merge_operands_options
                             ->expected_max_number_of_operands;
          ++i) {
@@ -2444,6 +2612,7 @@ Status DBImpl::GetImpl(const ReadOptions& read_options, const Slice& key,
       return s;
     }
   }
+  QUERY_TIMELINE_MARK(kMemtableLookup);
   TEST_SYNC_POINT("DBImpl::GetImpl:PostMemTableGet:0");
   TEST_SYNC_POINT("DBImpl::GetImpl:PostMemTableGet:1");
   PinnedIteratorsManager pinned_iters_mgr;
@@ -2485,9 +2654,18 @@ Status DBImpl::GetImpl(const ReadOptions& read_options, const Slice& key,
             static_cast<int>(merge_context.GetNumOperands());
         // OK status is returned, some merge operand is found.
         assert(*get_impl_options.number_of_operands > 0);
-        if (*get_impl_options.number_of_operands >
-            get_impl_options.get_merge_operands_options
-                ->expected_max_number_of_operands) {
+        if (get_impl_options.merge_operands == nullptr) {
+          // Streaming mode: each operand has already been handed to
+          // GetMergeOperandsOptions::continue_cb as it was encountered, so
+          // there is nothing to materialize and no capacity to check.
+          assert(get_impl_options.get_merge_operands_options->continue_cb !=
+                 nullptr);
+          for (const Slice& sl : merge_context.GetOperands()) {
+            size += sl.size();
+          }
+        } else if (*get_impl_options.number_of_operands >
+                   get_impl_options.get_merge_operands_options
+                       ->expected_max_number_of_operands) {
           s = Status::Incomplete(
               Status::SubCode::KMergeOperandsInsufficientCapacity);
         } else {
@@ -4048,10 +4226,12 @@ Status DBImpl::NewIterators(
   return Status::OK();
 }
 
-const Snapshot* DBImpl::GetSnapshot() { return GetSnapshotImpl(false); }
+const Snapshot* DBImpl::GetSnapshot() {
+  return GetSnapshotImpl(false, /*lock=*/true, /*allow_reuse=*/true);
+}
 
 const Snapshot* DBImpl::GetSnapshotForWriteConflictBoundary() {
-  return GetSnapshotImpl(true);
+  return GetSnapshotImpl(true, /*lock=*/true, /*allow_reuse=*/true);
 }
 
 std::pair<Status, std::shared_ptr<const Snapshot>>
@@ -4097,7 +4277,7 @@ Status DBImpl::GetTimestampedSnapshots(
 }
 
 SnapshotImpl* DBImpl::GetSnapshotImpl(bool is_write_conflict_boundary,
-                                      bool lock) {
+                                      bool lock, bool allow_reuse) {
   int64_t unix_time = 0;
   immutable_db_options_.clock->GetCurrentTime(&unix_time)
       .PermitUncheckedError();  // Ignore error
@@ -4117,11 +4297,26 @@ SnapshotImpl* DBImpl::GetSnapshotImpl(bool is_write_conflict_boundary,
     return nullptr;
   }
   auto snapshot_seq = GetLastPublishedSequence();
-  SnapshotImpl* snapshot =
-      snapshots_.New(s, snapshot_seq, unix_time, is_write_conflict_boundary);
+  SnapshotImpl* snapshot = nullptr;
+  if (allow_reuse) {
+    // If no write has been published since the newest snapshot was taken, a
+    // new snapshot would be indistinguishable from it, so hand out the same
+    // object again. This keeps snapshot-heavy workloads from growing the
+    // list (and the GetAll() cost paid by flushes and compactions) and lets
+    // the matching ReleaseSnapshot() calls skip the oldest-snapshot
+    // recomputation.
+    snapshot = snapshots_.RefNewestIfSame(snapshot_seq,
+                                          is_write_conflict_boundary);
+  }
+  if (snapshot == nullptr) {
+    snapshot =
+        snapshots_.New(s, snapshot_seq, unix_time, is_write_conflict_boundary);
+    s = nullptr;
+  }
   if (lock) {
     mutex_.Unlock();
   }
+  delete s;
   return snapshot;
 }
 
@@ -4256,7 +4451,12 @@ void DBImpl::ReleaseSnapshot(const Snapshot* s) {
   const SnapshotImpl* casted_s = static_cast<const SnapshotImpl*>(s);
   {
     InstrumentedMutexLock l(&mutex_);
-    snapshots_.Delete(casted_s);
+    if (!snapshots_.Unref(casted_s)) {
+      // Other GetSnapshot() callers still share this object, so the set of
+      // live snapshot sequence numbers is unchanged and the oldest snapshot
+      // cannot have advanced.
+      return;
+    }
     uint64_t oldest_snapshot;
     if (snapshots_.empty()) {
       oldest_snapshot = GetLastPublishedSequence();
@@ -5878,6 +6078,40 @@ Status DBImpl::IngestExternalFiles(
     return status;
   }
 
+  // Best-effort pre-flush of memtables that overlap the files being ingested,
+  // while writes are still running. NeedsFlush() is re-checked authoritatively
+  // below with writes stopped, but a flush triggered there blocks foreground
+  // writes for its entire duration. After this pass the stopped-write check
+  // only flushes again if a write raced into the overlapping range, so the
+  // common case keeps flush work out of the write-stop window. Errors are
+  // ignored here; the authoritative path will surface them.
+  {
+    bool atomic_flush_done = false;
+    for (size_t i = 0; i != num_cfs; ++i) {
+      bool need_flush = false;
+      auto* cfd = ingestion_jobs[i].GetColumnFamilyData();
+      SuperVersion* super_version = cfd->GetReferencedSuperVersion(this);
+      Status es = ingestion_jobs[i].NeedsFlush(&need_flush, super_version);
+      CleanupSuperVersion(super_version);
+      if (!es.ok() || !need_flush) {
+        es.PermitUncheckedError();
+        continue;
+      }
+      FlushOptions flush_opts;
+      flush_opts.allow_write_stall = true;
+      if (immutable_db_options_.atomic_flush) {
+        if (!atomic_flush_done) {
+          AtomicFlushMemTables(flush_opts, FlushReason::kExternalFileIngestion)
+              .PermitUncheckedError();
+          atomic_flush_done = true;
+        }
+      } else {
+        FlushMemTable(cfd, flush_opts, FlushReason::kExternalFileIngestion)
+            .PermitUncheckedError();
+      }
+    }
+  }
+
   std::vector<SuperVersionContext> sv_ctxs;
   for (size_t i = 0; i != num_cfs; ++i) {
     sv_ctxs.emplace_back(true /* create_superversion */);
@@ -6378,61 +6612,131 @@ Status DBImpl::VerifyChecksumInternal(const ReadOptions& read_options,
     sv_list.push_back(cfd->GetReferencedSuperVersion(this));
   }
 
+  // Collect all the files to verify up front so verification can be spread
+  // over max_file_verification_threads threads, each taking the next
+  // unverified file. Per-file verification is self-contained (it does not
+  // need the DB mutex), so file-level parallelism is safe.
+  struct FileVerificationWorkItem {
+    std::string fname;
+    // For full file checksum verification (use_file_checksum).
+    std::string checksum;
+    std::string func_name;
+    // For block-by-block verification.
+    const Options* opts = nullptr;
+    uint64_t largest_seqno = 0;
+  };
+  std::deque<Options> cf_opts_list;
+  std::vector<FileVerificationWorkItem> work;
   for (auto& sv : sv_list) {
     VersionStorageInfo* vstorage = sv->current->storage_info();
     ColumnFamilyData* cfd = sv->current->cfd();
-    Options opts;
+    const Options* opts = nullptr;
     if (!use_file_checksum) {
       InstrumentedMutexLock l(&mutex_);
-      opts = Options(BuildDBOptions(immutable_db_options_, mutable_db_options_),
-                     cfd->GetLatestCFOptions());
+      cf_opts_list.emplace_back(
+          BuildDBOptions(immutable_db_options_, mutable_db_options_),
+          cfd->GetLatestCFOptions());
+      opts = &cf_opts_list.back();
     }
-    for (int i = 0; i < vstorage->num_non_empty_levels() && s.ok(); i++) {
-      for (size_t j = 0; j < vstorage->LevelFilesBrief(i).num_files && s.ok();
-           j++) {
+    for (int i = 0; i < vstorage->num_non_empty_levels(); i++) {
+      for (size_t j = 0; j < vstorage->LevelFilesBrief(i).num_files; j++) {
         const auto& fd_with_krange = vstorage->LevelFilesBrief(i).files[j];
         const auto& fd = fd_with_krange.fd;
         const FileMetaData* fmeta = fd_with_krange.file_metadata;
         assert(fmeta);
-        std::string fname = TableFileName(cfd->ioptions().cf_paths,
-                                          fd.GetNumber(), fd.GetPathId());
+        work.emplace_back();
+        FileVerificationWorkItem& item = work.back();
+        item.fname = TableFileName(cfd->ioptions().cf_paths, fd.GetNumber(),
+                                   fd.GetPathId());
         if (use_file_checksum) {
-          s = VerifyFullFileChecksum(fmeta->file_checksum,
-                                     fmeta->file_checksum_func_name, fname,
-                                     read_options);
+          item.checksum = fmeta->file_checksum;
+          item.func_name = fmeta->file_checksum_func_name;
         } else {
-          s = ROCKSDB_NAMESPACE::VerifySstFileChecksumInternal(
-              opts, file_options_, read_options, fname, fd.largest_seqno);
+          item.opts = opts;
+          item.largest_seqno = fd.largest_seqno;
         }
-        RecordTick(stats_, VERIFY_CHECKSUM_READ_BYTES,
-                   IOSTATS(bytes_read) - prev_bytes_read);
-        prev_bytes_read = IOSTATS(bytes_read);
       }
     }
 
-    if (s.ok() && use_file_checksum) {
+    if (use_file_checksum) {
       const auto& blob_files = vstorage->GetBlobFiles();
       for (const auto& meta : blob_files) {
         assert(meta);
 
         const uint64_t blob_file_number = meta->GetBlobFileNumber();
 
-        const std::string blob_file_name = BlobFileName(
-            cfd->ioptions().cf_paths.front().path, blob_file_number);
-        s = VerifyFullFileChecksum(meta->GetChecksumValue(),
-                                   meta->GetChecksumMethod(), blob_file_name,
-                                   read_options);
-        RecordTick(stats_, VERIFY_CHECKSUM_READ_BYTES,
-                   IOSTATS(bytes_read) - prev_bytes_read);
-        prev_bytes_read = IOSTATS(bytes_read);
-        if (!s.ok()) {
-          break;
+        work.emplace_back();
+        FileVerificationWorkItem& item = work.back();
+        item.fname = BlobFileName(cfd->ioptions().cf_paths.front().path,
+                                  blob_file_number);
+        item.checksum = meta->GetChecksumValue();
+        item.func_name = meta->GetChecksumMethod();
+      }
+    }
+  }
+
+  std::atomic<size_t> next_file{0};
+  std::atomic<bool> stop{false};
+  std::mutex result_mutex;
+  size_t first_failure = work.size();
+  auto verify_func = [&]() {
+    // IOSTATS is thread-local, so each worker accounts for its own reads.
+    uint64_t prev = IOSTATS(bytes_read);
+    while (!stop.load(std::memory_order_relaxed)) {
+      const size_t idx = next_file.fetch_add(1, std::memory_order_relaxed);
+      if (idx >= work.size()) {
+        break;
+      }
+      const FileVerificationWorkItem& item = work[idx];
+      Status item_status;
+      if (use_file_checksum) {
+        item_status = VerifyFullFileChecksum(item.checksum, item.func_name,
+                                             item.fname, read_options);
+      } else {
+        item_status = ROCKSDB_NAMESPACE::VerifySstFileChecksumInternal(
+            *item.opts, file_options_, read_options, item.fname,
+            item.largest_seqno);
+      }
+      RecordTick(stats_, VERIFY_CHECKSUM_READ_BYTES,
+                 IOSTATS(bytes_read) - prev);
+      prev = IOSTATS(bytes_read);
+      if (!item_status.ok()) {
+        std::lock_guard<std::mutex> guard(result_mutex);
+        // Report the earliest failure in file order for deterministic
+        // results regardless of thread interleaving.
+        if (idx < first_failure) {
+          first_failure = idx;
+          s = item_status;
         }
+        stop.store(true, std::memory_order_relaxed);
       }
     }
-    if (!s.ok()) {
-      break;
+  };
+  const size_t num_threads = std::min(
+      work.size(),
+      static_cast<size_t>(
+          std::max(1, immutable_db_options_.max_file_verification_threads)));
+  std::vector<port::Thread> verify_threads;
+  for (size_t t = 1; t < num_threads; t++) {
+    verify_threads.emplace_back(verify_func);
+  }
+  verify_func();
+  for (auto& t : verify_threads) {
+    t.join();
+  }
+  // This thread's verification reads were already recorded per file above.
+  prev_bytes_read = IOSTATS(bytes_read);
+
+  if (!s.ok() && first_failure < work.size() &&
+      !immutable_db_options_.listeners.empty()) {
+    ChecksumVerificationFailureInfo info;
+    info.db_name = dbname_;
+    info.file_path = work[first_failure].fname;
+    info.status = s;
+    for (const auto& listener : immutable_db_options_.listeners) {
+      listener->OnChecksumVerificationFailure(info);
     }
+    info.status.PermitUncheckedError();
   }
 
   bool defer_purge = immutable_db_options().avoid_unnecessary_blocking_io;
@@ -77,6 +77,7 @@ class ArenaWrappedDBIter;
 class InMemoryStatsHistoryIterator;
 class MemTable;
 class PersistentStatsHistoryIterator;
+class StatsSnapshotRing;
 class TableCache;
 class TaskLimiterToken;
 class Version;
@@ -274,6 +275,13 @@ class DBImpl : public DB {
                           PinnableSlice* merge_operands,
                           GetMergeOperandsOptions* get_merge_operands_options,
                           int* number_of_operands) override {
+    if (merge_operands == nullptr &&
+        (get_merge_operands_options == nullptr ||
+         get_merge_operands_options->continue_cb == nullptr)) {
+      return Status::InvalidArgument(
+          "Either a merge_operands array or a "
+          "GetMergeOperandsOptions::continue_cb must be provided");
+    }
     GetImplOptions get_impl_options;
     get_impl_options.column_family = column_family;
     get_impl_options.merge_operands = merge_operands;
@@ -487,6 +495,7 @@ class DBImpl : public DB {
   virtual Status FlushWAL(const WriteOptions& write_options, bool sync);
   bool WALBufferIsEmpty();
   Status SyncWAL() override;
+  Status SyncWALAsync(std::function<void(Status)> callback) override;
   Status LockWAL() override;
   Status UnlockWAL() override;
 
@@ -525,6 +534,21 @@ class DBImpl : public DB {
       uint64_t start_time, uint64_t end_time,
       std::unique_ptr<StatsHistoryIterator>* stats_iterator) override;
 
+  // EXPERIMENTAL
+  // Start publishing fixed-layout stats snapshots (tickers + histogram
+  // percentiles) every `period_ms` into a memory-mapped ring of `num_slots`
+  // slots at `file_path`, readable by external agents with seqlock
+  // consistency (see monitoring/stats_snapshot_ring.h for the reader
+  // protocol). Requires statistics to be enabled. Re-enabling with
+  // different arguments replaces the previous ring.
+  Status EnableStatsSnapshotRing(const std::string& file_path,
+                                 uint32_t num_slots, uint64_t period_ms);
+
+  // EXPERIMENTAL
+  // Stop publishing stats snapshots and unmap the ring. The file is left
+  // behind for agents to drain.
+  Status DisableStatsSnapshotRing();
+
   using DB::ResetStats;
   Status ResetStats() override;
   // All the returned filenames start with "/"
@@ -1171,6 +1195,9 @@ class DBImpl : public DB {
   // Wait for any background purge
   Status TEST_WaitForPurge();
 
+  // Wait for any background WAL preparation (DBOptions::prepare_log_file_num)
+  Status TEST_WaitForWalPrepare();
+
   // Get the background error status
   Status TEST_GetBGError();
 
@@ -2112,7 +2139,8 @@ class DBImpl : public DB {
       SequenceNumber* last_seqno_observed, SequenceNumber* next_sequence,
       bool* stop_replay_for_corruption, Status* status,
       bool* stop_replay_by_wal_filter,
-      std::unordered_map<int, VersionEdit>* version_edits, bool* flushed);
+      std::unordered_map<int, VersionEdit>* version_edits, bool* flushed,
+      WriteBatch* recovery_batch);
 
   Status InitializeWriteBatchForLogRecord(
       Slice record, const std::unique_ptr<log::Reader>& reader,
@@ -2439,12 +2467,20 @@ class DBImpl : public DB {
   static void BGWorkBottomCompaction(void* arg);
   static void BGWorkFlush(void* arg);
   static void BGWorkPurge(void* arg);
+  static void BGWorkPrepareWAL(void* db);
+  static void BGWorkSyncWAL(void* db);
   static void UnscheduleCompactionCallback(void* arg);
   static void UnscheduleFlushCallback(void* arg);
+  static void UnscheduleWalSyncCallback(void* arg);
   void BackgroundCallCompaction(PrepickedCompaction* prepicked_compaction,
                                 Env::Priority thread_pri);
   void BackgroundCallFlush(Env::Priority thread_pri);
   void BackgroundCallPurge();
+  void BackgroundCallPrepareWAL();
+  // Schedule a background job to top up the pool of pre-created WAL files,
+  // if DBOptions::prepare_log_file_num is set and the pool is not full.
+  void MaybeSchedulePrepareWAL();
+  void BackgroundCallSyncWAL();
   Status BackgroundCompaction(bool* madeProgress, JobContext* job_context,
                               LogBuffer* log_buffer,
                               PrepickedCompaction* prepicked_compaction,
@@ -2515,8 +2551,13 @@ class DBImpl : public DB {
   // WALs with log number up to up_to are not synced successfully.
   void MarkLogsNotSynced(uint64_t up_to);
 
+  // If allow_reuse is true and the newest snapshot in snapshots_ already has
+  // the requested sequence number and write-conflict boundary flag, that
+  // snapshot is returned again with an extra reference instead of linking a
+  // new list node. Callers that mutate the returned object after creation
+  // (e.g. WritePreparedTxnDB::EnhanceSnapshot()) must not enable reuse.
   SnapshotImpl* GetSnapshotImpl(bool is_write_conflict_boundary,
-                                bool lock = true);
+                                bool lock = true, bool allow_reuse = false);
 
   // If snapshot_seq != kMaxSequenceNumber, then this function can only be
   // called from the write thread that publishes sequence numbers to readers.
@@ -2595,10 +2636,16 @@ class DBImpl : public DB {
   Env::WriteLifeTimeHint CalculateWALWriteHint() { return Env::WLTH_SHORT; }
 
   IOStatus CreateWAL(const WriteOptions& write_options, uint64_t log_file_num,
-                     uint64_t recycle_log_number, size_t preallocate_block_size,
+                     uint64_t recycle_log_number, uint64_t prepared_log_number,
+                     size_t preallocate_block_size,
                      const PredecessorWALInfo& predecessor_wal_info,
                      log::Writer** new_log);
 
+  // Create a preallocated, zero-filled and synced WAL file that a later
+  // CreateWAL() can adopt by rename (see DBOptions::prepare_log_file_num).
+  IOStatus PrepareWALFile(uint64_t log_file_num,
+                          size_t preallocate_block_size);
+
   // Validate self-consistency of DB options
   static Status ValidateOptions(const DBOptions& db_options);
   // Validate self-consistency of DB options and its consistency with cf options
@@ -2779,6 +2826,11 @@ class DBImpl : public DB {
   // Log files that we can recycle. Must be protected by db mutex_.
   std::deque<uint64_t> wal_recycle_files_;
 
+  // Numbers of pre-created WAL files (named with kPreparedLogFileSuffix)
+  // ready to be adopted by the next WAL switch. Filled by
+  // BackgroundCallPrepareWAL(). Must be protected by db mutex_.
+  std::deque<uint64_t> prepared_wal_files_;
+
   // The minimum log file number taht can be recycled, if log recycling is
   // enabled. This is used to ensure that log files created by previous
   // instances of the database are not recycled, as we cannot be sure they
@@ -3014,6 +3066,21 @@ class DBImpl : public DB {
   // number of background obsolete file purge jobs, submitted to the HIGH pool
   int bg_purge_scheduled_ = 0;
 
+  // number of background WAL preparation jobs, submitted to the HIGH pool
+  int bg_wal_prepare_scheduled_ = 0;
+
+  // Protects wal_sync_async_queue_ and writes to bg_wal_sync_scheduled_.
+  // May be acquired while holding mutex_ (UnscheduleWalSyncCallback() runs
+  // under mutex_ during Close()); never acquire mutex_ while holding it.
+  InstrumentedMutex wal_sync_async_mutex_;
+
+  // Callbacks waiting for a background WAL sync, in call order.
+  std::deque<std::function<void(Status)>> wal_sync_async_queue_;
+
+  // true while a SyncWALAsync() job is scheduled or running on the HIGH
+  // pool. Atomic so CloseHelper() can poll it while holding only mutex_.
+  std::atomic<bool> bg_wal_sync_scheduled_{false};
+
   std::deque<ManualCompactionState*> manual_compaction_dequeue_;
 
   // shall we disable deletion of obsolete files
@@ -3098,6 +3165,12 @@ class DBImpl : public DB {
   // It contains the implementations for each periodic task.
   std::map<PeriodicTaskType, const PeriodicTaskFunc> periodic_task_functions_;
 
+  // Memory-mapped ring of stats snapshots published by the kPublishStats
+  // periodic task; set while EnableStatsSnapshotRing() is active. The task's
+  // closure holds its own reference, so resetting this does not pull the
+  // ring out from under a running task.
+  std::shared_ptr<StatsSnapshotRing> stats_snapshot_ring_;
+
   // When set, we use a separate queue for writes that don't write to memtable.
   // In 2PC these are the writes at Prepare phase.
   const bool two_write_queues_;
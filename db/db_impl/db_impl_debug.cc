@@ -195,6 +195,14 @@ Status DBImpl::TEST_WaitForPurge() {
   return error_handler_.GetBGError();
 }
 
+Status DBImpl::TEST_WaitForWalPrepare() {
+  InstrumentedMutexLock l(&mutex_);
+  while (bg_wal_prepare_scheduled_ && error_handler_.GetBGError().ok()) {
+    bg_cv_.Wait();
+  }
+  return error_handler_.GetBGError();
+}
+
 Status DBImpl::TEST_GetBGError() {
   InstrumentedMutexLock l(&mutex_);
   return error_handler_.GetBGError();
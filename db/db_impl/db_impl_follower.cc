@@ -101,6 +101,7 @@ Status DBImplFollower::TryCatchUpWithLeader() {
   TEST_SYNC_POINT("DBImplFollower::TryCatchupWithLeader:Begin2");
   // read the manifest and apply new changes to the follower instance
   std::unordered_set<ColumnFamilyData*> cfds_changed;
+  bool applied_changes = false;
   JobContext job_context(0, true /*create_superversion*/);
   {
     InstrumentedMutexLock lock_guard(&mutex_);
@@ -109,15 +110,19 @@ Status DBImplFollower::TryCatchUpWithLeader() {
             ->ReadAndApply(&mutex_, &manifest_reader_,
                            manifest_reader_status_.get(), &cfds_changed,
                            &files_to_delete);
+    applied_changes = !cfds_changed.empty() || !files_to_delete.empty();
     ReleaseFileNumberFromPendingOutputs(pending_outputs_inserted_elem_);
     pending_outputs_inserted_elem_.reset(new std::list<uint64_t>::iterator(
         CaptureCurrentFileNumberInPendingOutputs()));
 
-    ROCKS_LOG_INFO(immutable_db_options_.info_log, "Last sequence is %" PRIu64,
-                   static_cast<uint64_t>(versions_->LastSequence()));
-    ROCKS_LOG_INFO(
-        immutable_db_options_.info_log, "Next file number is %" PRIu64,
-        static_cast<uint64_t>(versions_->current_next_file_number()));
+    if (applied_changes) {
+      ROCKS_LOG_INFO(immutable_db_options_.info_log,
+                     "Last sequence is %" PRIu64,
+                     static_cast<uint64_t>(versions_->LastSequence()));
+      ROCKS_LOG_INFO(
+          immutable_db_options_.info_log, "Next file number is %" PRIu64,
+          static_cast<uint64_t>(versions_->current_next_file_number()));
+    }
     for (ColumnFamilyData* cfd : cfds_changed) {
       if (cfd->IsDropped()) {
         ROCKS_LOG_DEBUG(immutable_db_options_.info_log, "[%s] is dropped\n",
@@ -169,18 +174,23 @@ Status DBImplFollower::TryCatchUpWithLeader() {
   }
   job_context.Clean();
 
-  // Cleanup unused, obsolete files.
-  JobContext purge_files_job_context(0);
-  {
-    InstrumentedMutexLock lock_guard(&mutex_);
-    // Currently, follower instance does not create any database files, thus
-    // is unnecessary for the follower to force full scan.
-    FindObsoleteFiles(&purge_files_job_context, /*force=*/false);
-  }
-  if (purge_files_job_context.HaveSomethingToDelete()) {
-    PurgeObsoleteFiles(purge_files_job_context);
+  // Cleanup unused, obsolete files. Files can only become obsolete as a
+  // result of applying new version edits, so when the catch-up was a no-op
+  // (typically the leader had no new changes), skip the scan entirely to keep
+  // idle catch-up cycles cheap.
+  if (applied_changes) {
+    JobContext purge_files_job_context(0);
+    {
+      InstrumentedMutexLock lock_guard(&mutex_);
+      // Currently, follower instance does not create any database files, thus
+      // is unnecessary for the follower to force full scan.
+      FindObsoleteFiles(&purge_files_job_context, /*force=*/false);
+    }
+    if (purge_files_job_context.HaveSomethingToDelete()) {
+      PurgeObsoleteFiles(purge_files_job_context);
+    }
+    purge_files_job_context.Clean();
   }
-  purge_files_job_context.Clean();
 
   TEST_SYNC_POINT("DBImplFollower::TryCatchupWithLeader:End");
 
@@ -746,6 +746,17 @@ Status DBImpl::Recover(
 
     std::unordered_map<uint64_t, std::string> wal_files;
     for (const auto& file : files_in_wal_dir) {
+      if (!read_only && file.size() > kPreparedLogFileSuffix.size() &&
+          file.compare(file.size() - kPreparedLogFileSuffix.size(),
+                       kPreparedLogFileSuffix.size(),
+                       kPreparedLogFileSuffix) == 0) {
+        // Leftover pre-created WAL file from a previous DB session (see
+        // DBOptions::prepare_log_file_num). Its durability is unknown and
+        // its number may be reused, so just delete it; the pool is rebuilt
+        // in the background after open.
+        env_->DeleteFile(wal_dir + "/" + file).PermitUncheckedError();
+        continue;
+      }
       uint64_t number;
       FileType type;
       if (ParseFileName(file, &number, &type) && type == kWalFile) {
@@ -1266,6 +1277,9 @@ Status DBImpl::ProcessLogFile(
   std::string scratch;
   Slice record;
   uint64_t record_checksum;
+  // Reused across records so its buffer is allocated once per WAL instead of
+  // once per record.
+  WriteBatch recovery_batch;
   const UnorderedMap<uint32_t, size_t>& running_ts_sz =
       versions_->GetRunningColumnFamiliesTimestampSize();
 
@@ -1333,7 +1347,7 @@ Status DBImpl::ProcessLogFile(
         record, reader, running_ts_sz, wal_number, fname, read_only, job_id,
         logFileDropped, &reporter, &record_checksum, &last_seqno_observed,
         next_sequence, stop_replay_for_corruption, &status,
-        stop_replay_by_wal_filter, version_edits, flushed);
+        stop_replay_by_wal_filter, version_edits, flushed, &recovery_batch);
 
     if (!process_status.ok()) {
       return process_status;
@@ -1439,16 +1453,19 @@ Status DBImpl::ProcessLogRecord(
     SequenceNumber* last_seqno_observed, SequenceNumber* next_sequence,
     bool* stop_replay_for_corruption, Status* status,
     bool* stop_replay_by_wal_filter,
-    std::unordered_map<int, VersionEdit>* version_edits, bool* flushed) {
+    std::unordered_map<int, VersionEdit>* version_edits, bool* flushed,
+    WriteBatch* recovery_batch) {
   assert(reporter);
   assert(last_seqno_observed);
   assert(stop_replay_for_corruption);
   assert(status);
   assert(stop_replay_by_wal_filter);
+  assert(recovery_batch);
 
   Status process_status;
   bool has_valid_writes = false;
-  WriteBatch batch;
+  WriteBatch& batch = *recovery_batch;
+  batch.Clear();
   std::unique_ptr<WriteBatch> new_batch;
   WriteBatch* batch_to_use = nullptr;
 
@@ -2287,6 +2304,7 @@ Status DB::OpenAndTrimHistory(
 
 IOStatus DBImpl::CreateWAL(const WriteOptions& write_options,
                            uint64_t log_file_num, uint64_t recycle_log_number,
+                           uint64_t prepared_log_number,
                            size_t preallocate_block_size,
                            const PredecessorWALInfo& predecessor_wal_info,
                            log::Writer** new_log) {
@@ -2314,6 +2332,17 @@ IOStatus DBImpl::CreateWAL(const WriteOptions& write_options,
     TEST_SYNC_POINT("DBImpl::CreateWAL:BeforeReuseWritableFile2");
     io_s = fs_->ReuseWritableFile(log_fname, old_log_fname, opt_file_options,
                                   &lfile, /*dbg=*/nullptr);
+  } else if (prepared_log_number) {
+    // Adopt a pre-created, preallocated and synced WAL file so that no
+    // filesystem metadata work happens on the write path. See
+    // DBOptions::prepare_log_file_num.
+    ROCKS_LOG_INFO(immutable_db_options_.info_log,
+                   "adopting prepared log %" PRIu64 " as log %" PRIu64 "\n",
+                   prepared_log_number, log_file_num);
+    std::string prepared_log_fname =
+        PreparedLogFileName(wal_dir, prepared_log_number);
+    io_s = fs_->ReuseWritableFile(log_fname, prepared_log_fname,
+                                  opt_file_options, &lfile, /*dbg=*/nullptr);
   } else {
     io_s = NewWritableFile(fs_.get(), log_fname, &lfile, opt_file_options);
   }
@@ -2347,6 +2376,53 @@ IOStatus DBImpl::CreateWAL(const WriteOptions& write_options,
   return io_s;
 }
 
+IOStatus DBImpl::PrepareWALFile(uint64_t log_file_num,
+                                size_t preallocate_block_size) {
+  DBOptions db_options =
+      BuildDBOptions(immutable_db_options_, mutable_db_options_);
+  FileOptions opt_file_options =
+      fs_->OptimizeForLogWrite(file_options_, db_options);
+  std::string fname =
+      PreparedLogFileName(immutable_db_options_.GetWalDir(), log_file_num);
+
+  std::unique_ptr<FSWritableFile> file;
+  IOStatus io_s = NewWritableFile(fs_.get(), fname, &file, opt_file_options);
+  if (!io_s.ok()) {
+    return io_s;
+  }
+  // Write actual zeros rather than merely fallocating, so that the first
+  // writes to the adopted WAL overwrite written extents and fdatasync does
+  // not have to update filesystem metadata (allocation or unwritten-extent
+  // conversion).
+  constexpr size_t kZeroBufferSize = 1 << 20;
+  std::string zeros(std::min(preallocate_block_size, kZeroBufferSize), '\0');
+  size_t written = 0;
+  while (io_s.ok() && written < preallocate_block_size) {
+    size_t len = std::min(preallocate_block_size - written, zeros.size());
+    io_s = file->Append(Slice(zeros.data(), len), IOOptions(),
+                        /*dbg=*/nullptr);
+    written += len;
+  }
+  if (io_s.ok()) {
+    io_s = file->Fsync(IOOptions(), /*dbg=*/nullptr);
+  }
+  if (io_s.ok()) {
+    io_s = file->Close(IOOptions(), /*dbg=*/nullptr);
+  }
+  if (io_s.ok()) {
+    // Make the new directory entry durable as well, so adoption by rename
+    // is all that remains for the write path.
+    io_s = directories_.GetWalDir()->FsyncWithDirOptions(
+        IOOptions(), /*dbg=*/nullptr,
+        DirFsyncOptions(DirFsyncOptions::FsyncReason::kNewFileSynced));
+  }
+  if (!io_s.ok()) {
+    fs_->DeleteFile(fname, IOOptions(), /*dbg=*/nullptr)
+        .PermitUncheckedError();
+  }
+  return io_s;
+}
+
 void DBImpl::TrackExistingDataFiles(
     const std::vector<std::string>& existing_data_files) {
   TrackOrUntrackFiles(existing_data_files, /*track=*/true);
@@ -2443,7 +2519,7 @@ Status DBImpl::Open(const DBOptions& db_options, const std::string& dbname,
     // to `avoid_flush_during_recovery == true`. This can protect the last WAL
     // recovered.
     s = impl->CreateWAL(write_options, new_log_number, 0 /*recycle_log_number*/,
-                        preallocate_block_size,
+                        0 /*prepared_log_number*/, preallocate_block_size,
                         PredecessorWALInfo() /* predecessor_wal_info */,
                         &new_log);
     if (s.ok()) {
@@ -410,9 +410,23 @@ Status DBImpl::WriteImpl(const WriteOptions& write_options,
         "DeleteRange is not compatible with row cache.");
   }
   if (wbwi) {
-    assert(prep_log > 0);
-    // Used only in WriteCommittedTxn::CommitInternal() with no `callback`.
+    // Used in WriteCommittedTxn::CommitInternal(), where my_batch is the
+    // commit marker and the data is already in the WAL prepare section
+    // (prep_log > 0), and in CommitWithoutPrepareInternal(), where my_batch
+    // is the transaction's own data batch: it is written to WAL here but
+    // not applied to the memtable (disable_memtable), since the ingested
+    // wbwi covers the same updates and sequence numbers.
+    assert((prep_log > 0 && !disable_memtable) ||
+           (prep_log == 0 && disable_memtable));
+    // Neither caller uses a `callback`.
     assert(!callback);
+    if (two_write_queues_ && prep_log == 0) {
+      // Otherwise the disable_memtable write below would detour into
+      // WriteImplWALOnly and the wbwi would never be ingested.
+      return Status::NotSupported(
+          "Ingesting WriteBatch from a non-prepared transaction does not "
+          "support two_write_queues");
+    }
     if (immutable_db_options_.unordered_write) {
       return Status::NotSupported(
           "Ingesting WriteBatch does not support unordered_write");
@@ -839,9 +853,13 @@ Status DBImpl::WriteImpl(const WriteOptions& write_options,
   }
   if (wbwi) {
     if (status.ok() && w.status.ok()) {
-      // w.batch contains (potentially empty) commit time batch updates,
-      // only ingest wbwi if w.batch is applied to memtable successfully
-      uint32_t memtable_update_count = w.batch->Count();
+      // For a prepared commit, w.batch contains (potentially empty) commit
+      // time batch updates and is applied to the memtable; only ingest wbwi
+      // if that succeeded. For a non-prepared commit, w.batch is the data
+      // batch itself and is written to WAL only (disable_memtable), so it
+      // consumes no memtable sequence numbers here.
+      uint32_t memtable_update_count =
+          w.ShouldWriteToMemtable() ? w.batch->Count() : 0;
       uint32_t wbwi_count = wbwi->GetWriteBatch()->Count();
       // Seqno assigned to this write are [last_seq + 1 - seq_inc, last_seq].
       // seq_inc includes w.batch (memtable updates) and wbwi
@@ -855,8 +873,13 @@ Status DBImpl::WriteImpl(const WriteOptions& write_options,
       if (two_write_queues_) {
         assert(ub <= versions_->LastAllocatedSequence());
       }
+      // For a non-prepared commit the data lives in this write's own WAL
+      // record rather than in a prepare section. That WAL is already kept
+      // alive by SetNextLogNumber() in SwitchMemtable(), but pin it here as
+      // well so both paths retain WALs through the same mechanism.
+      uint64_t data_log = prep_log > 0 ? prep_log : w.wal_used;
       status = IngestWBWI(wbwi, {/*lower_bound=*/lb, /*upper_bound=*/ub},
-                          prep_log, last_sequence,
+                          data_log, last_sequence,
                           /*memtable_updated=*/memtable_update_count > 0,
                           write_options.ignore_missing_column_families);
     }
@@ -1496,7 +1519,7 @@ Status DBImpl::PreprocessWrite(const WriteOptions& write_options,
         InternalStats::kIntStatsWriteBufferManagerLimitStopsCounts, 1,
         true /* concurrent */);
     if (write_options.no_slowdown) {
-      status = Status::Incomplete("Write stall");
+      status = Status::Incomplete(Status::SubCode::kWriteStall);
     } else {
       InstrumentedMutexLock l(&mutex_);
       WriteBufferManagerStallWrites();
@@ -2042,6 +2065,7 @@ Status DBImpl::HandleWriteBufferManagerFlush(WriteContext* write_context) {
   } else {
     ColumnFamilyData* cfd_picked = nullptr;
     SequenceNumber seq_num_for_cf_picked = kMaxSequenceNumber;
+    double max_overrun_for_cf_picked = -1.0;
 
     for (auto cfd : *versions_->GetColumnFamilySet()) {
       if (cfd->IsDropped()) {
@@ -2052,10 +2076,26 @@ Status DBImpl::HandleWriteBufferManagerFlush(WriteContext* write_context) {
         // and no immutable memtables for which flush has yet to finish. If
         // we triggered flush on CFs already trying to flush, we would risk
         // creating too many immutable memtables leading to write stalls.
+        //
+        // Among the candidates, pick the CF that is furthest over its own
+        // memtable budget, measured as mutable memtable usage relative to
+        // the CF's write_buffer_size. This gives each CF a weighted fair
+        // share of the write buffer: a write-heavy CF is flushed before
+        // lightly-written CFs that happen to hold older data, so the
+        // latter are not repeatedly flushed early into small L0 files.
+        // Fall back to the oldest memtable (smallest creation seq) on ties.
         uint64_t seq = cfd->mem()->GetCreationSeq();
-        if (cfd_picked == nullptr || seq < seq_num_for_cf_picked) {
+        size_t cf_write_buffer_size =
+            cfd->GetLatestMutableCFOptions().write_buffer_size;
+        double overrun =
+            static_cast<double>(cfd->mem()->ApproximateMemoryUsage()) /
+            static_cast<double>(std::max(cf_write_buffer_size, size_t{1}));
+        if (cfd_picked == nullptr || overrun > max_overrun_for_cf_picked ||
+            (overrun == max_overrun_for_cf_picked &&
+             seq < seq_num_for_cf_picked)) {
           cfd_picked = cfd;
           seq_num_for_cf_picked = seq;
+          max_overrun_for_cf_picked = overrun;
         }
       }
     }
@@ -2148,7 +2188,7 @@ Status DBImpl::DelayWrite(uint64_t num_bytes, WriteThread& write_thread,
 
     if (delay > 0) {
       if (write_options.no_slowdown) {
-        return Status::Incomplete("Write stall");
+        return Status::Incomplete(Status::SubCode::kWriteStall);
       }
       TEST_SYNC_POINT("DBImpl::DelayWrite:Sleep");
 
@@ -2184,7 +2224,7 @@ Status DBImpl::DelayWrite(uint64_t num_bytes, WriteThread& write_thread,
            write_controller_.IsStopped() &&
            !shutting_down_.load(std::memory_order_relaxed)) {
       if (write_options.no_slowdown) {
-        return Status::Incomplete("Write stall");
+        return Status::Incomplete(Status::SubCode::kWriteStall);
       }
       delayed = true;
 
@@ -2451,6 +2491,12 @@ Status DBImpl::SwitchMemtable(ColumnFamilyData* cfd, WriteContext* context,
       !wal_recycle_files_.empty() && IsFileDeletionsEnabled()) {
     recycle_log_number = wal_recycle_files_.front();
   }
+  // A pre-created WAL file can be adopted when no recycled WAL is available
+  uint64_t prepared_log_number = 0;
+  if (creating_new_log && recycle_log_number == 0 &&
+      !prepared_wal_files_.empty()) {
+    prepared_log_number = prepared_wal_files_.front();
+  }
   uint64_t new_log_number =
       creating_new_log ? versions_->NewFileNumber() : cur_wal_number_;
   // For use outside of holding DB mutex
@@ -2489,7 +2535,8 @@ Status DBImpl::SwitchMemtable(ColumnFamilyData* cfd, WriteContext* context,
     // TODO: Write buffer size passed in should be max of all CF's instead
     // of mutable_cf_options.write_buffer_size.
     io_s = CreateWAL(write_options, new_log_number, recycle_log_number,
-                     preallocate_block_size, info, &new_log);
+                     prepared_log_number, preallocate_block_size, info,
+                     &new_log);
     if (s.ok()) {
       s = io_s;
     }
@@ -2529,6 +2576,13 @@ Status DBImpl::SwitchMemtable(ColumnFamilyData* cfd, WriteContext* context,
     assert(wal_recycle_files_.front() == recycle_log_number);
     wal_recycle_files_.pop_front();
   }
+  if (prepared_log_number != 0) {
+    // Renaming the prepared file is done outside DB mutex; only the write
+    // thread consumes the front of the list, and the background preparation
+    // task only appends, so the front is stable until we pop it here.
+    assert(prepared_wal_files_.front() == prepared_log_number);
+    prepared_wal_files_.pop_front();
+  }
   if (s.ok() && creating_new_log) {
     InstrumentedMutexLock l(&wal_write_mutex_);
     assert(new_log != nullptr);
@@ -2664,6 +2718,10 @@ Status DBImpl::SwitchMemtable(ColumnFamilyData* cfd, WriteContext* context,
   new_mem->Ref();
   cfd->SetMemtable(new_mem);
   InstallSuperVersionAndScheduleWork(cfd, &context->superversion_context);
+  if (creating_new_log) {
+    // Top up the pool of pre-created WAL files for the next switch
+    MaybeSchedulePrepareWAL();
+  }
 
   // Notify client that memtable is sealed, now that we have successfully
   // installed a new memtable
@@ -2854,6 +2912,66 @@ Status DB::DeleteRange(const WriteOptions& opt,
   return Write(opt, &batch);
 }
 
+Status DB::DeleteRanges(const WriteOptions& opt,
+                        ColumnFamilyHandle* column_family, const Range* ranges,
+                        size_t n) {
+  if (n == 0) {
+    return Status::OK();
+  }
+  assert(column_family);
+  const Comparator* const ucmp = column_family->GetComparator();
+  assert(ucmp);
+  if (ucmp->timestamp_size() > 0) {
+    return Status::NotSupported(
+        "DeleteRanges does not support user-defined timestamps");
+  }
+  WriteBatch batch(0 /* reserved_bytes */, 0 /* max_bytes */,
+                   opt.protection_bytes_per_key, 0 /* default_cf_ts_sz */);
+  // Coalesce adjacent/overlapping ranges into one tombstone each so the
+  // number of tombstones inserted is proportional to the number of distinct
+  // gaps, not the number of input ranges.
+  bool pending = false;
+  Slice begin;
+  Slice end;
+  for (size_t i = 0; i < n; ++i) {
+    const int cmp = ucmp->Compare(ranges[i].start, ranges[i].limit);
+    if (cmp > 0) {
+      return Status::InvalidArgument("end key comes before start key");
+    }
+    if (i > 0 && ucmp->Compare(ranges[i].start, ranges[i - 1].start) < 0) {
+      return Status::InvalidArgument("ranges are not sorted by start key");
+    }
+    if (cmp == 0) {
+      // Empty range; don't bother applying it to the DB.
+      continue;
+    }
+    if (pending && ucmp->Compare(ranges[i].start, end) <= 0) {
+      if (ucmp->Compare(ranges[i].limit, end) > 0) {
+        end = ranges[i].limit;
+      }
+      continue;
+    }
+    if (pending) {
+      Status s = batch.DeleteRange(column_family, begin, end);
+      if (!s.ok()) {
+        return s;
+      }
+    }
+    begin = ranges[i].start;
+    end = ranges[i].limit;
+    pending = true;
+  }
+  if (!pending) {
+    // All input ranges were empty.
+    return Status::OK();
+  }
+  Status s = batch.DeleteRange(column_family, begin, end);
+  if (!s.ok()) {
+    return s;
+  }
+  return Write(opt, &batch);
+}
+
 Status DB::Merge(const WriteOptions& opt, ColumnFamilyHandle* column_family,
                  const Slice& key, const Slice& value) {
   WriteBatch batch(0 /* reserved_bytes */, 0 /* max_bytes */,
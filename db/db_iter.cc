@@ -12,6 +12,7 @@
 #include <limits>
 #include <string>
 
+#include "db/blob/blob_index.h"
 #include "db/dbformat.h"
 #include "db/merge_context.h"
 #include "db/merge_helper.h"
@@ -52,7 +53,8 @@ DBIter::DBIter(Env* _env, const ReadOptions& read_options,
       iter_(iter),
       blob_reader_(version, read_options.read_tier,
                    read_options.verify_checksums, read_options.fill_cache,
-                   read_options.io_activity),
+                   read_options.io_activity, read_options.readahead_size,
+                   ioptions.allow_mmap_reads),
       read_callback_(read_callback),
       sequence_(s),
       statistics_(ioptions.stats),
@@ -84,6 +86,7 @@ DBIter::DBIter(Env* _env, const ReadOptions& read_options,
       expose_blob_index_(expose_blob_index),
       allow_unprepared_value_(read_options.allow_unprepared_value),
       is_blob_(false),
+      lazy_value_pending_(false),
       arena_mode_(arena_mode) {
   RecordTick(statistics_, NO_ITERATOR_CREATED);
   if (pin_thru_lifetime_) {
@@ -213,11 +216,27 @@ Status DBIter::BlobReader::RetrieveAndSetBlobValue(const Slice& user_key,
   read_options.verify_checksums = verify_checksums_;
   read_options.fill_cache = fill_cache_;
   read_options.io_activity = io_activity_;
-  constexpr FilePrefetchBuffer* prefetch_buffer = nullptr;
   constexpr uint64_t* bytes_read = nullptr;
 
-  const Status s = version_->GetBlob(read_options, user_key, blob_index,
-                                     prefetch_buffer, &blob_value_, bytes_read);
+  Status s;
+  if (prefetch_buffers_) {
+    BlobIndex decoded_blob_index;
+    s = decoded_blob_index.DecodeFrom(blob_index);
+    if (!s.ok()) {
+      return s;
+    }
+    FilePrefetchBuffer* prefetch_buffer =
+        !decoded_blob_index.IsInlined() && !decoded_blob_index.HasTTL()
+            ? prefetch_buffers_->GetOrCreatePrefetchBuffer(
+                  decoded_blob_index.file_number())
+            : nullptr;
+    s = version_->GetBlob(read_options, user_key, decoded_blob_index,
+                          prefetch_buffer, &blob_value_, bytes_read);
+  } else {
+    constexpr FilePrefetchBuffer* prefetch_buffer = nullptr;
+    s = version_->GetBlob(read_options, user_key, blob_index, prefetch_buffer,
+                          &blob_value_, bytes_read);
+  }
 
   if (!s.ok()) {
     return s;
@@ -312,6 +331,32 @@ bool DBIter::SetValueAndColumnsFromMergeResult(const Status& merge_status,
 bool DBIter::PrepareValue() {
   assert(valid_);
 
+  if (lazy_value_pending_) {
+    assert(allow_unprepared_value_);
+    assert(direction_ == kForward);
+    assert(!current_entry_is_merged_);
+    assert(lazy_blob_index_.empty());
+
+    lazy_value_pending_ = false;
+
+    // The inner iterator is still positioned at the entry that yields the
+    // current key; load its block and/or value now.
+    if (!PrepareValueInternal()) {
+      assert(!valid_);
+      return false;
+    }
+
+    assert(ikey_.type == kTypeValue || ikey_.type == kTypeValuePreferredSeqno);
+    Slice value = iter_.value();
+    saved_write_unix_time_ = iter_.write_unix_time();
+    if (ikey_.type == kTypeValuePreferredSeqno) {
+      value = ParsePackedValueForValue(value);
+    }
+    SetValueAndColumnsFromPlain(value);
+
+    return true;
+  }
+
   if (lazy_blob_index_.empty()) {
     return true;
   }
@@ -470,6 +515,28 @@ bool DBIter::FindNextUserEntryInternal(bool skipping_saved_key,
           case kTypeValuePreferredSeqno:
           case kTypeBlobIndex:
           case kTypeWideColumnEntity:
+            if (allow_unprepared_value_ && (ikey_.type == kTypeValue ||
+                                            ikey_.type == kTypeValuePreferredSeqno)) {
+              // Defer preparing the value until PrepareValue(). In addition to
+              // skipping the value slice setup, this keeps the inner iterator
+              // unprepared, so a data block whose load was deferred based on
+              // the index (kBinarySearchWithFirstKey) is not read at all if the
+              // caller never asks for the value. The key is available either
+              // way: it comes from the index entry in the deferred case.
+              if (timestamp_lb_) {
+                saved_key_.SetInternalKey(ikey_);
+              } else {
+                saved_key_.SetUserKey(
+                    ikey_.user_key, !pin_thru_lifetime_ ||
+                                        !iter_.iter()->IsKeyPinned() /* copy */);
+              }
+              assert(value_.empty());
+              assert(wide_columns_.empty());
+              assert(!lazy_value_pending_);
+              lazy_value_pending_ = true;
+              valid_ = true;
+              return true;
+            }
             if (!PrepareValueInternal()) {
               return false;
             }
@@ -1483,7 +1550,7 @@ bool DBIter::TooManyInternalKeysSkipped(bool increment) {
   if ((max_skippable_internal_keys_ > 0) &&
       (num_internal_keys_skipped_ > max_skippable_internal_keys_)) {
     valid_ = false;
-    status_ = Status::Incomplete("Too many internal keys skipped.");
+    status_ = Status::Incomplete(Status::SubCode::kTooManyInternalKeysSkipped);
     return true;
   } else if (increment) {
     num_internal_keys_skipped_++;
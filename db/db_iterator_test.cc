@@ -1361,6 +1361,116 @@ TEST_P(DBIteratorTest, IndexWithFirstKey) {
   }
 }
 
+// With kBinarySearchWithFirstKey and allow_unprepared_value, a forward scan
+// that never asks for values should not read any data blocks; PrepareValue()
+// triggers the read on demand.
+TEST_P(DBIteratorTest, IndexWithFirstKeyUnpreparedValue) {
+  Options options = CurrentOptions();
+  options.env = env_;
+  options.create_if_missing = true;
+  options.prefix_extractor = nullptr;
+  options.statistics = ROCKSDB_NAMESPACE::CreateDBStatistics();
+  Statistics* stats = options.statistics.get();
+  BlockBasedTableOptions table_options;
+  table_options.index_type =
+      BlockBasedTableOptions::IndexType::kBinarySearchWithFirstKey;
+  table_options.index_shortening =
+      BlockBasedTableOptions::IndexShorteningMode::kNoShortening;
+  table_options.flush_block_policy_factory =
+      std::make_shared<FlushBlockEveryKeyPolicyFactory>();
+  table_options.block_cache = NewLRUCache(8000);
+  options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+
+  DestroyAndReopen(options);
+  ASSERT_OK(Put("a1", "x1"));
+  ASSERT_OK(Put("b1", "y1"));
+  ASSERT_OK(Put("c1", "z1"));
+  ASSERT_OK(Flush());
+
+  ReadOptions ropt;
+  ropt.allow_unprepared_value = true;
+  std::unique_ptr<Iterator> iter(NewIterator(ropt));
+
+  // A seek that lands on the first key of a block yields the key from the
+  // index without reading the data block.
+  iter->Seek("b0");
+  ASSERT_TRUE(iter->Valid());
+  EXPECT_EQ("b1", iter->key().ToString());
+  EXPECT_EQ(0, stats->getTickerCount(BLOCK_CACHE_DATA_MISS));
+
+  // Moving on without calling PrepareValue() skips the block entirely.
+  iter->Seek("c0");
+  ASSERT_TRUE(iter->Valid());
+  EXPECT_EQ("c1", iter->key().ToString());
+  EXPECT_EQ(0, stats->getTickerCount(BLOCK_CACHE_DATA_MISS));
+
+  // PrepareValue() reads the block and makes the value available.
+  ASSERT_TRUE(iter->PrepareValue());
+  ASSERT_TRUE(iter->Valid());
+  EXPECT_EQ("z1", iter->value().ToString());
+  EXPECT_EQ(1, stats->getTickerCount(BLOCK_CACHE_DATA_MISS));
+
+  // Next() from an unprepared entry loads the current block as needed to find
+  // the successor, which is again returned without reading its own block.
+  iter->SeekToFirst();
+  ASSERT_TRUE(iter->Valid());
+  EXPECT_EQ("a1", iter->key().ToString());
+  EXPECT_EQ(1, stats->getTickerCount(BLOCK_CACHE_DATA_MISS));
+
+  iter->Next();
+  ASSERT_TRUE(iter->Valid());
+  EXPECT_EQ("b1", iter->key().ToString());
+  EXPECT_EQ(2, stats->getTickerCount(BLOCK_CACHE_DATA_MISS));
+
+  ASSERT_TRUE(iter->PrepareValue());
+  EXPECT_EQ("y1", iter->value().ToString());
+  EXPECT_EQ(3, stats->getTickerCount(BLOCK_CACHE_DATA_MISS));
+
+  iter->Next();
+  ASSERT_TRUE(iter->Valid());
+  EXPECT_EQ("c1", iter->key().ToString());
+  iter->Next();
+  ASSERT_FALSE(iter->Valid());
+  ASSERT_OK(iter->status());
+}
+
+TEST_P(DBIteratorTest, UpperBoundAcrossFileBoundaries) {
+  // LevelIterator elides per-key upper bound checks for files whose largest
+  // key is below the bound; verify bounded scans still stop at the right key
+  // when the bound falls inside, exactly on, and between file boundaries.
+  Options options = CurrentOptions();
+  DestroyAndReopen(options);
+  // Three L1 files: [a, c], [e, g], [i, k].
+  for (const auto& keys : {std::make_pair("a", "c"), std::make_pair("e", "g"),
+                           std::make_pair("i", "k")}) {
+    ASSERT_OK(Put(keys.first, "v"));
+    ASSERT_OK(Put(keys.second, "v"));
+    ASSERT_OK(Flush());
+  }
+  MoveFilesToLevel(1);
+  ASSERT_EQ("0,3", FilesPerLevel());
+
+  auto ScanKeys = [&](const std::string& ub) {
+    Slice ub_slice(ub);
+    ReadOptions ro;
+    ro.iterate_upper_bound = &ub_slice;
+    std::unique_ptr<Iterator> iter(NewIterator(ro));
+    std::string result;
+    for (iter->SeekToFirst(); iter->Valid(); iter->Next()) {
+      result += iter->key().ToString();
+    }
+    EXPECT_OK(iter->status());
+    return result;
+  };
+
+  ASSERT_EQ("a", ScanKeys("b"));     // inside the first file
+  ASSERT_EQ("ac", ScanKeys("c1"));   // past the first file's largest key
+  ASSERT_EQ("ac", ScanKeys("e"));    // exactly on the second file's smallest
+  ASSERT_EQ("ace", ScanKeys("g"));   // exactly on the second file's largest
+  ASSERT_EQ("aceg", ScanKeys("h"));  // between the second and third file
+  ASSERT_EQ("acegik", ScanKeys("z"));
+}
+
 TEST_P(DBIteratorTest, IndexWithFirstKeyGet) {
   Options options = CurrentOptions();
   options.env = env_;
@@ -489,6 +489,62 @@ TEST_F(DBMergeOperandTest, GetMergeOperandsShortCircuitInMemtable) {
   }
 }
 
+TEST_F(DBMergeOperandTest, GetMergeOperandsStreamingOnly) {
+  // With a continuation callback, the caller may pass a nullptr
+  // `merge_operands` array and consume the operands in the callback only.
+  const int kNumOperands = 10;
+
+  Options options = CurrentOptions();
+  options.merge_operator = MergeOperators::CreateStringAppendOperator();
+  DestroyAndReopen(options);
+
+  Random rnd(301);
+  std::vector<std::string> expected_merge_operands;
+  expected_merge_operands.reserve(kNumOperands);
+  for (int i = 0; i < kNumOperands; ++i) {
+    expected_merge_operands.emplace_back(rnd.RandomString(7 /* len */));
+    ASSERT_OK(Merge("key", expected_merge_operands.back()));
+  }
+  ASSERT_OK(Flush());
+
+  // Operands are streamed from newest to oldest.
+  GetMergeOperandsOptions merge_operands_info;
+  std::vector<std::string> streamed_operands;
+  merge_operands_info.continue_cb = [&streamed_operands](Slice value) {
+    streamed_operands.emplace_back(value.ToString());
+    return true;
+  };
+  int num_merge_operands = 0;
+  ASSERT_OK(db_->GetMergeOperands(ReadOptions(), db_->DefaultColumnFamily(),
+                                  "key", nullptr /* merge_operands */,
+                                  &merge_operands_info, &num_merge_operands));
+  ASSERT_EQ(kNumOperands, num_merge_operands);
+  ASSERT_EQ(kNumOperands, static_cast<int>(streamed_operands.size()));
+  for (int i = 0; i < kNumOperands; ++i) {
+    ASSERT_EQ(expected_merge_operands[kNumOperands - 1 - i],
+              streamed_operands[i]);
+  }
+
+  // Early termination still works without a `merge_operands` array.
+  streamed_operands.clear();
+  merge_operands_info.continue_cb = [&streamed_operands](Slice value) {
+    streamed_operands.emplace_back(value.ToString());
+    return streamed_operands.size() < 5;
+  };
+  ASSERT_OK(db_->GetMergeOperands(ReadOptions(), db_->DefaultColumnFamily(),
+                                  "key", nullptr /* merge_operands */,
+                                  &merge_operands_info, &num_merge_operands));
+  ASSERT_EQ(5, num_merge_operands);
+  ASSERT_EQ(5, static_cast<int>(streamed_operands.size()));
+
+  // Without a continuation callback, a nullptr array is an invalid argument.
+  merge_operands_info.continue_cb = nullptr;
+  ASSERT_TRUE(db_->GetMergeOperands(ReadOptions(), db_->DefaultColumnFamily(),
+                                    "key", nullptr /* merge_operands */,
+                                    &merge_operands_info, &num_merge_operands)
+                  .IsInvalidArgument());
+}
+
 TEST_F(DBMergeOperandTest, GetMergeOperandsShortCircuitBaseValue) {
   // The continuation callback doesn't need to be called on a base value because
   // there's no remaining work to be saved.
@@ -3523,6 +3523,57 @@ TEST_F(DBRangeDelTest, NonBottommostCompactionDropRangetombstone) {
   db_->ReleaseSnapshot(snapshot);
 }
 
+TEST_F(DBRangeDelTest, DeleteRangesCoalesce) {
+  Options options = CurrentOptions();
+  DestroyAndReopen(options);
+
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK(Put(Key(i), "val"));
+  }
+
+  // Invalid inputs: a range whose limit comes before its start, and ranges
+  // not sorted by start key.
+  {
+    std::vector<Range> ranges{{Key(2), Key(1)}};
+    ASSERT_TRUE(db_->DeleteRanges(WriteOptions(), db_->DefaultColumnFamily(),
+                                  ranges.data(), ranges.size())
+                    .IsInvalidArgument());
+  }
+  {
+    std::vector<Range> ranges{{Key(5), Key(6)}, {Key(1), Key(2)}};
+    ASSERT_TRUE(db_->DeleteRanges(WriteOptions(), db_->DefaultColumnFamily(),
+                                  ranges.data(), ranges.size())
+                    .IsInvalidArgument());
+  }
+
+  // Overlapping, adjacent and empty ranges collapse into a single tombstone
+  // per distinct gap: [1, 3) + [2, 4) + [4, 6) -> [1, 6), and [8, 9) stays
+  // separate. [6, 6) is empty and dropped.
+  std::vector<Range> ranges{{Key(1), Key(3)},
+                            {Key(2), Key(4)},
+                            {Key(4), Key(6)},
+                            {Key(6), Key(6)},
+                            {Key(8), Key(9)}};
+  ASSERT_OK(db_->DeleteRanges(WriteOptions(), db_->DefaultColumnFamily(),
+                              ranges.data(), ranges.size()));
+
+  ASSERT_EQ(Get(Key(0)), "val");
+  for (int i = 1; i < 6; ++i) {
+    ASSERT_EQ(Get(Key(i)), "NOT_FOUND");
+  }
+  ASSERT_EQ(Get(Key(6)), "val");
+  ASSERT_EQ(Get(Key(7)), "val");
+  ASSERT_EQ(Get(Key(8)), "NOT_FOUND");
+  ASSERT_EQ(Get(Key(9)), "val");
+
+  ASSERT_OK(Flush());
+  std::string property;
+  db_->GetProperty(DB::Properties::kAggregatedTableProperties, &property);
+  TableProperties output_tp;
+  ParseTablePropertiesString(property, &output_tp);
+  ASSERT_EQ(output_tp.num_range_deletions, 2);
+}
+
 TEST_F(DBRangeDelTest, MemtableMaxRangeDeletions) {
   // Tests option `memtable_max_range_deletions`.
   Options options = CurrentOptions();
@@ -1811,6 +1811,52 @@ TEST_F(DBTest, ApproximateSizesFilesWithErrorMargin) {
   }
 }
 
+TEST_F(DBTest, ApproximateSizesFilesMetadataOnly) {
+  BlockBasedTableOptions table_options;
+  table_options.block_size = 100;
+  Options options = CurrentOptions();
+  options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+  options.write_buffer_size = 24 * 1024;
+  options.compression = kNoCompression;
+  options.create_if_missing = true;
+  options.target_file_size_base = 24 * 1024;
+  DestroyAndReopen(options);
+  const auto default_cf = db_->DefaultColumnFamily();
+
+  const int N = 64000;
+  Random rnd(301);
+  for (int i = 0; i < N; i++) {
+    ASSERT_OK(Put(Key(i), rnd.RandomString(24)));
+  }
+  ASSERT_OK(Flush());
+  ASSERT_OK(
+      db_->CompactRange(CompactRangeOptions(), default_cf, nullptr, nullptr));
+
+  // A range whose endpoints fall inside files, so that the boundary files'
+  // contribution matters.
+  const std::string start = Key(N / 4);
+  const std::string end = Key(3 * N / 4);
+  const Range r(start, end);
+
+  SizeApproximationOptions size_approx_options;
+
+  // Precise size, reading index blocks for the boundary files
+  uint64_t size;
+  ASSERT_OK(
+      db_->GetApproximateSizes(size_approx_options, default_cf, &r, 1, &size));
+  ASSERT_NE(size, 0);
+
+  // Metadata-only size, interpolating the boundary files' contribution from
+  // their key bounds. Keys here are uniformly distributed, so the estimate
+  // should be in the right ballpark.
+  uint64_t size2;
+  size_approx_options.files_size_metadata_only = true;
+  ASSERT_OK(
+      db_->GetApproximateSizes(size_approx_options, default_cf, &r, 1, &size2));
+  ASSERT_LT(size2, size * 14 / 10);
+  ASSERT_GT(size2, size * 6 / 10);
+}
+
 TEST_F(DBTest, GetApproximateMemTableStats) {
   Options options = CurrentOptions();
   options.write_buffer_size = 100000000;
@@ -4484,6 +4484,20 @@ TEST_F(DBTest2, TraceAndReplay) {
   ASSERT_EQ(res_handler.GetNumMultiGets(), 0);
   res_handler.Reset();
 
+  // Re-replay using 2 threads, keeping reads ordered after earlier writes.
+  {
+    ReplayOptions replay_opts(2, 1.0);
+    replay_opts.preserve_write_read_order = true;
+    ASSERT_OK(replayer->Prepare());
+    ASSERT_OK(replayer->Replay(replay_opts, res_cb));
+    ASSERT_GE(res_handler.GetAvgLatency(), 0.0);
+    ASSERT_EQ(res_handler.GetNumWrites(), 8);
+    ASSERT_EQ(res_handler.GetNumGets(), 3);
+    ASSERT_EQ(res_handler.GetNumIterSeeks(), 2);
+    ASSERT_EQ(res_handler.GetNumMultiGets(), 0);
+    res_handler.Reset();
+  }
+
   replayer.reset();
 
   for (auto handle : handles) {
@@ -8032,6 +8046,40 @@ TEST_F(DBTest2, ZSTDChecksum) {
 }
 #endif
 
+TEST_F(DBTest2, SkipTableReaderPreloadOnDBOpen) {
+  Options options = CurrentOptions();
+  options.statistics = ROCKSDB_NAMESPACE::CreateDBStatistics();
+  options.max_open_files = -1;
+  options.level0_file_num_compaction_trigger = 100;
+  DestroyAndReopen(options);
+
+  constexpr int kNumFiles = 20;
+  for (int i = 0; i < kNumFiles; ++i) {
+    ASSERT_OK(Put(Key(i), "val" + std::to_string(i)));
+    ASSERT_OK(Flush());
+  }
+
+  // With an unbounded table cache all files are pre-opened by default.
+  uint64_t base_file_opens = TestGetTickerCount(options, NO_FILE_OPENS);
+  Reopen(options);
+  ASSERT_EQ(base_file_opens + kNumFiles,
+            TestGetTickerCount(options, NO_FILE_OPENS));
+
+  // With lazy open only a capped prefix of the files is pre-opened; the rest
+  // are materialized by the table cache on first use.
+  options.skip_table_reader_preload_on_db_open = true;
+  base_file_opens = TestGetTickerCount(options, NO_FILE_OPENS);
+  Reopen(options);
+  ASSERT_LT(TestGetTickerCount(options, NO_FILE_OPENS),
+            base_file_opens + kNumFiles);
+
+  for (int i = 0; i < kNumFiles; ++i) {
+    ASSERT_EQ("val" + std::to_string(i), Get(Key(i)));
+  }
+  ASSERT_EQ(base_file_opens + kNumFiles,
+            TestGetTickerCount(options, NO_FILE_OPENS));
+}
+
 TEST_F(DBTest2, TableCacheMissDuringReadFromBlockCacheTier) {
   Options options = CurrentOptions();
   options.statistics = ROCKSDB_NAMESPACE::CreateDBStatistics();
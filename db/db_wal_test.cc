@@ -7,6 +7,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file. See the AUTHORS file for names of contributors.
 
+#include <condition_variable>
+#include <mutex>
+
 #include "db/db_test_util.h"
 #include "db/db_with_timestamp_test_util.h"
 #include "options/options_helper.h"
@@ -293,6 +296,41 @@ TEST_F(DBWALTest, SyncWALNotWaitWrite) {
   ROCKSDB_NAMESPACE::SyncPoint::GetInstance()->DisableProcessing();
 }
 
+TEST_F(DBWALTest, SyncWALAsync) {
+  Options options = CurrentOptions();
+  DestroyAndReopen(options);
+
+  ASSERT_OK(Put("foo1", "bar1"));
+  ASSERT_OK(Put("foo2", "bar2"));
+
+  // Callbacks from successive calls must be invoked in call order, with the
+  // sync result, from a background thread.
+  std::mutex mu;
+  std::condition_variable cv;
+  std::vector<int> order;
+  auto make_callback = [&](int id) {
+    return [&, id](Status s) {
+      ASSERT_OK(s);
+      std::lock_guard<std::mutex> lock(mu);
+      order.push_back(id);
+      cv.notify_all();
+    };
+  };
+  ASSERT_OK(db_->SyncWALAsync(make_callback(1)));
+  ASSERT_OK(db_->SyncWALAsync(make_callback(2)));
+  ASSERT_OK(db_->SyncWALAsync(make_callback(3)));
+  {
+    std::unique_lock<std::mutex> lock(mu);
+    cv.wait(lock, [&] { return order.size() == 3; });
+  }
+  ASSERT_EQ(order, std::vector<int>({1, 2, 3}));
+
+  ASSERT_TRUE(db_->SyncWALAsync({}).IsInvalidArgument());
+
+  ASSERT_EQ(Get("foo1"), "bar1");
+  ASSERT_EQ(Get("foo2"), "bar2");
+}
+
 TEST_F(DBWALTest, Recover) {
   do {
     CreateAndReopenWithCF({"pikachu"}, CurrentOptions());
@@ -1473,6 +1511,81 @@ TEST_F(DBWALTest, SyncMultipleLogs) {
   ASSERT_OK(dbfull()->SyncWAL());
 }
 
+TEST_F(DBWALTest, PreparedWalPool) {
+  Options options = CurrentOptions();
+  options.prepare_log_file_num = 2;
+  DestroyAndReopen(options);
+
+  auto count_prepared_files = [&]() {
+    std::vector<std::string> files;
+    EXPECT_OK(env_->GetChildren(dbname_, &files));
+    int count = 0;
+    for (const auto& f : files) {
+      if (f.size() > kPreparedLogFileSuffix.size() &&
+          f.compare(f.size() - kPreparedLogFileSuffix.size(),
+                    kPreparedLogFileSuffix.size(),
+                    kPreparedLogFileSuffix) == 0) {
+        count++;
+      }
+    }
+    return count;
+  };
+
+  // The pool is filled lazily, starting with the first WAL switch
+  ASSERT_EQ(count_prepared_files(), 0);
+  ASSERT_OK(Put("key1", "val1"));
+  ASSERT_OK(Flush());
+  ASSERT_OK(dbfull()->TEST_WaitForWalPrepare());
+  ASSERT_EQ(count_prepared_files(), 2);
+
+  // The next switch adopts a prepared file by rename and tops the pool
+  // back up
+  ASSERT_OK(Put("key2", "val2"));
+  ASSERT_OK(Flush());
+  ASSERT_OK(dbfull()->TEST_WaitForWalPrepare());
+  ASSERT_EQ(count_prepared_files(), 2);
+  ASSERT_EQ("val2", Get("key2"));
+
+  // Leftover prepared files are cleaned up on reopen, then the pool is
+  // rebuilt after the next switch
+  Reopen(options);
+  ASSERT_EQ(count_prepared_files(), 0);
+  ASSERT_EQ("val1", Get("key1"));
+  ASSERT_EQ("val2", Get("key2"));
+  ASSERT_OK(Put("key3", "val3"));
+  ASSERT_OK(Flush());
+  ASSERT_OK(dbfull()->TEST_WaitForWalPrepare());
+  ASSERT_EQ(count_prepared_files(), 2);
+}
+
+TEST_F(DBWALTest, DsyncWal) {
+  Options options = CurrentOptions();
+  options.use_dsync_for_wal = true;
+  options.allow_mmap_writes = false;
+  DestroyAndReopen(options);
+
+  WriteOptions wo;
+  wo.sync = true;
+  ASSERT_OK(db_->Put(wo, "key1", "val1"));
+  ASSERT_OK(db_->Put(wo, "key2", "val2"));
+  ASSERT_EQ("val1", Get("key1"));
+
+  // Recovery reads the dsync WAL like any other
+  Reopen(options);
+  ASSERT_EQ("val1", Get("key1"));
+  ASSERT_EQ("val2", Get("key2"));
+
+  // Recycled WALs are reopened with the same flags
+  options.recycle_log_file_num = 1;
+  Reopen(options);
+  ASSERT_OK(Put("key3", "val3"));
+  ASSERT_OK(Flush());
+  ASSERT_OK(db_->Put(wo, "key4", "val4"));
+  Reopen(options);
+  ASSERT_EQ("val3", Get("key3"));
+  ASSERT_EQ("val4", Get("key4"));
+}
+
 TEST_F(DBWALTest, DISABLED_RecycleMultipleWalsCrash) {
   Options options = CurrentOptions();
   options.max_write_buffer_number = 5;
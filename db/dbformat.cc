@@ -8,6 +8,7 @@
 // found in the LICENSE file. See the AUTHORS file for names of contributors.
 #include "db/dbformat.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstdio>
 
@@ -272,10 +273,13 @@ void IterKey::EnlargeBuffer(size_t key_size) {
   // If size is smaller than buffer size, continue using current buffer,
   // or the inline one, as default
   assert(key_size > buf_size_);
-  // Need to enlarge the buffer.
+  // Need to enlarge the buffer. Grow at least geometrically so that a
+  // workload whose key sizes creep upward settles after O(log n)
+  // reallocations instead of one per new maximum.
+  const size_t new_size = std::max(key_size, buf_size_ * 2);
   ResetBuffer();
-  buf_ = new char[key_size];
-  buf_size_ = key_size;
+  buf_ = new char[new_size];
+  buf_size_ = new_size;
 }
 
 void IterKey::EnlargeSecondaryBufferIfNeeded(size_t key_size) {
@@ -284,9 +288,11 @@ void IterKey::EnlargeSecondaryBufferIfNeeded(size_t key_size) {
   if (key_size <= secondary_buf_size_) {
     return;
   }
-  // Need to enlarge the secondary buffer.
+  // Need to enlarge the secondary buffer. See EnlargeBuffer() for the
+  // rationale behind the geometric growth.
+  const size_t new_size = std::max(key_size, secondary_buf_size_ * 2);
   ResetSecondaryBuffer();
-  secondary_buf_ = new char[key_size];
-  secondary_buf_size_ = key_size;
+  secondary_buf_ = new char[new_size];
+  secondary_buf_size_ = new_size;
 }
 }  // namespace ROCKSDB_NAMESPACE
@@ -809,6 +809,9 @@ class IterKey {
     key_size_ = size;
   }
 
+  // Current capacity of the primary buffer, including the inline space.
+  size_t BufferCapacity() const { return buf_size_; }
+
   void SetInternalKey(const ParsedInternalKey& parsed_key) {
     SetInternalKey(Slice(), parsed_key);
   }
@@ -433,6 +433,9 @@ Status FlushJob::MemPurge() {
   assert(!memtables.empty());
   SequenceNumber first_seqno = kMaxSequenceNumber;
   SequenceNumber earliest_seqno = kMaxSequenceNumber;
+  // Total memory usage of the mempurged memtables, for outcome feedback to
+  // the mempurge admission model.
+  uint64_t input_memory_usage = 0;
   // Pick first and earliest seqno as min of all first_seqno
   // and earliest_seqno of the mempurged memtables.
   for (const auto& mem : mems_) {
@@ -442,6 +445,7 @@ Status FlushJob::MemPurge() {
     earliest_seqno = mem->GetEarliestSequenceNumber() < earliest_seqno
                          ? mem->GetEarliestSequenceNumber()
                          : earliest_seqno;
+    input_memory_usage += mem->ApproximateMemoryUsage();
   }
 
   ScopedArenaPtr<InternalIterator> iter(
@@ -665,6 +669,23 @@ Status FlushJob::MemPurge() {
   } else {
     TEST_SYNC_POINT("DBImpl::FlushJob:MemPurgeUnsuccessful");
   }
+  if (input_memory_usage > 0) {
+    if (s.ok()) {
+      // Outcome feedback for the mempurge admission model: the fraction of
+      // the input memtable memory that did not survive the rewrite.
+      const uint64_t surviving_memory_usage =
+          new_mem != nullptr ? new_mem->ApproximateMemoryUsage() : 0;
+      cfd_->UpdateMemtableGarbageRatio(
+          surviving_memory_usage >= input_memory_usage
+              ? 0.0
+              : (input_memory_usage - surviving_memory_usage) * 1.0 /
+                    input_memory_usage);
+    } else if (s.IsAborted()) {
+      // The rewrite did not fit in one memtable: record that little garbage
+      // was found, so future admissions are less optimistic.
+      cfd_->UpdateMemtableGarbageRatio(0.0);
+    }
+  }
   const uint64_t micros = clock_->NowMicros() - start_micros;
   const uint64_t cpu_micros = clock_->CPUMicros() - start_cpu_micros;
   ROCKS_LOG_INFO(db_options_.info_log,
@@ -686,6 +707,36 @@ bool FlushJob::MemPurgeDecider(double threshold) {
   if (threshold > (1.0 * mems_.size())) {
     return true;
   }
+  // Learned admission model: the garbage ratio measured on this column
+  // family's past flushes and mempurges (see
+  // ColumnFamilyData::UpdateMemtableGarbageRatio) predicts how much of the
+  // current memtables would survive a rewrite. When that prediction falls
+  // decisively on one side of the threshold, decide without the sampling
+  // pass below; borderline predictions (and column families with no history
+  // yet) still go through sampling, which is more precise.
+  const double learned_garbage_ratio = cfd_->GetMemtableGarbageRatio();
+  if (learned_garbage_ratio >= 0.0) {
+    uint64_t total_memory_usage = 0;
+    for (ReadOnlyMemTable* mt : mems_) {
+      total_memory_usage += mt->ApproximateMemoryUsage();
+    }
+    const double predicted_useful_fraction =
+        (1.0 - learned_garbage_ratio) * total_memory_usage /
+        mutable_cf_options_.write_buffer_size;
+    constexpr double kPredictionMargin = 0.2;
+    if (predicted_useful_fraction < threshold * (1.0 - kPredictionMargin) ||
+        predicted_useful_fraction > threshold * (1.0 + kPredictionMargin)) {
+      ROCKS_LOG_INFO(db_options_.info_log,
+                     "Mempurge learned admission [CF %s] - learned garbage "
+                     "ratio: %f, predicted useful fraction: %f, threshold: "
+                     "%f. %s without sampling.\n",
+                     cfd_->GetName().c_str(), learned_garbage_ratio,
+                     predicted_useful_fraction, threshold,
+                     predicted_useful_fraction < threshold ? "MemPurge"
+                                                           : "Flush");
+      return predicted_useful_fraction < threshold;
+    }
+  }
   // Payload and useful_payload (in bytes).
   // The useful payload ratio of a given MemTable
   // is estimated to be useful_payload/payload.
@@ -759,13 +810,14 @@ bool FlushJob::MemPurgeDecider(double threshold) {
       sqno = 0;
 
       // Pick the oldest existing snapshot that is more recent
-      // than the sequence number of the sampled entry.
-      min_seqno_snapshot = kMaxSequenceNumber;
-      for (SequenceNumber seq_num : existing_snapshots_) {
-        if (seq_num > res.sequence && seq_num < min_seqno_snapshot) {
-          min_seqno_snapshot = seq_num;
-        }
-      }
+      // than the sequence number of the sampled entry. existing_snapshots_
+      // is sorted in increasing order.
+      auto snap_iter = std::upper_bound(existing_snapshots_.begin(),
+                                        existing_snapshots_.end(),
+                                        res.sequence);
+      min_seqno_snapshot = snap_iter != existing_snapshots_.end()
+                               ? *snap_iter
+                               : kMaxSequenceNumber;
       min_snapshot.number_ = min_seqno_snapshot;
       ro.snapshot =
           min_seqno_snapshot < kMaxSequenceNumber ? &min_snapshot : nullptr;
@@ -881,8 +933,10 @@ Status FlushJob::WriteLevel0Table() {
     // memtable and its associated range deletion memtable, respectively, at
     // corresponding indexes.
     std::vector<InternalIterator*> memtables;
+    memtables.reserve(mems_.size());
     std::vector<std::unique_ptr<FragmentedRangeTombstoneIterator>>
         range_del_iters;
+    range_del_iters.reserve(mems_.size());
     ReadOptions ro;
     ro.total_order_seek = true;
     ro.io_activity = Env::IOActivity::kFlush;
@@ -1033,6 +1087,11 @@ Status FlushJob::WriteLevel0Table() {
                    memtable_payload_bytes);
         RecordTick(stats_, MEMTABLE_GARBAGE_BYTES_AT_FLUSH,
                    memtable_garbage_bytes);
+        if (s.ok() && memtable_payload_bytes > 0) {
+          // Outcome feedback for the mempurge admission model
+          cfd_->UpdateMemtableGarbageRatio(memtable_garbage_bytes * 1.0 /
+                                           memtable_payload_bytes);
+        }
       }
       LogFlush(db_options_.info_log);
     }
@@ -291,6 +291,7 @@ static const std::string min_obsolete_sst_number_to_keep_str =
 static const std::string base_level_str = "base-level";
 static const std::string total_sst_files_size = "total-sst-files-size";
 static const std::string live_sst_files_size = "live-sst-files-size";
+static const std::string max_live_sst_seqno = "max-live-sst-seqno";
 static const std::string obsolete_sst_files_size = "obsolete-sst-files-size";
 static const std::string live_sst_files_size_at_temperature =
     "live-sst-files-size-at-temperature";
@@ -399,6 +400,8 @@ const std::string DB::Properties::kTotalSstFilesSize =
     rocksdb_prefix + total_sst_files_size;
 const std::string DB::Properties::kLiveSstFilesSize =
     rocksdb_prefix + live_sst_files_size;
+const std::string DB::Properties::kMaxLiveSstSeqno =
+    rocksdb_prefix + max_live_sst_seqno;
 const std::string DB::Properties::kObsoleteSstFilesSize =
     rocksdb_prefix + obsolete_sst_files_size;
 const std::string DB::Properties::kBaseLevel = rocksdb_prefix + base_level_str;
@@ -569,6 +572,9 @@ const UnorderedMap<std::string, DBPropertyInfo>
         {DB::Properties::kLiveSstFilesSize,
          {false, nullptr, &InternalStats::HandleLiveSstFilesSize, nullptr,
           nullptr}},
+        {DB::Properties::kMaxLiveSstSeqno,
+         {true, nullptr, &InternalStats::HandleMaxLiveSstSeqno, nullptr,
+          nullptr}},
         {DB::Properties::kLiveSstFilesSizeAtTemperature,
          {false, &InternalStats::HandleLiveSstFilesSizeAtTemperature, nullptr,
           nullptr, nullptr}},
@@ -640,6 +646,7 @@ InternalStats::InternalStats(int num_levels, SystemClock* clock,
       cf_stats_count_{},
       comp_stats_(num_levels),
       comp_stats_by_pri_(Env::Priority::TOTAL),
+      comp_cost_per_byte_(num_levels, 0.0),
       file_read_latency_(num_levels),
       has_cf_change_since_dump_(true),
       bg_error_count_(0),
@@ -1421,6 +1428,19 @@ bool InternalStats::HandleLiveSstFilesSize(uint64_t* value, DBImpl* /*db*/,
   return true;
 }
 
+bool InternalStats::HandleMaxLiveSstSeqno(uint64_t* value, DBImpl* /*db*/,
+                                          Version* version) {
+  const auto* vstorage = version->storage_info();
+  SequenceNumber max_seqno = 0;
+  for (int level = 0; level < vstorage->num_levels(); level++) {
+    for (const auto* file : vstorage->LevelFiles(level)) {
+      max_seqno = std::max(max_seqno, file->fd.largest_seqno);
+    }
+  }
+  *value = max_seqno;
+  return true;
+}
+
 bool InternalStats::HandleObsoleteSstFilesSize(uint64_t* value, DBImpl* db,
                                                Version* /*version*/) {
   *value = db->GetObsoleteSstFilesSize();
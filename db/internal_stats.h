@@ -543,6 +543,7 @@ class InternalStats {
     for (auto& comp_stat : comp_stats_) {
       comp_stat.Clear();
     }
+    std::fill(comp_cost_per_byte_.begin(), comp_cost_per_byte_.end(), 0.0);
     per_key_placement_comp_stats_.Clear();
     for (auto& h : file_read_latency_) {
       h.Clear();
@@ -559,6 +560,7 @@ class InternalStats {
                           const CompactionStats& stats) {
     comp_stats_[level].Add(stats);
     comp_stats_by_pri_[thread_pri].Add(stats);
+    UpdateCompactionCostPerByte(level, stats);
   }
 
   void AddCompactionStats(int level, Env::Priority thread_pri,
@@ -573,6 +575,21 @@ class InternalStats {
     comp_stats_[level].bytes_moved += amount;
   }
 
+  // EWMA of measured compaction cost, in microseconds of work per input
+  // byte, for compactions outputting to `level` (same indexing as
+  // comp_stats_). Wall clock and CPU time are blended by taking whichever
+  // is larger per compaction, so the dominating resource drives the
+  // estimate. Returns 0 when no compaction has finished for the level yet.
+  // Used by the level compaction picker to prefer the candidate with the
+  // best debt reduction per unit of work. Must be called under the DB
+  // mutex, like AddCompactionStats().
+  double GetCompactionCostPerByte(int level) const {
+    if (level < 0 || level >= static_cast<int>(comp_cost_per_byte_.size())) {
+      return 0.0;
+    }
+    return comp_cost_per_byte_[level];
+  }
+
   void AddCFStats(InternalCFStatsType type, uint64_t value) {
     has_cf_change_since_dump_ = true;
     cf_stats_value_[type] += value;
@@ -698,8 +715,29 @@ class InternalStats {
   std::shared_ptr<CacheEntryStatsCollector<CacheEntryRoleStats>>
       cache_entry_stats_collector_;
   // Per-ColumnFamily/level compaction stats
+  void UpdateCompactionCostPerByte(int level, const CompactionStats& stats) {
+    uint64_t input_bytes = stats.bytes_read_non_output_levels +
+                           stats.bytes_read_output_level +
+                           stats.bytes_read_blob;
+    if (input_bytes == 0 || level < 0 ||
+        level >= static_cast<int>(comp_cost_per_byte_.size())) {
+      return;
+    }
+    double sample = static_cast<double>(std::max(stats.micros, stats.cpu_micros)) /
+                    static_cast<double>(input_bytes);
+    double& cost = comp_cost_per_byte_[level];
+    if (cost == 0.0) {
+      cost = sample;
+    } else {
+      cost += kCompactionCostSmoothing * (sample - cost);
+    }
+  }
+
   std::vector<CompactionStats> comp_stats_;
   std::vector<CompactionStats> comp_stats_by_pri_;
+  // See GetCompactionCostPerByte().
+  static constexpr double kCompactionCostSmoothing = 0.25;
+  std::vector<double> comp_cost_per_byte_;
   CompactionStats per_key_placement_comp_stats_;
   std::vector<HistogramImpl> file_read_latency_;
   HistogramImpl blob_file_read_latency_;
@@ -864,6 +902,7 @@ class InternalStats {
   bool HandleBaseLevel(uint64_t* value, DBImpl* db, Version* version);
   bool HandleTotalSstFilesSize(uint64_t* value, DBImpl* db, Version* version);
   bool HandleLiveSstFilesSize(uint64_t* value, DBImpl* db, Version* version);
+  bool HandleMaxLiveSstSeqno(uint64_t* value, DBImpl* db, Version* version);
   bool HandleObsoleteSstFilesSize(uint64_t* value, DBImpl* db,
                                   Version* version);
   bool HandleEstimatePendingCompactionBytes(uint64_t* value, DBImpl* db,
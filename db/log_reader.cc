@@ -644,6 +644,29 @@ uint8_t Reader::ReadPhysicalRecord(Slice* result, size_t* drop_size,
       return type;
     } else {
       // Uncompress compressed records
+      size_t uncompressed_size = 0;
+      int remaining = 0;
+      const char* input = header + header_size;
+      remaining = uncompress_->Uncompress(
+          input, length, uncompressed_buffer_.get(), &uncompressed_size);
+      if (remaining < 0) {
+        buffer_.clear();
+        return kBadRecord;
+      }
+      if (remaining == 0 && uncompressed_size < kBlockSize) {
+        // Common case: the whole fragment decompressed into a single chunk.
+        // Return a slice over the decompression buffer instead of copying it
+        // into uncompressed_record_. The buffer is not touched again until
+        // the next physical record is decompressed, which matches the
+        // lifetime uncompressed_record_ would have.
+        if (fragment_checksum != nullptr) {
+          *fragment_checksum =
+              XXH3_64bits(uncompressed_buffer_.get(), uncompressed_size);
+        }
+        *result = Slice(uncompressed_buffer_.get(), uncompressed_size);
+        return type;
+      }
+
       uncompressed_record_.clear();
       if (fragment_checksum != nullptr) {
         if (uncompress_hash_state_ == nullptr) {
@@ -652,17 +675,7 @@ uint8_t Reader::ReadPhysicalRecord(Slice* result, size_t* drop_size,
         XXH3_64bits_reset(uncompress_hash_state_);
       }
 
-      size_t uncompressed_size = 0;
-      int remaining = 0;
-      const char* input = header + header_size;
       do {
-        remaining = uncompress_->Uncompress(
-            input, length, uncompressed_buffer_.get(), &uncompressed_size);
-        input = nullptr;
-        if (remaining < 0) {
-          buffer_.clear();
-          return kBadRecord;
-        }
         if (uncompressed_size > 0) {
           if (fragment_checksum != nullptr) {
             XXH3_64bits_update(uncompress_hash_state_,
@@ -671,7 +684,16 @@ uint8_t Reader::ReadPhysicalRecord(Slice* result, size_t* drop_size,
           uncompressed_record_.append(uncompressed_buffer_.get(),
                                       uncompressed_size);
         }
-      } while (remaining > 0 || uncompressed_size == kBlockSize);
+        if (remaining == 0 && uncompressed_size < kBlockSize) {
+          break;
+        }
+        remaining = uncompress_->Uncompress(
+            nullptr, length, uncompressed_buffer_.get(), &uncompressed_size);
+        if (remaining < 0) {
+          buffer_.clear();
+          return kBadRecord;
+        }
+      } while (true);
 
       if (fragment_checksum != nullptr) {
         // We can remove this check by updating hash_state_ directly,
@@ -1043,24 +1065,41 @@ bool FragmentBufferedReader::TryReadFragment(Slice* fragment, size_t* drop_size,
     return true;
   } else {
     // Uncompress compressed records
-    uncompressed_record_.clear();
     size_t uncompressed_size = 0;
     int remaining = 0;
     const char* input = header + header_size;
+    remaining = uncompress_->Uncompress(
+        input, length, uncompressed_buffer_.get(), &uncompressed_size);
+    if (remaining < 0) {
+      buffer_.clear();
+      *fragment_type_or_err = kBadRecord;
+      return true;
+    }
+    if (remaining == 0 && uncompressed_size < kBlockSize) {
+      // Common case: single chunk of output. Skip the copy into
+      // uncompressed_record_ (see Reader::ReadPhysicalRecord).
+      *fragment = Slice(uncompressed_buffer_.get(), uncompressed_size);
+      *fragment_type_or_err = type;
+      return true;
+    }
+    uncompressed_record_.clear();
     do {
-      remaining = uncompress_->Uncompress(
-          input, length, uncompressed_buffer_.get(), &uncompressed_size);
-      input = nullptr;
+      if (uncompressed_size > 0) {
+        uncompressed_record_.append(uncompressed_buffer_.get(),
+                                    uncompressed_size);
+      }
+      if (remaining == 0 && uncompressed_size < kBlockSize) {
+        break;
+      }
+      remaining = uncompress_->Uncompress(nullptr, length,
+                                          uncompressed_buffer_.get(),
+                                          &uncompressed_size);
       if (remaining < 0) {
         buffer_.clear();
         *fragment_type_or_err = kBadRecord;
         return true;
       }
-      if (uncompressed_size > 0) {
-        uncompressed_record_.append(uncompressed_buffer_.get(),
-                                    uncompressed_size);
-      }
-    } while (remaining > 0 || uncompressed_size == kBlockSize);
+    } while (true);
     *fragment = Slice(std::move(uncompressed_record_));
     *fragment_type_or_err = type;
     return true;
@@ -38,6 +38,19 @@ Writer::Writer(std::unique_ptr<WritableFileWriter>&& dest, uint64_t log_number,
     char t = static_cast<char>(i);
     type_crc_[i] = crc32c::Value(&t, 1);
   }
+  // Recyclable records always checksum the same 4-byte encoded log number
+  // right after the type byte, so fold its contribution into the precomputed
+  // type crcs once instead of re-extending over it for every physical record.
+  char encoded_log_number[4];
+  EncodeFixed32(encoded_log_number, static_cast<uint32_t>(log_number_));
+  for (uint8_t i = kRecyclableFullType; i <= kMaxRecordType; i++) {
+    if (i == kSetCompressionType || i == kUserDefinedTimestampSizeType ||
+        i == kPredecessorWALInfoType) {
+      // Legacy record format; no log number in the header.
+      continue;
+    }
+    type_crc_[i] = crc32c::Extend(type_crc_[i], encoded_log_number, 4);
+  }
 }
 
 Writer::~Writer() {
@@ -337,7 +350,7 @@ IOStatus Writer::EmitPhysicalRecord(const WriteOptions& write_options,
     // even if it were we'dbe far more likely to see a false positive
     // on the 32-bit CRC.
     EncodeFixed32(buf + 7, static_cast<uint32_t>(log_number_));
-    crc = crc32c::Extend(crc, buf + 7, 4);
+    // The log number's crc contribution is already folded into type_crc_.
   }
 
   // Compute the crc of the record type and the payload.
@@ -550,11 +550,18 @@ class MemTable final : public ReadOnlyMemTable {
   // If the earliest sequence number is not known, kMaxSequenceNumber may be
   // used, but this may prevent some transactions from succeeding until the
   // first key is inserted into the memtable.
+  // prev_num_entries_hint, if > 0, is the number of entries the previous
+  // memtable of this column family accumulated before being switched out.
+  // It is used to right-size the prefix bloom filter: the fixed size derived
+  // from memtable_prefix_bloom_size_ratio assumes small keys and values and
+  // can be megabytes larger than the number of entries a memtable actually
+  // holds warrants, which hurts probe locality. 0 means no hint.
   explicit MemTable(const InternalKeyComparator& comparator,
                     const ImmutableOptions& ioptions,
                     const MutableCFOptions& mutable_cf_options,
                     WriteBufferManager* write_buffer_manager,
-                    SequenceNumber earliest_seq, uint32_t column_family_id);
+                    SequenceNumber earliest_seq, uint32_t column_family_id,
+                    uint64_t prev_num_entries_hint = 0);
   // No copying allowed
   MemTable(const MemTable&) = delete;
   MemTable& operator=(const MemTable&) = delete;
@@ -886,6 +893,21 @@ class MemTable final : public ReadOnlyMemTable {
   // Insert hints for each prefix.
   UnorderedMapH<Slice, void*, SliceHasher32> insert_hints_;
 
+  // The insert_hints_ slot used by the most recent insert, so that runs of
+  // inserts sharing a prefix (e.g. sequential time-series appends) skip the
+  // hash lookup. The cached pointer stays valid because insert_hints_ is
+  // only mutated when the prefix changes, which refreshes the cache. Only
+  // accessed on the non-concurrent insert path, which is externally
+  // synchronized by the write thread.
+  Slice last_insert_hint_prefix_;
+  void** last_insert_hint_ = nullptr;
+
+  // Insert hint for the dedicated range-del table, so that sorted runs of
+  // range tombstones append in amortized O(1). Only accessed on the
+  // non-concurrent insert path, which is externally synchronized by the
+  // write thread.
+  void* range_del_insert_hint_ = nullptr;
+
   // Timestamp of oldest key
   std::atomic<uint64_t> oldest_key_time_;
 
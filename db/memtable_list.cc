@@ -24,6 +24,7 @@
 #include "table/merging_iterator.h"
 #include "test_util/sync_point.h"
 #include "util/coding.h"
+#include "util/mutexlock.h"
 
 namespace ROCKSDB_NAMESPACE {
 
@@ -109,11 +110,78 @@ bool MemTableListVersion::Get(const LookupKey& key, std::string* value,
                               SequenceNumber* max_covering_tombstone_seq,
                               SequenceNumber* seq, const ReadOptions& read_opts,
                               ReadCallback* callback, bool* is_blob_index) {
+  if (memlist_.size() > 1 && !read_opts.ignore_range_deletions &&
+      memlist_.front()
+              ->GetInternalKeyComparator()
+              .user_comparator()
+              ->timestamp_size() == 0) {
+    // With more than one immutable memtable, probe the cached union of their
+    // range tombstones once instead of searching each memtable's fragmented
+    // tombstone list (and heap-allocating an iterator for it) per memtable.
+    SequenceNumber covering_seq = MaxCoveringTombstoneSeqnumFromUnion(
+        key.user_key(), GetInternalKeySeqno(key.internal_key()));
+    if (covering_seq > *max_covering_tombstone_seq) {
+      *max_covering_tombstone_seq = covering_seq;
+    }
+    // The union already accounts for every tombstone in memlist_, so tell the
+    // per-memtable Get()s to skip their own range tombstone lookups.
+    ReadOptions skip_tombstones = read_opts;
+    skip_tombstones.ignore_range_deletions = true;
+    return GetFromList(&memlist_, key, value, columns, timestamp, s,
+                       merge_context, max_covering_tombstone_seq, seq,
+                       skip_tombstones, callback, is_blob_index);
+  }
   return GetFromList(&memlist_, key, value, columns, timestamp, s,
                      merge_context, max_covering_tombstone_seq, seq, read_opts,
                      callback, is_blob_index);
 }
 
+SequenceNumber MemTableListVersion::MaxCoveringTombstoneSeqnumFromUnion(
+    const Slice& user_key, SequenceNumber read_seq) const {
+  if (!tombstone_union_built_.load(std::memory_order_acquire)) {
+    BuildTombstoneUnion();
+  }
+  if (tombstone_union_ == nullptr || tombstone_union_->empty()) {
+    return 0;
+  }
+  assert(!memlist_.empty());
+  FragmentedRangeTombstoneIterator iter(
+      tombstone_union_.get(), memlist_.front()->GetInternalKeyComparator(),
+      read_seq);
+  return iter.MaxCoveringTombstoneSeqnum(user_key);
+}
+
+void MemTableListVersion::BuildTombstoneUnion() const {
+  MutexLock l(&tombstone_union_mu_);
+  if (tombstone_union_built_.load(std::memory_order_relaxed)) {
+    // Another reader built it while we waited for the mutex.
+    return;
+  }
+  assert(tombstone_union_ == nullptr);
+  std::vector<InternalIterator*> iters;
+  for (auto& m : memlist_) {
+    auto* range_del_iter = m->NewRangeTombstoneIterator(
+        ReadOptions(), kMaxSequenceNumber, true /* immutable_memtable */);
+    if (range_del_iter != nullptr) {
+      iters.push_back(range_del_iter);
+    }
+  }
+  if (!iters.empty()) {
+    const InternalKeyComparator& icmp =
+        memlist_.front()->GetInternalKeyComparator();
+    // The merging iterator takes ownership of the per-memtable iterators. A
+    // FragmentedRangeTombstoneIterator emits each (fragment, seqno) pair as a
+    // start internal key / end user key entry, which is exactly the form the
+    // fragmenter accepts as input (the same way compaction feeds SST range
+    // tombstone blocks), so re-fragmenting the merged stream yields the union.
+    std::unique_ptr<InternalIterator> merged(NewMergingIterator(
+        &icmp, iters.data(), static_cast<int>(iters.size())));
+    tombstone_union_ =
+        std::make_unique<FragmentedRangeTombstoneList>(std::move(merged), icmp);
+  }
+  tombstone_union_built_.store(true, std::memory_order_release);
+}
+
 void MemTableListVersion::MultiGet(const ReadOptions& read_options,
                                    MultiGetRange* range,
                                    ReadCallback* callback) {
@@ -307,6 +375,10 @@ SequenceNumber MemTableListVersion::GetFirstSequenceNumber() const {
 void MemTableListVersion::Add(ReadOnlyMemTable* m,
                               autovector<ReadOnlyMemTable*>* to_delete) {
   assert(refs_ == 1);  // only when refs_ == 1 is MemTableListVersion mutable
+  // No reader holds this version, so the cached tombstone union can be
+  // discarded without synchronization beyond the store below.
+  tombstone_union_built_.store(false, std::memory_order_relaxed);
+  tombstone_union_.reset();
   AddMemTable(m);
   // m->MemoryAllocatedBytes() is added in MemoryAllocatedBytesExcludingLast
   TrimHistory(to_delete, 0);
@@ -316,6 +388,8 @@ void MemTableListVersion::Add(ReadOnlyMemTable* m,
 void MemTableListVersion::Remove(ReadOnlyMemTable* m,
                                  autovector<ReadOnlyMemTable*>* to_delete) {
   assert(refs_ == 1);  // only when refs_ == 1 is MemTableListVersion mutable
+  tombstone_union_built_.store(false, std::memory_order_relaxed);
+  tombstone_union_.reset();
   memlist_.remove(m);
 
   m->MarkFlushed();
@@ -687,12 +761,8 @@ bool MemTableList::TrimHistory(autovector<ReadOnlyMemTable*>* to_delete,
 }
 
 // Returns an estimate of the number of bytes of data in use.
-size_t MemTableList::ApproximateUnflushedMemTablesMemoryUsage() {
-  size_t total_size = 0;
-  for (auto& memtable : current_->memlist_) {
-    total_size += memtable->ApproximateMemoryUsage();
-  }
-  return total_size;
+size_t MemTableList::ApproximateUnflushedMemTablesMemoryUsage() const {
+  return current_unflushed_memory_usage_.load(std::memory_order_relaxed);
 }
 
 size_t MemTableList::ApproximateMemoryUsage() { return current_memory_usage_; }
@@ -714,6 +784,15 @@ void MemTableList::UpdateCachedValuesFromMemTableListVersion() {
   current_memory_allocted_bytes_excluding_last_.store(
       total_memtable_size, std::memory_order_relaxed);
 
+  // Immutable memtables no longer grow, so their aggregate usage only
+  // changes at the add/install/trim boundaries that call here.
+  size_t unflushed_usage = 0;
+  for (auto& memtable : current_->memlist_) {
+    unflushed_usage += memtable->ApproximateMemoryUsage();
+  }
+  current_unflushed_memory_usage_.store(unflushed_usage,
+                                        std::memory_order_relaxed);
+
   const bool has_history = current_->HasHistory();
   current_has_history_.store(has_history, std::memory_order_relaxed);
 }
@@ -15,6 +15,7 @@
 #include "db/logs_with_prep_tracker.h"
 #include "db/memtable.h"
 #include "db/range_del_aggregator.h"
+#include "db/range_tombstone_fragmenter.h"
 #include "file/filename.h"
 #include "logging/log_buffer.h"
 #include "monitoring/instrumented_mutex.h"
@@ -189,6 +190,17 @@ class MemTableListVersion {
   void UnrefMemTable(autovector<ReadOnlyMemTable*>* to_delete,
                      ReadOnlyMemTable* m);
 
+  // Returns the max seqno of any range tombstone in the memtables of memlist_
+  // that covers `user_key` and is visible at `read_seq`, or 0 if there is
+  // none. Probes the union of the memtables' fragmented tombstone lists,
+  // building it on first use, so a Get() pays one covering-tombstone search
+  // for the whole list instead of one per memtable.
+  SequenceNumber MaxCoveringTombstoneSeqnumFromUnion(
+      const Slice& user_key, SequenceNumber read_seq) const;
+
+  // Builds tombstone_union_ from the memtables in memlist_.
+  void BuildTombstoneUnion() const;
+
   // Calculate the total amount of memory used by memlist_ and memlist_history_
   // excluding the last MemTable in memlist_history_. The reason for excluding
   // the last MemTable is to see if dropping the last MemTable will keep total
@@ -208,6 +220,15 @@ class MemTableListVersion {
   // (used during Transaction validation)
   std::list<ReadOnlyMemTable*> memlist_history_;
 
+  // Union of the range tombstones in the memtables of memlist_, re-fragmented
+  // into a single list. Built lazily under tombstone_union_mu_ by the first
+  // read that wants it; nullptr with tombstone_union_built_ set means none of
+  // the memtables has tombstones. Add() and Remove() discard it, which is
+  // safe because they only run when no reader holds this version (refs_ == 1).
+  mutable port::Mutex tombstone_union_mu_;
+  mutable std::atomic<bool> tombstone_union_built_{false};
+  mutable std::unique_ptr<FragmentedRangeTombstoneList> tombstone_union_;
+
   // Maximum size of MemTables to keep in memory (including both flushed
   // and not-yet-flushed tables).
   const int64_t max_write_buffer_size_to_maintain_;
@@ -246,6 +267,7 @@ class MemTableList {
         flush_requested_(false),
         current_memory_usage_(0),
         current_memory_allocted_bytes_excluding_last_(0),
+        current_unflushed_memory_usage_(0),
         current_has_history_(false),
         last_memtable_list_version_id_(0) {
     current_->Ref();
@@ -343,8 +365,10 @@ class MemTableList {
   bool TrimHistory(autovector<ReadOnlyMemTable*>* to_delete, size_t usage);
 
   // Returns an estimate of the number of bytes of data used by
-  // the unflushed mem-tables.
-  size_t ApproximateUnflushedMemTablesMemoryUsage();
+  // the unflushed mem-tables. Returns a cached aggregate maintained at
+  // memtable add/install/trim boundaries, so it is safe to call without
+  // holding the DB mutex.
+  size_t ApproximateUnflushedMemTablesMemoryUsage() const;
 
   // Returns an estimate of the timestamp of the earliest key.
   uint64_t ApproximateOldestKeyTime() const;
@@ -512,6 +536,11 @@ class MemTableList {
   // Cached value of current_->MemoryAllocatedBytesExcludingLast().
   std::atomic<size_t> current_memory_allocted_bytes_excluding_last_;
 
+  // Cached sum of ApproximateMemoryUsage() over the memtables in the
+  // current version that are not yet flushed. Lets property polling read
+  // the aggregate with a relaxed load instead of walking the list.
+  std::atomic<size_t> current_unflushed_memory_usage_;
+
   // Cached value of current_->HasHistory().
   std::atomic<bool> current_has_history_;
 
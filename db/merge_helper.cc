@@ -15,6 +15,7 @@
 #include "db/wide/wide_columns_helper.h"
 #include "logging/logging.h"
 #include "monitoring/perf_context_imp.h"
+#include "monitoring/query_timeline_imp.h"
 #include "monitoring/statistics_impl.h"
 #include "port/likely.h"
 #include "rocksdb/comparator.h"
@@ -87,6 +88,7 @@ Status MergeHelper::TimedFullMergeCommonImpl(
     RecordTick(statistics, MERGE_OPERATION_TOTAL_TIME,
                statistics ? timer.ElapsedNanos() : 0);
   }
+  QUERY_TIMELINE_MARK(kMergeOperands);
 
   if (!success) {
     RecordTick(statistics, NUMBER_MERGE_FAILURES);
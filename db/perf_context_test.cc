@@ -17,6 +17,7 @@
 #include "port/port.h"
 #include "rocksdb/db.h"
 #include "rocksdb/memtablerep.h"
+#include "rocksdb/query_timeline.h"
 #include "rocksdb/slice_transform.h"
 #include "rocksdb/system_clock.h"
 #include "test_util/testharness.h"
@@ -657,6 +658,38 @@ TEST_F(PerfContextTest, ToString) {
   ASSERT_NE(std::string::npos, zero_excluded.find("= 12345"));
 }
 
+TEST_F(PerfContextTest, QueryTimeline) {
+  ASSERT_OK(DestroyDB(kDbName, Options()));
+  auto db = OpenDb();
+  ASSERT_OK(db->Put(WriteOptions(), "foo", "bar"));
+
+  // A Get without trace_timeline must not touch the thread-local timeline.
+  get_query_timeline()->num_entries = 0;
+  std::string value;
+  ASSERT_OK(db->Get(ReadOptions(), "foo", &value));
+  ASSERT_EQ(0, get_query_timeline()->num_entries);
+
+  ReadOptions traced_ro;
+  traced_ro.trace_timeline = true;
+  ASSERT_OK(db->Get(traced_ro, "foo", &value));
+  const QueryTimeline* timeline = get_query_timeline();
+  ASSERT_FALSE(timeline->enabled);
+  ASSERT_GE(timeline->num_entries, 3);
+  ASSERT_EQ(TimelineStage::kQueryStart, timeline->entries[0].stage);
+  ASSERT_EQ(TimelineStage::kQueryEnd,
+            timeline->entries[timeline->num_entries - 1].stage);
+  bool found_memtable_stage = false;
+  for (size_t i = 0; i < timeline->num_entries; ++i) {
+    ASSERT_GE(timeline->entries[i].timestamp_ns,
+              timeline->entries[0].timestamp_ns);
+    if (timeline->entries[i].stage == TimelineStage::kMemtableLookup) {
+      found_memtable_stage = true;
+    }
+  }
+  ASSERT_TRUE(found_memtable_stage);
+  ASSERT_NE(std::string::npos, timeline->ToString().find("memtable_lookup"));
+}
+
 TEST_F(PerfContextTest, MergeOperatorTime) {
   ASSERT_OK(DestroyDB(kDbName, Options()));
   DB* db;
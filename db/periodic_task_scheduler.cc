@@ -26,6 +26,7 @@ static const std::map<PeriodicTaskType, uint64_t> kDefaultPeriodSeconds = {
     {PeriodicTaskType::kPersistStats, kInvalidPeriodSec},
     {PeriodicTaskType::kFlushInfoLog, 10},
     {PeriodicTaskType::kRecordSeqnoTime, kInvalidPeriodSec},
+    {PeriodicTaskType::kPublishStats, kInvalidPeriodSec},
 };
 
 static const std::map<PeriodicTaskType, std::string> kPeriodicTaskTypeNames = {
@@ -33,6 +34,7 @@ static const std::map<PeriodicTaskType, std::string> kPeriodicTaskTypeNames = {
     {PeriodicTaskType::kPersistStats, "pst_st"},
     {PeriodicTaskType::kFlushInfoLog, "flush_info_log"},
     {PeriodicTaskType::kRecordSeqnoTime, "record_seq_time"},
+    {PeriodicTaskType::kPublishStats, "pub_st"},
 };
 
 Status PeriodicTaskScheduler::Register(PeriodicTaskType task_type,
@@ -43,16 +45,26 @@ Status PeriodicTaskScheduler::Register(PeriodicTaskType task_type,
 Status PeriodicTaskScheduler::Register(PeriodicTaskType task_type,
                                        const PeriodicTaskFunc& fn,
                                        uint64_t repeat_period_seconds) {
+  if (repeat_period_seconds == kInvalidPeriodSec) {
+    return Status::InvalidArgument("Invalid task repeat period");
+  }
+  return RegisterMicros(task_type, fn,
+                        repeat_period_seconds * kMicrosInSecond);
+}
+
+Status PeriodicTaskScheduler::RegisterMicros(PeriodicTaskType task_type,
+                                             const PeriodicTaskFunc& fn,
+                                             uint64_t repeat_period_micros) {
   MutexLock l(&timer_mutex);
   static std::atomic<uint64_t> initial_delay(0);
 
-  if (repeat_period_seconds == kInvalidPeriodSec) {
+  if (repeat_period_micros == 0) {
     return Status::InvalidArgument("Invalid task repeat period");
   }
   auto it = tasks_map_.find(task_type);
   if (it != tasks_map_.end()) {
     // the task already exists and it's the same, no update needed
-    if (it->second.repeat_every_sec == repeat_period_seconds) {
+    if (it->second.repeat_every_us == repeat_period_micros) {
       return Status::OK();
     }
     // cancel the existing one before register new one
@@ -65,15 +77,17 @@ Status PeriodicTaskScheduler::Register(PeriodicTaskType task_type,
   std::string unique_id =
       kPeriodicTaskTypeNames.at(task_type) + std::to_string(id_++);
 
+  // Stagger the initial runs so tasks with the same period don't all fire
+  // at once (same intent as the original whole-second staggering).
   bool succeeded = timer_->Add(
       fn, unique_id,
-      (initial_delay.fetch_add(1) % repeat_period_seconds) * kMicrosInSecond,
-      repeat_period_seconds * kMicrosInSecond);
+      (initial_delay.fetch_add(1) * kMicrosInSecond) % repeat_period_micros,
+      repeat_period_micros);
   if (!succeeded) {
     return Status::Aborted("Failed to register periodic task");
   }
   auto result = tasks_map_.try_emplace(
-      task_type, TaskInfo{unique_id, repeat_period_seconds});
+      task_type, TaskInfo{unique_id, repeat_period_micros});
   if (!result.second) {
     return Status::Aborted("Failed to add periodic task");
   }
@@ -21,6 +21,7 @@ enum class PeriodicTaskType : uint8_t {
   kPersistStats,
   kFlushInfoLog,
   kRecordSeqnoTime,
+  kPublishStats,
   kMax,
 };
 
@@ -50,6 +51,12 @@ class PeriodicTaskScheduler {
   Status Register(PeriodicTaskType task_type, const PeriodicTaskFunc& fn,
                   uint64_t repeat_period_seconds);
 
+  // Same as above with the repeat period in microseconds, for tasks that
+  // need sub-second granularity (e.g. stats snapshot publishing). 0 is an
+  // invalid argument. Thread safe call.
+  Status RegisterMicros(PeriodicTaskType task_type, const PeriodicTaskFunc& fn,
+                        uint64_t repeat_period_micros);
+
   // Unregister the task. Thread safe call.
   Status Unregister(PeriodicTaskType task_type);
 
@@ -85,10 +92,10 @@ class PeriodicTaskScheduler {
 
   // Internal structure to store task information
   struct TaskInfo {
-    TaskInfo(std::string _name, uint64_t _repeat_every_sec)
-        : name(std::move(_name)), repeat_every_sec(_repeat_every_sec) {}
+    TaskInfo(std::string _name, uint64_t _repeat_every_us)
+        : name(std::move(_name)), repeat_every_us(_repeat_every_us) {}
     std::string name;
-    uint64_t repeat_every_sec;
+    uint64_t repeat_every_us;
   };
 
   // Internal tasks map
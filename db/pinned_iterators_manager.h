@@ -39,6 +39,13 @@ class PinnedIteratorsManager : public Cleanable {
   // Is pinning enabled ?
   bool PinningEnabled() { return pinning_enabled; }
 
+  // Capacity of the registry. ReleasePinnedData() keeps the allocated
+  // capacity, so this is the high-water number of pinned pointers.
+  size_t Capacity() const { return pinned_ptrs_.capacity(); }
+
+  // Pre-size the registry so the first `n` registrations do not allocate.
+  void Reserve(size_t n) { pinned_ptrs_.reserve(n); }
+
   // Take ownership of iter and delete it when ReleasePinnedData() is called
   void PinIterator(InternalIterator* iter, bool arena = false) {
     if (arena) {
@@ -562,9 +562,10 @@ TEST_F(RangeDelAggregatorTest, CompactionAggregatorNoSnapshots) {
                                       {InternalValue("j", 14), false}});
 
   auto range_del_compaction_iter = range_del_agg.NewIterator();
+  // With no snapshots only the top seqno of each fragment survives, after
+  // which the adjacent [b, c) and [c, e) fragments at seqno 10 coalesce.
   VerifyFragmentedRangeDels(range_del_compaction_iter.get(), {{"a", "b", 20},
-                                                              {"b", "c", 10},
-                                                              {"c", "e", 10},
+                                                              {"b", "e", 10},
                                                               {"e", "g", 8},
                                                               {"h", "i", 25},
                                                               {"ii", "j", 15}});
@@ -209,8 +209,32 @@ void FragmentedRangeTombstoneList::FragmentTombstones(
         // timestamp.
         tombstones_.emplace_back(start_key, end_key, start_idx, end_idx);
       } else {
-        tombstones_.emplace_back(cur_start_key, cur_end_key, start_idx,
-                                 end_idx);
+        // When fragmenting for compaction output, coalesce this fragment
+        // into the previous one if the two are contiguous and carry an
+        // identical sequence number stack. Fragmentation splits tombstones
+        // at every start/end boundary of the input, so DeleteRange-heavy
+        // memtables commonly produce runs of adjacent fragments that
+        // collapse back into one tombstone once obsolete seqnums are
+        // dropped above. Writing the minimal set shrinks the range-del
+        // block and every later read or re-fragmentation of it.
+        bool coalesced = false;
+        if (for_compaction && !tombstones_.empty()) {
+          const RangeTombstoneStack& prev = tombstones_.back();
+          if (icmp.user_comparator()->Compare(prev.end_key, cur_start_key) ==
+                  0 &&
+              prev.seq_end_idx - prev.seq_start_idx == end_idx - start_idx &&
+              std::equal(tombstone_seqs_.begin() + prev.seq_start_idx,
+                         tombstone_seqs_.begin() + prev.seq_end_idx,
+                         tombstone_seqs_.begin() + start_idx)) {
+            tombstones_.back().end_key = cur_end_key;
+            tombstone_seqs_.resize(start_idx);
+            coalesced = true;
+          }
+        }
+        if (!coalesced) {
+          tombstones_.emplace_back(cur_start_key, cur_end_key, start_idx,
+                                   end_idx);
+        }
       }
 
       cur_start_key = cur_end_key;
@@ -336,12 +336,11 @@ TEST_F(RangeTombstoneFragmenterTest, OverlapAndRepeatedStartKeyForCompaction) {
       {} /* snapshots */);
   FragmentedRangeTombstoneIterator iter(&fragment_list, bytewise_icmp,
                                         kMaxSequenceNumber /* upper_bound */);
-  VerifyFragmentedRangeDels(&iter, {{"a", "c", 10},
-                                    {"c", "e", 10},
-                                    {"e", "g", 8},
-                                    {"g", "i", 6},
-                                    {"j", "l", 4},
-                                    {"l", "n", 4}});
+  // Adjacent fragments with equal sequence number stacks are coalesced in
+  // compaction output, e.g. [a, c) and [c, e) at seqno 10 become [a, e).
+  VerifyFragmentedRangeDels(
+      &iter,
+      {{"a", "e", 10}, {"e", "g", 8}, {"g", "i", 6}, {"j", "n", 4}});
 }
 
 TEST_F(RangeTombstoneFragmenterTest,
@@ -357,13 +356,30 @@ TEST_F(RangeTombstoneFragmenterTest,
       {9, 20} /* snapshots */);
   FragmentedRangeTombstoneIterator iter(&fragment_list, bytewise_icmp,
                                         kMaxSequenceNumber /* upper_bound */);
+  // [a, c) at {10} and [c, e) at {10, 8} have different stacks so they stay
+  // split, while [j, l) and [l, n) both carry {4} and are coalesced.
   VerifyFragmentedRangeDels(&iter, {{"a", "c", 10},
                                     {"c", "e", 10},
                                     {"c", "e", 8},
                                     {"e", "g", 8},
                                     {"g", "i", 6},
-                                    {"j", "l", 4},
-                                    {"l", "n", 4}});
+                                    {"j", "n", 4}});
+}
+
+TEST_F(RangeTombstoneFragmenterTest, AdjacentEqualSeqnosCoalescedForCompaction) {
+  auto range_del_iter = MakeRangeDelIter(
+      {{"a", "c", 5}, {"c", "e", 5}, {"e", "g", 5}, {"h", "j", 5}});
+
+  FragmentedRangeTombstoneList fragment_list(
+      std::move(range_del_iter), bytewise_icmp, true /* for_compaction */,
+      {} /* snapshots */);
+  FragmentedRangeTombstoneIterator iter(&fragment_list, bytewise_icmp,
+                                        kMaxSequenceNumber /* upper_bound */);
+  // The contiguous run [a, g) collapses into one tombstone; [h, j) is
+  // separated by a gap and stays on its own.
+  VerifyFragmentedRangeDels(&iter, {{"a", "g", 5}, {"h", "j", 5}});
+  VerifyMaxCoveringTombstoneSeqnum(&iter,
+                                   {{"b", 5}, {"f", 5}, {"g", 0}, {"i", 5}});
 }
 
 TEST_F(RangeTombstoneFragmenterTest, IteratorSplitNoSnapshots) {
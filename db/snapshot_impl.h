@@ -49,6 +49,12 @@ class SnapshotImpl : public Snapshot {
 
   // Will this snapshot be used by a Transaction to do write-conflict checking?
   bool is_write_conflict_boundary_;
+
+  // Number of GetSnapshot() callers sharing this object. When no write has
+  // been published between two GetSnapshot() calls the calls may be handed
+  // the same SnapshotImpl instead of linking a duplicate node into the list.
+  // Only accessed while holding the DB mutex.
+  mutable int64_t refcount_ = 1;
 };
 
 class SnapshotList {
@@ -62,6 +68,7 @@ class SnapshotList {
     list_.unix_time_ = 0;
     list_.timestamp_ = 0;
     list_.is_write_conflict_boundary_ = false;
+    list_.refcount_ = 0;
     count_ = 0;
   }
 
@@ -97,6 +104,28 @@ class SnapshotList {
     return s;
   }
 
+  // If the newest snapshot in the list describes the same state a brand new
+  // snapshot at `seq` would (same sequence number and write-conflict boundary
+  // flag, and not a timestamped snapshot), take an extra reference on it and
+  // return it. Returns nullptr when no such snapshot exists and the caller
+  // has to link a new one with New(). Must not be used for snapshots whose
+  // fields are mutated after creation (e.g. WritePrepared updates
+  // min_uncommitted_ per GetSnapshot() call).
+  SnapshotImpl* RefNewestIfSame(SequenceNumber seq,
+                                bool is_write_conflict_boundary) {
+    if (empty()) {
+      return nullptr;
+    }
+    SnapshotImpl* s = newest();
+    if (s->number_ != seq ||
+        s->is_write_conflict_boundary_ != is_write_conflict_boundary ||
+        s->timestamp_ != std::numeric_limits<uint64_t>::max()) {
+      return nullptr;
+    }
+    s->refcount_++;
+    return s;
+  }
+
   // Do not responsible to free the object.
   void Delete(const SnapshotImpl* s) {
     assert(s->list_ == this);
@@ -105,6 +134,19 @@ class SnapshotList {
     count_--;
   }
 
+  // Drop one reference from s, unlinking it from the list when the last
+  // reference is gone. Returns true iff s was unlinked, in which case the
+  // caller is responsible for freeing it.
+  bool Unref(const SnapshotImpl* s) {
+    assert(s->list_ == this);
+    assert(s->refcount_ >= 1);
+    if (--s->refcount_ > 0) {
+      return false;
+    }
+    Delete(s);
+    return true;
+  }
+
   // retrieve all snapshot numbers up until max_seq. They are sorted in
   // ascending order (with no duplicates).
   std::vector<SequenceNumber> GetAll(
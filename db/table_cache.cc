@@ -185,7 +185,7 @@ Status TableCache::FindTable(
 
   if (*handle == nullptr) {
     if (no_io) {
-      return Status::Incomplete("Table not found in table_cache, no_io is set");
+      return Status::Incomplete(Status::SubCode::kBlockingIoNotAllowed);
     }
     MutexLock load_lock(&loader_mutex_.Get(key));
     // We check the cache again under loading mutex
@@ -1639,16 +1639,23 @@ class VersionBuilder::Rep {
 
   Status LoadTableHandlers(InternalStats* internal_stats, int max_threads,
                            bool prefetch_index_and_filter_in_cache,
-                           bool is_initial_load,
+                           bool is_initial_load, bool lazy_initial_load,
                            const MutableCFOptions& mutable_cf_options,
                            size_t max_file_size_for_l0_meta_pin,
                            const ReadOptions& read_options) {
     assert(table_cache_ != nullptr);
     assert(!track_found_and_missing_files_ || valid_version_available_);
+    assert(!lazy_initial_load || is_initial_load);
 
     size_t table_cache_capacity =
         table_cache_->get_cache().get()->GetCapacity();
-    bool always_load = (table_cache_capacity == TableCache::kInfiniteCapacity);
+    // With an unbounded table cache all files are normally pre-opened here.
+    // With lazy initial load requested, fall through to the capped loading
+    // below instead and let the table cache materialize the remaining
+    // readers on first use.
+    bool always_load =
+        (table_cache_capacity == TableCache::kInfiniteCapacity) &&
+        !lazy_initial_load;
     size_t max_load = std::numeric_limits<size_t>::max();
 
     if (!always_load) {
@@ -1778,12 +1785,12 @@ Status VersionBuilder::SaveTo(VersionStorageInfo* vstorage) const {
 Status VersionBuilder::LoadTableHandlers(
     InternalStats* internal_stats, int max_threads,
     bool prefetch_index_and_filter_in_cache, bool is_initial_load,
-    const MutableCFOptions& mutable_cf_options,
+    bool lazy_initial_load, const MutableCFOptions& mutable_cf_options,
     size_t max_file_size_for_l0_meta_pin, const ReadOptions& read_options) {
-  return rep_->LoadTableHandlers(internal_stats, max_threads,
-                                 prefetch_index_and_filter_in_cache,
-                                 is_initial_load, mutable_cf_options,
-                                 max_file_size_for_l0_meta_pin, read_options);
+  return rep_->LoadTableHandlers(
+      internal_stats, max_threads, prefetch_index_and_filter_in_cache,
+      is_initial_load, lazy_initial_load, mutable_cf_options,
+      max_file_size_for_l0_meta_pin, read_options);
 }
 
 void VersionBuilder::CreateOrReplaceSavePoint() {
@@ -1821,8 +1828,8 @@ Status VersionBuilder::LoadSavePointTableHandlers(
   }
   return savepoint_->LoadTableHandlers(
       internal_stats, max_threads, prefetch_index_and_filter_in_cache,
-      is_initial_load, mutable_cf_options, max_file_size_for_l0_meta_pin,
-      read_options);
+      is_initial_load, false /* lazy_initial_load */, mutable_cf_options,
+      max_file_size_for_l0_meta_pin, read_options);
 }
 
 void VersionBuilder::ClearSavePoint() { savepoint_.reset(nullptr); }
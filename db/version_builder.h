@@ -54,9 +54,14 @@ class VersionBuilder {
   Status SaveTo(VersionStorageInfo* vstorage) const;
 
   // Load all the table handlers for the current Version in the builder.
+  // When `lazy_initial_load` is true (only valid together with
+  // `is_initial_load`), at most a small number of files starting from L0 are
+  // loaded even if the table cache has infinite capacity; the remaining
+  // readers are materialized by the table cache on first use. See
+  // DBOptions::skip_table_reader_preload_on_db_open.
   Status LoadTableHandlers(InternalStats* internal_stats, int max_threads,
                            bool prefetch_index_and_filter_in_cache,
-                           bool is_initial_load,
+                           bool is_initial_load, bool lazy_initial_load,
                            const MutableCFOptions& mutable_cf_options,
                            size_t max_file_size_for_l0_meta_pin,
                            const ReadOptions& read_options);
@@ -107,6 +107,7 @@ class VersionSet;
 
 constexpr uint64_t kFileNumberMask = 0x3FFFFFFFFFFFFFFF;
 constexpr uint64_t kUnknownOldestAncesterTime = 0;
+constexpr uint64_t kUnknownOldestKeyTime = 0;
 constexpr uint64_t kUnknownNewestKeyTime = 0;
 constexpr uint64_t kUnknownFileCreationTime = 0;
 constexpr uint64_t kUnknownEpochNumber = 0;
@@ -198,6 +199,10 @@ struct FileMetaData {
       0;  // The number of entries, including deletions and range deletions.
   // The number of deletion entries, including range deletions.
   uint64_t num_deletions = 0;
+  // The number of point entries that are older versions of an overwritten
+  // (or deleted) user key. Used to prioritize update-heavy files for
+  // compaction; see FileOverwriteDensityBooster.
+  uint64_t num_key_overwrites = 0;
   uint64_t raw_key_size = 0;    // total uncompressed key size.
   uint64_t raw_value_size = 0;  // total uncompressed value size.
   uint64_t num_range_deletions = 0;
@@ -355,6 +360,21 @@ struct FileMetaData {
     return kUnknownNewestKeyTime;
   }
 
+  // Tries to get the write time of the oldest key in the current file.
+  // Falls back on the file's oldest ancester time, which is a conservative
+  // lower bound on when the oldest key was written.
+  uint64_t TryGetOldestKeyTime() {
+    if (fd.table_reader != nullptr &&
+        fd.table_reader->GetTableProperties() != nullptr) {
+      uint64_t oldest_key_time =
+          fd.table_reader->GetTableProperties()->oldest_key_time;
+      if (oldest_key_time != kUnknownOldestKeyTime) {
+        return oldest_key_time;
+      }
+    }
+    return TryGetOldestAncesterTime();
+  }
+
   // WARNING: manual update to this function is needed
   // whenever a new string property is added to FileMetaData
   // to reduce approximation error.
@@ -434,9 +454,18 @@ struct FdWithKeyRange {
 struct LevelFilesBrief {
   size_t num_files;
   FdWithKeyRange* files;
+  // Optional flat array (parallel to files) of the first 8 bytes of each
+  // file's largest user key, loaded big-endian and zero-padded. Ordering of
+  // these integers agrees with BytewiseComparator ordering except on ties,
+  // so binary searches over the level can resolve most probes against this
+  // dense array instead of chasing FdWithKeyRange cachelines, falling back
+  // to a full key comparison only when prefixes are equal. Consumers must
+  // verify the user comparator is bytewise before relying on it.
+  const uint64_t* largest_ukey_prefix;
   LevelFilesBrief() {
     num_files = 0;
     files = nullptr;
+    largest_ukey_prefix = nullptr;
   }
 };
 
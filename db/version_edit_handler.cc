@@ -34,12 +34,16 @@ void VersionEditHandlerBase::Iterate(log::Reader& reader,
          reader.ReadRecord(&record, &scratch) && log_read_status->ok()) {
     VersionEdit edit;
     s = edit.DecodeFrom(record);
+    // Evaluated before AddEdit(), which moves atomic-group edits into the
+    // replay buffer.
+    bool in_atomic_group = false;
     if (s.ok()) {
+      in_atomic_group = edit.IsInAtomicGroup();
       s = read_buffer_.AddEdit(&edit);
     }
     if (s.ok()) {
       ColumnFamilyData* cfd = nullptr;
-      if (edit.IsInAtomicGroup()) {
+      if (in_atomic_group) {
         if (read_buffer_.IsFull()) {
           s = OnAtomicGroupReplayBegin();
           for (size_t i = 0; s.ok() && i < read_buffer_.replay_buffer().size();
@@ -542,11 +546,14 @@ Status VersionEditHandler::LoadTables(ColumnFamilyData* cfd,
   VersionBuilder* builder = builder_iter->second->version_builder();
   assert(builder);
   const auto& moptions = cfd->GetLatestMutableCFOptions();
+  const bool lazy_initial_load =
+      is_initial_load &&
+      version_set_->db_options_->skip_table_reader_preload_on_db_open;
   Status s = builder->LoadTableHandlers(
       cfd->internal_stats(),
       version_set_->db_options_->max_file_opening_threads,
-      prefetch_index_and_filter_in_cache, is_initial_load, moptions,
-      MaxFileSizeForL0MetaPin(moptions), read_options_);
+      prefetch_index_and_filter_in_cache, is_initial_load, lazy_initial_load,
+      moptions, MaxFileSizeForL0MetaPin(moptions), read_options_);
   if ((s.IsPathNotFound() || s.IsCorruption()) && no_error_if_files_missing_) {
     s = Status::OK();
   }
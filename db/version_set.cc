@@ -95,15 +95,52 @@ namespace ROCKSDB_NAMESPACE {
 
 namespace {
 
+// First 8 bytes of `user_key` as a big-endian integer, zero-padded. See
+// LevelFilesBrief::largest_ukey_prefix for the ordering guarantee.
+uint64_t UserKeyPrefix(const Slice& user_key) {
+  uint64_t prefix = 0;
+  size_t n = std::min(user_key.size(), sizeof(prefix));
+  for (size_t i = 0; i < n; ++i) {
+    prefix |= static_cast<uint64_t>(static_cast<unsigned char>(user_key[i]))
+              << (56 - 8 * i);
+  }
+  return prefix;
+}
+
 // Find File in LevelFilesBrief data structure
 // Within an index range defined by left and right
 int FindFileInRange(const InternalKeyComparator& icmp,
                     const LevelFilesBrief& file_level, const Slice& key,
                     uint32_t left, uint32_t right) {
+  const auto& b = file_level.files;
+  // With a bytewise user comparator, most probes can be decided by the dense
+  // prefix array: an unequal prefix determines the order of the user keys,
+  // and thereby of the internal keys, without dereferencing the file's key
+  // storage. Equal prefixes fall back to a full comparison.
+  if (file_level.largest_ukey_prefix != nullptr &&
+      icmp.user_comparator() == BytewiseComparator()) {
+    const uint64_t key_prefix = UserKeyPrefix(ExtractUserKey(key));
+    while (left < right) {
+      uint32_t mid = left + (right - left) / 2;
+      const uint64_t file_prefix = file_level.largest_ukey_prefix[mid];
+      bool file_less;
+      if (file_prefix != key_prefix) {
+        file_less = file_prefix < key_prefix;
+      } else {
+        file_less =
+            icmp.InternalKeyComparator::Compare(b[mid].largest_key, key) < 0;
+      }
+      if (file_less) {
+        left = mid + 1;
+      } else {
+        right = mid;
+      }
+    }
+    return static_cast<int>(left);
+  }
   auto cmp = [&](const FdWithKeyRange& f, const Slice& k) -> bool {
     return icmp.InternalKeyComparator::Compare(f.largest_key, k) < 0;
   };
-  const auto& b = file_level.files;
   return static_cast<int>(std::lower_bound(b + left, b + right, key, cmp) - b);
 }
 
@@ -888,23 +925,24 @@ void DoGenerateLevelFilesBrief(LevelFilesBrief* file_level,
   file_level->num_files = num;
   char* mem = arena->AllocateAligned(num * sizeof(FdWithKeyRange));
   file_level->files = new (mem) FdWithKeyRange[num];
+  mem = arena->AllocateAligned(num * sizeof(uint64_t));
+  uint64_t* largest_ukey_prefix = reinterpret_cast<uint64_t*>(mem);
+  file_level->largest_ukey_prefix = largest_ukey_prefix;
 
   for (size_t i = 0; i < num; i++) {
-    Slice smallest_key = files[i]->smallest.Encode();
-    Slice largest_key = files[i]->largest.Encode();
-
-    // Copy key slice to sequential memory
-    size_t smallest_size = smallest_key.size();
-    size_t largest_size = largest_key.size();
-    mem = arena->AllocateAligned(smallest_size + largest_size);
-    memcpy(mem, smallest_key.data(), smallest_size);
-    memcpy(mem + smallest_size, largest_key.data(), largest_size);
-
     FdWithKeyRange& f = file_level->files[i];
     f.fd = files[i]->fd;
     f.file_metadata = files[i];
-    f.smallest_key = Slice(mem, smallest_size);
-    f.largest_key = Slice(mem + smallest_size, largest_size);
+    // Point at the key storage owned by FileMetaData instead of copying it
+    // into this arena. The bounds are immutable once the file is created,
+    // and every holder of a LevelFilesBrief (Version, Compaction) keeps a
+    // reference on the FileMetaData for at least as long. FileMetaData is
+    // shared across Versions, so this avoids re-duplicating every boundary
+    // key per Version; the dense prefix array above keeps binary searches
+    // from touching these cold keys on most probes.
+    f.smallest_key = files[i]->smallest.Encode();
+    f.largest_key = files[i]->largest.Encode();
+    largest_ukey_prefix[i] = UserKeyPrefix(ExtractUserKey(f.largest_key));
   }
 }
 
@@ -1070,6 +1108,12 @@ class LevelIterator final : public InternalIterator {
 
   inline IterBoundCheck UpperBoundCheckResult() override {
     if (Valid()) {
+      if (file_within_upper_bound_) {
+        // The current file is entirely within iterate_upper_bound, so the
+        // per-key bound checks in the file iterator and above it can be
+        // elided without consulting the file iterator.
+        return IterBoundCheck::kInbound;
+      }
       return file_iter_.UpperBoundCheckResult();
     } else {
       return IterBoundCheck::kUnknown;
@@ -1153,6 +1197,7 @@ class LevelIterator final : public InternalIterator {
       largest_compaction_key = (*compaction_boundaries_)[file_index_].largest;
     }
     CheckMayBeOutOfLowerBound();
+    CheckFileWithinUpperBound();
     ClearRangeTombstoneIter();
     return table_cache_->NewIterator(
         read_options_, file_options_, icomparator_, *file_meta.file_metadata,
@@ -1178,6 +1223,23 @@ class LevelIterator final : public InternalIterator {
     }
   }
 
+  // Check if the current file is fully within iterate_upper_bound, in which
+  // case per-key upper bound checks are unnecessary until the iterator moves
+  // to a file that may straddle the bound.
+  //
+  // Note MyRocks may update iterate bounds between seek. To workaround it,
+  // we need to check and update file_within_upper_bound_ accordingly.
+  void CheckFileWithinUpperBound() {
+    file_within_upper_bound_ = false;
+    if (read_options_.iterate_upper_bound != nullptr &&
+        file_index_ < flevel_->num_files) {
+      file_within_upper_bound_ =
+          user_comparator_.CompareWithoutTimestamp(
+              ExtractUserKey(file_largest_key(file_index_)), /*a_has_ts=*/true,
+              *read_options_.iterate_upper_bound, /*b_has_ts=*/false) < 0;
+    }
+  }
+
   TableCache* table_cache_;
   const ReadOptions& read_options_;
   const FileOptions& file_options_;
@@ -1224,6 +1286,9 @@ class LevelIterator final : public InternalIterator {
   bool skip_filters_;
   bool allow_unprepared_value_;
   bool may_be_out_of_lower_bound_ = true;
+  // True if the current file's largest user key is below
+  // iterate_upper_bound, i.e. every key in the file is within the bound.
+  bool file_within_upper_bound_ = false;
   bool is_next_read_sequential_;
   // Set in Seek() when a prefix seek reaches end of the current file,
   // and the next file has a different prefix. SkipEmptyFileForward()
@@ -1340,6 +1405,7 @@ void LevelIterator::Seek(const Slice& target) {
   }
   SkipEmptyFileForward();
   CheckMayBeOutOfLowerBound();
+  CheckFileWithinUpperBound();
 }
 
 void LevelIterator::SeekForPrev(const Slice& target) {
@@ -1352,6 +1418,7 @@ void LevelIterator::SeekForPrev(const Slice& target) {
     SetFileIterator(nullptr);
     ClearRangeTombstoneIter();
     CheckMayBeOutOfLowerBound();
+    CheckFileWithinUpperBound();
     return;
   }
   if (new_file_index >= flevel_->num_files) {
@@ -1375,6 +1442,7 @@ void LevelIterator::SeekForPrev(const Slice& target) {
     SkipEmptyFileBackward();
   }
   CheckMayBeOutOfLowerBound();
+  CheckFileWithinUpperBound();
 }
 
 void LevelIterator::SeekToFirst() {
@@ -1383,6 +1451,13 @@ void LevelIterator::SeekToFirst() {
   InitFileIterator(0);
   if (file_iter_.iter() != nullptr) {
     file_iter_.SeekToFirst();
+    // Status::TryAgain indicates asynchronous request for retrieval of data
+    // blocks has been submitted. So it should return at this point and
+    // SeekToFirst should be called again to retrieve the requested block and
+    // execute the remaining code.
+    if (file_iter_.status() == Status::TryAgain()) {
+      return;
+    }
     if (range_tombstone_iter_) {
       // We do this in SeekToFirst() and SeekToLast() since
       // we could have an empty file with only range tombstones.
@@ -1391,6 +1466,7 @@ void LevelIterator::SeekToFirst() {
   }
   SkipEmptyFileForward();
   CheckMayBeOutOfLowerBound();
+  CheckFileWithinUpperBound();
 }
 
 void LevelIterator::SeekToLast() {
@@ -1405,6 +1481,7 @@ void LevelIterator::SeekToLast() {
   }
   SkipEmptyFileBackward();
   CheckMayBeOutOfLowerBound();
+  CheckFileWithinUpperBound();
 }
 
 void LevelIterator::Next() {
@@ -3156,6 +3233,7 @@ bool Version::MaybeInitializeFileMetaData(const ReadOptions& read_options,
   }
   file_meta->num_entries = tp->num_entries;
   file_meta->num_deletions = tp->num_deletions;
+  file_meta->num_key_overwrites = tp->num_key_overwrites;
   file_meta->raw_value_size = tp->raw_value_size;
   file_meta->raw_key_size = tp->raw_key_size;
   file_meta->num_range_deletions = tp->num_range_deletions;
@@ -3839,22 +3917,33 @@ void VersionStorageInfo::ComputeFilesMarkedForForcedBlobGC(
   const auto& linked_ssts = oldest_meta->GetLinkedSsts();
   assert(!linked_ssts.empty());
 
-  size_t count = 1;
-  uint64_t sum_total_blob_bytes = oldest_meta->GetTotalBlobBytes();
-  uint64_t sum_garbage_blob_bytes = oldest_meta->GetGarbageBlobBytes();
-
   assert(cutoff_count <= blob_files_.size());
 
-  for (; count < cutoff_count; ++count) {
+  // Trigger forced GC if the garbage ratio of *any* prefix of the eligible
+  // batch reaches the force threshold, not just the batch as a whole. Since
+  // the GC cutoff is prefix based (a compaction relocates every blob up to
+  // the cutoff file), a garbage-heavy prefix is actionable on its own; with
+  // mixed-lifetime values it would otherwise be averaged away by
+  // younger, mostly-live files in the batch.
+  uint64_t sum_total_blob_bytes = 0;
+  uint64_t sum_garbage_blob_bytes = 0;
+  bool force_threshold_reached = false;
+
+  for (size_t count = 0; count < cutoff_count; ++count) {
     const auto& meta = blob_files_[count];
     assert(meta);
 
     sum_total_blob_bytes += meta->GetTotalBlobBytes();
     sum_garbage_blob_bytes += meta->GetGarbageBlobBytes();
+
+    if (sum_garbage_blob_bytes >=
+        blob_garbage_collection_force_threshold * sum_total_blob_bytes) {
+      force_threshold_reached = true;
+      break;
+    }
   }
 
-  if (sum_garbage_blob_bytes <
-      blob_garbage_collection_force_threshold * sum_total_blob_bytes) {
+  if (!force_threshold_reached) {
     return;
   }
 
@@ -3986,6 +4075,7 @@ void SortFileByOverlappingRatio(
 
   FileTtlBooster ttl_booster(static_cast<uint64_t>(curr_time), ttl,
                              num_non_empty_levels, level);
+  FileOverwriteDensityBooster overwrite_booster;
 
   for (auto& file : files) {
     uint64_t overlapping_bytes = 0;
@@ -4008,10 +4098,12 @@ void SortFileByOverlappingRatio(
 
     uint64_t ttl_boost_score = (ttl > 0) ? ttl_booster.GetBoostScore(file) : 1;
     assert(ttl_boost_score > 0);
+    uint64_t overwrite_boost_score = overwrite_booster.GetBoostScore(file);
+    assert(overwrite_boost_score > 0);
     assert(file->compensated_file_size != 0);
-    file_to_order[file->fd.GetNumber()] = overlapping_bytes * 1024U /
-                                          file->compensated_file_size /
-                                          ttl_boost_score;
+    file_to_order[file->fd.GetNumber()] =
+        overlapping_bytes * 1024U / file->compensated_file_size /
+        ttl_boost_score / overwrite_boost_score;
   }
 
   size_t num_to_sort = temp->size() > VersionStorageInfo::kNumberFilesToSort
@@ -4210,6 +4302,7 @@ void VersionStorageInfo::GenerateBottommostFiles() {
                                          l0_file_idx)) {
         bottommost_files_.emplace_back(static_cast<int>(level),
                                        f.file_metadata);
+        bottommost_files_size_ += f.file_metadata->fd.GetFileSize();
       }
     }
   }
@@ -5124,10 +5217,13 @@ Status AtomicGroupReadBuffer::AddEdit(VersionEdit* edit) {
           "AtomicGroupReadBuffer::AddEdit:IncorrectAtomicGroupSize", edit);
       return Status::Corruption("corrupted atomic group");
     }
-    replay_buffer_[read_edits_in_atomic_group_ - 1] = *edit;
+    // Move rather than copy: an edit can carry a large number of file
+    // additions whose keys would otherwise all be deep-copied here.
+    replay_buffer_[read_edits_in_atomic_group_ - 1] = std::move(*edit);
     if (read_edits_in_atomic_group_ == replay_buffer_.size()) {
       TEST_SYNC_POINT_CALLBACK(
-          "AtomicGroupReadBuffer::AddEdit:LastInAtomicGroup", edit);
+          "AtomicGroupReadBuffer::AddEdit:LastInAtomicGroup",
+          &replay_buffer_[read_edits_in_atomic_group_ - 1]);
       return Status::OK();
     }
     return Status::OK();
@@ -5340,6 +5436,10 @@ Status VersionSet::ProcessManifestWrites(
   // element removed, `batch_edits_ts_sz` should be updated too.
   autovector<std::optional<size_t>> batch_edits_ts_sz;
   autovector<Version*> versions;
+  // Index into `versions` (and `builder_guards`) by column family ID, so
+  // batches spanning many column families don't do a linear search per
+  // writer.
+  UnorderedMap<uint32_t, size_t> cf_id_to_version_index;
   std::vector<std::unique_ptr<BaseReferencedVersionBuilder>> builder_guards;
   autovector<const autovector<uint64_t>*> files_to_quarantine_if_commit_fail;
   autovector<uint64_t> limbo_descriptor_log_file_number;
@@ -5400,21 +5500,18 @@ Status VersionSet::ProcessManifestWrites(
           }
         }
       } else {
-        // We do a linear search on versions because versions is small.
-        // TODO(yanqin) maybe consider unordered_map
         Version* version = nullptr;
         VersionBuilder* builder = nullptr;
-        for (int i = 0; i != static_cast<int>(versions.size()); ++i) {
-          uint32_t cf_id = last_writer->cfd->GetID();
-          if (versions[i]->cfd()->GetID() == cf_id) {
-            version = versions[i];
-            assert(!builder_guards.empty() &&
-                   builder_guards.size() == versions.size());
-            builder = builder_guards[i]->version_builder();
-            TEST_SYNC_POINT_CALLBACK(
-                "VersionSet::ProcessManifestWrites:SameColumnFamily", &cf_id);
-            break;
-          }
+        uint32_t cf_id = last_writer->cfd->GetID();
+        auto version_index_iter = cf_id_to_version_index.find(cf_id);
+        if (version_index_iter != cf_id_to_version_index.end()) {
+          size_t i = version_index_iter->second;
+          version = versions[i];
+          assert(!builder_guards.empty() &&
+                 builder_guards.size() == versions.size());
+          builder = builder_guards[i]->version_builder();
+          TEST_SYNC_POINT_CALLBACK(
+              "VersionSet::ProcessManifestWrites:SameColumnFamily", &cf_id);
         }
         if (version == nullptr) {
           // WAL manipulations do not need to be applied to versions.
@@ -5425,6 +5522,7 @@ Status VersionSet::ProcessManifestWrites(
                                  : MutableCFOptions(*new_cf_options),
                 io_tracer_, current_version_number_++);
             versions.push_back(version);
+            cf_id_to_version_index.emplace(cf_id, versions.size() - 1);
             builder_guards.emplace_back(
                 new BaseReferencedVersionBuilder(last_writer->cfd));
             builder = builder_guards.back()->version_builder();
@@ -5603,7 +5701,8 @@ Status VersionSet::ProcessManifestWrites(
         s = builder_guards[i]->version_builder()->LoadTableHandlers(
             cfd->internal_stats(), 1 /* max_threads */,
             true /* prefetch_index_and_filter_in_cache */,
-            false /* is_initial_load */, versions[i]->GetMutableCFOptions(),
+            false /* is_initial_load */, false /* lazy_initial_load */,
+            versions[i]->GetMutableCFOptions(),
             MaxFileSizeForL0MetaPin(versions[i]->GetMutableCFOptions()),
             read_options);
         if (!s.ok()) {
@@ -6814,6 +6913,77 @@ Status VersionSet::WriteCurrentStateToManifest(
   return Status::OK();
 }
 
+namespace {
+// Interprets up to 8 bytes of `key` starting at `skip` as a big-endian
+// integer, zero-padded on the right.
+uint64_t KeyPrefixToUint64(const Slice& key, size_t skip) {
+  uint64_t v = 0;
+  for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+    uint8_t byte = skip + i < key.size()
+                       ? static_cast<uint8_t>(key.data()[skip + i])
+                       : 0;
+    v = (v << 8) | byte;
+  }
+  return v;
+}
+
+// Fraction in [0, 1] of the way `key` sits between `smallest` and `largest`
+// (all user keys), assuming keys are roughly uniformly distributed by byte
+// prefix: the common prefix is stripped and the next 8 bytes of each key are
+// compared as big-endian integers.
+double InterpolateKeyPosition(const Slice& smallest, const Slice& largest,
+                              const Slice& key) {
+  size_t prefix = 0;
+  while (prefix < smallest.size() && prefix < largest.size() &&
+         smallest.data()[prefix] == largest.data()[prefix]) {
+    ++prefix;
+  }
+  const uint64_t lo = KeyPrefixToUint64(smallest, prefix);
+  const uint64_t hi = KeyPrefixToUint64(largest, prefix);
+  const uint64_t k = KeyPrefixToUint64(key, prefix);
+  if (hi <= lo) {
+    // Degenerate bounds (e.g. keys only differ beyond 8 bytes after the
+    // common prefix); no basis for interpolation.
+    return 0.5;
+  }
+  if (k <= lo) {
+    return 0.0;
+  }
+  if (k >= hi) {
+    return 1.0;
+  }
+  return static_cast<double>(k - lo) / static_cast<double>(hi - lo);
+}
+
+// In-memory-only estimate of the bytes of `f` used by the keys range
+// [start, end] (internal keys): the positions of the range endpoints within
+// the file are interpolated from the file's key bounds, with no table reads.
+uint64_t ApproximateSizeFromMetadata(const InternalKeyComparator& icmp,
+                                     const FdWithKeyRange& f,
+                                     const Slice& start, const Slice& end) {
+  if (icmp.Compare(f.largest_key, start) <= 0 ||
+      icmp.Compare(f.smallest_key, end) > 0) {
+    return 0;
+  }
+  const Slice file_smallest = ExtractUserKey(f.smallest_key);
+  const Slice file_largest = ExtractUserKey(f.largest_key);
+  const double lo =
+      icmp.Compare(start, f.smallest_key) <= 0
+          ? 0.0
+          : InterpolateKeyPosition(file_smallest, file_largest,
+                                   ExtractUserKey(start));
+  const double hi = icmp.Compare(end, f.largest_key) >= 0
+                        ? 1.0
+                        : InterpolateKeyPosition(file_smallest, file_largest,
+                                                 ExtractUserKey(end));
+  if (hi <= lo) {
+    return 0;
+  }
+  return static_cast<uint64_t>((hi - lo) *
+                               static_cast<double>(f.fd.GetFileSize()));
+}
+}  // namespace
+
 // TODO(aekmekji): in CompactionJob::GenSubcompactionBoundaries(), this
 // function is called repeatedly with consecutive pairs of slices. For example
 // if the slice list is [a, b, c, d] this function is called with arguments
@@ -6933,6 +7103,17 @@ uint64_t VersionSet::ApproximateSize(const SizeApproximationOptions& options,
   if (margin > 0 && total_intersecting_size <
                         static_cast<uint64_t>(total_full_size * margin)) {
     total_full_size += total_intersecting_size / 2;
+  } else if (options.files_size_metadata_only) {
+    // Interpolate the boundary files' contribution from their in-memory key
+    // bounds instead of reading their index blocks.
+    for (const auto file_ptr : first_files) {
+      total_full_size +=
+          ApproximateSizeFromMetadata(icmp, *file_ptr, start, end);
+    }
+    for (const auto file_ptr : last_files) {
+      total_full_size +=
+          ApproximateSizeFromMetadata(icmp, *file_ptr, start, end);
+    }
   } else {
     // Estimate for all the first files (might also be last files), at each
     // level
@@ -259,6 +259,22 @@ class VersionStorageInfo {
   // Return idx'th highest score
   double CompactionScore(int idx) const { return compaction_score_[idx]; }
 
+  // Measured compaction cost (microseconds of work per input byte, indexed
+  // by compaction output level), refreshed from InternalStats by the column
+  // family right before picking a compaction. Zero for levels that have not
+  // seen a compaction yet, and empty until first set.
+  // REQUIRES: DB mutex held
+  void SetCompactionCostPerByte(std::vector<double> cost) {
+    compaction_cost_per_byte_ = std::move(cost);
+  }
+  double CompactionCostPerByte(int level) const {
+    if (level < 0 ||
+        static_cast<size_t>(level) >= compaction_cost_per_byte_.size()) {
+      return 0.0;
+    }
+    return compaction_cost_per_byte_[level];
+  }
+
   void GetOverlappingInputs(
       int level, const InternalKey* begin,  // nullptr means before all keys
       const InternalKey* end,               // nullptr means after all keys
@@ -504,6 +520,15 @@ class VersionStorageInfo {
     return bottommost_files_;
   }
 
+  // Total size of BottommostFiles(). Precomputed so that write stall
+  // recalculation does not iterate over all bottommost files on every
+  // superversion install.
+  // REQUIRES: PrepareForVersionAppend has been called
+  uint64_t BottommostFilesSize() const {
+    assert(finalized_);
+    return bottommost_files_size_;
+  }
+
   // REQUIRES: ComputeCompactionScore has been called
   // REQUIRES: DB mutex held during access
   const autovector<std::pair<int, FileMetaData*>>&
@@ -721,6 +746,8 @@ class VersionStorageInfo {
   // protected by DB mutex and are calculated in `GenerateBottommostFiles()` and
   // `ComputeBottommostFilesMarkedForCompaction()`.
   autovector<std::pair<int, FileMetaData*>> bottommost_files_;
+  // Sum of the file sizes in bottommost_files_.
+  uint64_t bottommost_files_size_ = 0;
   autovector<std::pair<int, FileMetaData*>>
       bottommost_files_marked_for_compaction_;
 
@@ -751,6 +778,8 @@ class VersionStorageInfo {
   // These are used to pick the best compaction level
   std::vector<double> compaction_score_;
   std::vector<int> compaction_level_;
+  // See SetCompactionCostPerByte().
+  std::vector<double> compaction_cost_per_byte_;
   int l0_delay_trigger_count_ = 0;  // Count used to trigger slow down and stop
                                     // for number of L0 files.
 
@@ -1368,14 +1397,17 @@ class VersionSet {
     return last_sequence_.load(std::memory_order_acquire);
   }
 
-  // Note: memory_order_acquire must be sufficient.
+  // Acquire pairs with the stores below, which all have at least release
+  // semantics, to guarantee the visibility rule for data read at this
+  // sequence (the historic seq_cst load bought nothing beyond that and
+  // costs a fence per snapshot-less read on weakly-ordered platforms).
   uint64_t LastAllocatedSequence() const {
-    return last_allocated_sequence_.load(std::memory_order_seq_cst);
+    return last_allocated_sequence_.load(std::memory_order_acquire);
   }
 
-  // Note: memory_order_acquire must be sufficient.
+  // See LastAllocatedSequence() re: memory order.
   uint64_t LastPublishedSequence() const {
-    return last_published_sequence_.load(std::memory_order_seq_cst);
+    return last_published_sequence_.load(std::memory_order_acquire);
   }
 
   // Set the last sequence number to s.
@@ -1668,7 +1700,11 @@ class VersionSet {
   // The last seq visible to reads. It normally indicates the last sequence in
   // the memtable but when using two write queues it could also indicate the
   // last sequence in the WAL visible to reads.
-  std::atomic<uint64_t> last_sequence_;
+  // Kept on its own cache line: it is stored by every batch group leader and
+  // loaded by every read acquiring a snapshot, so sharing a line with the
+  // file-number and manifest bookkeeping above would ping-pong the line
+  // between writers and unrelated mutators.
+  ALIGN_AS(CACHE_LINE_SIZE) std::atomic<uint64_t> last_sequence_;
   // The last sequence number of data committed to the descriptor (manifest
   // file).
   SequenceNumber descriptor_last_sequence_ = 0;
@@ -9,7 +9,6 @@
 #include <cassert>
 #include <limits>
 
-#include "db/wide/wide_columns_helper.h"
 #include "rocksdb/slice.h"
 #include "util/autovector.h"
 #include "util/coding.h"
@@ -131,19 +130,72 @@ Status WideColumnSerialization::Deserialize(Slice& input,
 
 Status WideColumnSerialization::GetValueOfDefaultColumn(Slice& input,
                                                         Slice& value) {
-  WideColumns columns;
+  // Note: we only need a single column value here, and since the index and the
+  // value payload are kept separate in the serialization format, we can get
+  // away with parsing just the index and slicing the value out of the payload
+  // without materializing the entire WideColumns structure. Since columns are
+  // sorted by name and the default column's name is the empty string, the
+  // default column can only be the very first one.
+  uint32_t version = 0;
+  if (!GetVarint32(&input, &version)) {
+    return Status::Corruption("Error decoding wide column version");
+  }
+
+  if (version > kCurrentVersion) {
+    return Status::NotSupported("Unsupported wide column version");
+  }
+
+  uint32_t num_columns = 0;
+  if (!GetVarint32(&input, &num_columns)) {
+    return Status::Corruption("Error decoding number of wide columns");
+  }
+
+  if (!num_columns) {
+    value.clear();
+    return Status::OK();
+  }
+
+  bool has_default_column = false;
+  uint32_t default_column_value_size = 0;
+  uint64_t total_value_size = 0;
+
+  Slice prev_name;
+
+  for (uint32_t i = 0; i < num_columns; ++i) {
+    Slice name;
+    if (!GetLengthPrefixedSlice(&input, &name)) {
+      return Status::Corruption("Error decoding wide column name");
+    }
+
+    if (i > 0 && prev_name.compare(name) >= 0) {
+      return Status::Corruption("Wide columns out of order");
+    }
+
+    prev_name = name;
+
+    uint32_t value_size = 0;
+    if (!GetVarint32(&input, &value_size)) {
+      return Status::Corruption("Error decoding wide column value size");
+    }
+
+    if (i == 0) {
+      has_default_column = (name == kDefaultWideColumnName);
+      default_column_value_size = value_size;
+    }
+
+    total_value_size += value_size;
+  }
 
-  const Status s = Deserialize(input, columns);
-  if (!s.ok()) {
-    return s;
+  if (total_value_size > input.size()) {
+    return Status::Corruption("Error decoding wide column value payload");
   }
 
-  if (!WideColumnsHelper::HasDefaultColumn(columns)) {
+  if (!has_default_column) {
     value.clear();
     return Status::OK();
   }
 
-  value = WideColumnsHelper::GetDefaultColumn(columns);
+  value = Slice(input.data(), default_column_value_size);
 
   return Status::OK();
 }
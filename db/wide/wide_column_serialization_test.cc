@@ -126,6 +126,75 @@ TEST(WideColumnSerializationTest, SerializeDeserialize) {
   }
 }
 
+TEST(WideColumnSerializationTest, GetValueOfDefaultColumn) {
+  // Entity with a default column
+  {
+    WideColumns columns{{kDefaultWideColumnName, "quux"},
+                        {"foo", "bar"},
+                        {"hello", "world"}};
+    std::string output;
+
+    ASSERT_OK(WideColumnSerialization::Serialize(columns, output));
+
+    Slice input(output);
+    Slice value;
+
+    ASSERT_OK(WideColumnSerialization::GetValueOfDefaultColumn(input, value));
+    ASSERT_EQ(value, "quux");
+  }
+
+  // Entity without a default column
+  {
+    WideColumns columns{{"foo", "bar"}, {"hello", "world"}};
+    std::string output;
+
+    ASSERT_OK(WideColumnSerialization::Serialize(columns, output));
+
+    Slice input(output);
+    Slice value;
+
+    ASSERT_OK(WideColumnSerialization::GetValueOfDefaultColumn(input, value));
+    ASSERT_TRUE(value.empty());
+  }
+
+  // Entity without any columns
+  {
+    WideColumns columns;
+    std::string output;
+
+    ASSERT_OK(WideColumnSerialization::Serialize(columns, output));
+
+    Slice input(output);
+    Slice value;
+
+    ASSERT_OK(WideColumnSerialization::GetValueOfDefaultColumn(input, value));
+    ASSERT_TRUE(value.empty());
+  }
+
+  // Truncated value payload
+  {
+    std::string buf;
+
+    PutVarint32(&buf, WideColumnSerialization::kCurrentVersion);
+
+    constexpr uint32_t num_columns = 1;
+    PutVarint32(&buf, num_columns);
+
+    PutLengthPrefixedSlice(&buf, kDefaultWideColumnName);
+
+    constexpr uint32_t value_size = 16;
+    PutVarint32(&buf, value_size);
+
+    Slice input(buf);
+    Slice value;
+
+    const Status s =
+        WideColumnSerialization::GetValueOfDefaultColumn(input, value);
+    ASSERT_TRUE(s.IsCorruption());
+    ASSERT_TRUE(std::strstr(s.getState(), "payload"));
+  }
+}
+
 TEST(WideColumnSerializationTest, SerializeDuplicateError) {
   WideColumns columns{{"foo", "bar"}, {"foo", "baz"}};
   std::string output;
@@ -185,9 +185,10 @@ WriteBatch::WriteBatch(size_t reserved_bytes, size_t max_bytes,
   if (protection_bytes_per_key != 0) {
     prot_info_.reset(new WriteBatch::ProtectionInfo());
   }
-  rep_.reserve((reserved_bytes > WriteBatchInternal::kHeader)
-                   ? reserved_bytes
-                   : WriteBatchInternal::kHeader);
+  default_reserved_bytes_ = (reserved_bytes > WriteBatchInternal::kHeader)
+                                ? reserved_bytes
+                                : WriteBatchInternal::kHeader;
+  rep_.reserve(default_reserved_bytes_);
   rep_.resize(WriteBatchInternal::kHeader);
 }
 
@@ -203,6 +204,7 @@ WriteBatch::WriteBatch(const WriteBatch& src)
     : wal_term_point_(src.wal_term_point_),
       content_flags_(src.content_flags_.load(std::memory_order_relaxed)),
       max_bytes_(src.max_bytes_),
+      default_reserved_bytes_(src.default_reserved_bytes_),
       default_cf_ts_sz_(src.default_cf_ts_sz_),
       rep_(src.rep_) {
   if (src.save_points_ != nullptr) {
@@ -220,6 +222,7 @@ WriteBatch::WriteBatch(WriteBatch&& src) noexcept
       wal_term_point_(std::move(src.wal_term_point_)),
       content_flags_(src.content_flags_.load(std::memory_order_relaxed)),
       max_bytes_(src.max_bytes_),
+      default_reserved_bytes_(src.default_reserved_bytes_),
       prot_info_(std::move(src.prot_info_)),
       default_cf_ts_sz_(src.default_cf_ts_sz_),
       rep_(std::move(src.rep_)) {}
@@ -253,6 +256,12 @@ bool WriteBatch::Handler::Continue() { return true; }
 
 void WriteBatch::Clear() {
   rep_.clear();
+  if (rep_.capacity() < default_reserved_bytes_) {
+    // The buffer was moved out by Release() (or never reserved); restore the
+    // construction-time reservation so refilling the batch does not have to
+    // grow the buffer incrementally again.
+    rep_.reserve(default_reserved_bytes_);
+  }
   rep_.resize(WriteBatchInternal::kHeader);
 
   content_flags_.store(0, std::memory_order_relaxed);
@@ -514,6 +523,38 @@ Status WriteBatch::Iterate(Handler* handler) const {
     return Status::Corruption("malformed WriteBatch (too small)");
   }
 
+  // Fast path for a batch holding exactly one Put (e.g. built by DB::Put()):
+  // dispatch the single record directly instead of going through the generic
+  // record loop below. The content flag check guarantees nothing but Puts was
+  // ever added; any batch that does not parse as exactly one Put record (e.g.
+  // one Put plus uncounted LogData) falls through to the generic loop, which
+  // also surfaces corruption the same way it always has.
+  if (content_flags_.load(std::memory_order_relaxed) == ContentFlags::HAS_PUT &&
+      WriteBatchInternal::Count(this) == 1) {
+    Slice input(rep_.data() + WriteBatchInternal::kHeader,
+                rep_.size() - WriteBatchInternal::kHeader);
+    char tag = input[0];
+    if (tag == kTypeValue || tag == kTypeColumnFamilyValue) {
+      input.remove_prefix(1);
+      uint32_t column_family = 0;  // default
+      Slice key, value;
+      if ((tag == kTypeValue || GetVarint32(&input, &column_family)) &&
+          GetLengthPrefixedSlice(&input, &key) &&
+          GetLengthPrefixedSlice(&input, &value) && input.empty()) {
+        if (!handler->Continue()) {
+          return Status::OK();
+        }
+        Status s = handler->PutCF(column_family, key, value);
+        if (UNLIKELY(s.IsTryAgain())) {
+          // The generic loop re-delivers a record once on TryAgain; mirror
+          // that here.
+          s = handler->PutCF(column_family, key, value);
+        }
+        return s;
+      }
+    }
+  }
+
   return WriteBatchInternal::Iterate(this, handler, WriteBatchInternal::kHeader,
                                      rep_.size());
 }
@@ -3447,6 +3488,9 @@ Status WriteBatchInternal::Append(WriteBatch* dst, const WriteBatch* src,
   }
   SetCount(dst, Count(dst) + src_count);
   assert(src->rep_.size() >= WriteBatchInternal::kHeader);
+  // Size exactly instead of letting append() grow geometrically; appending a
+  // large prepared batch at commit time would otherwise overshoot by up to 2x.
+  dst->rep_.reserve(dst->rep_.size() + src_len);
   dst->rep_.append(src->rep_.data() + WriteBatchInternal::kHeader, src_len);
   dst->content_flags_.store(
       dst->content_flags_.load(std::memory_order_relaxed) | src_flags,
@@ -495,6 +495,29 @@ TEST_F(WriteBatchTest, Blob) {
       handler.seen);
 }
 
+TEST_F(WriteBatchTest, SinglePutIterate) {
+  // A batch holding exactly one Put takes a fast path in Iterate(); verify
+  // it dispatches identically to the generic loop, including when the batch
+  // also carries uncounted LogData (which forces the generic loop).
+  {
+    WriteBatch batch;
+    ASSERT_OK(batch.Put(Slice("k1"), Slice("v1")));
+    ASSERT_EQ(1u, batch.Count());
+    TestHandler handler;
+    ASSERT_OK(batch.Iterate(&handler));
+    ASSERT_EQ("Put(k1, v1)", handler.seen);
+  }
+  {
+    WriteBatch batch;
+    ASSERT_OK(batch.Put(Slice("k1"), Slice("v1")));
+    ASSERT_OK(batch.PutLogData(Slice("blob1")));
+    ASSERT_EQ(1u, batch.Count());
+    TestHandler handler;
+    ASSERT_OK(batch.Iterate(&handler));
+    ASSERT_EQ("Put(k1, v1)LogData(blob1)", handler.seen);
+  }
+}
+
 TEST_F(WriteBatchTest, PrepareCommit) {
   WriteBatch batch;
   ASSERT_OK(WriteBatchInternal::InsertNoop(&batch));
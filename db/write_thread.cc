@@ -234,7 +234,7 @@ bool WriteThread::LinkOne(Writer* w, std::atomic<Writer*>* newest_writer) {
     // immediately
     if (writers == &write_stall_dummy_) {
       if (w->no_slowdown) {
-        w->status = Status::Incomplete("Write stall");
+        w->status = Status::Incomplete(Status::SubCode::kWriteStall);
         SetState(w, STATE_COMPLETED);
         return false;
       }
@@ -256,6 +256,10 @@ bool WriteThread::LinkOne(Writer* w, std::atomic<Writer*>* newest_writer) {
     if (newest_writer->compare_exchange_weak(writers, w)) {
       return (writers == nullptr);
     }
+    // CAS failed: many writers are pushing onto the list concurrently.
+    // Pause briefly before retrying to reduce cache-line ping-pong on
+    // `newest_writer` at high core counts.
+    port::AsmVolatilePause();
   }
 }
 
@@ -281,6 +285,8 @@ bool WriteThread::LinkGroup(WriteGroup& write_group,
     if (newest_writer->compare_exchange_weak(newest, last_writer)) {
       return (newest == nullptr);
     }
+    // See LinkOne() above for why we pause between CAS attempts.
+    port::AsmVolatilePause();
   }
 }
 
@@ -337,7 +343,7 @@ void WriteThread::BeginWriteStall() {
   while (w != nullptr && w->write_group == nullptr) {
     if (w->no_slowdown) {
       prev->link_older = w->link_older;
-      w->status = Status::Incomplete("Write stall");
+      w->status = Status::Incomplete(Status::SubCode::kWriteStall);
       SetState(w, STATE_COMPLETED);
       // Only update `link_newer` if it's already set.
       // `CreateMissingNewerLinks()` will update the nullptr `link_newer` later,
@@ -395,6 +395,12 @@ class PosixEnv : public CompositeEnv {
     return Status::OK();
   }
 
+  Status SetThreadPoolCpuAffinity(Priority pool,
+                                  const std::vector<int>& cpus) override {
+    assert(pool >= Priority::BOTTOM && pool <= Priority::HIGH);
+    return thread_pools_[pool].SetCpuAffinity(cpus);
+  }
+
  private:
   friend Env* Env::Default();
   // Constructs the default Env, a singleton
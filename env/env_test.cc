@@ -64,6 +64,7 @@
 #include "util/mutexlock.h"
 #include "util/random.h"
 #include "util/string_util.h"
+#include "util/threadpool_imp.h"
 #include "utilities/counted_fs.h"
 #include "utilities/env_timed.h"
 #include "utilities/fault_injection_env.h"
@@ -310,6 +311,55 @@ TEST_F(EnvPosixTest, LowerThreadPoolCpuPriority) {
   ROCKSDB_NAMESPACE::SyncPoint::GetInstance()->DisableProcessing();
   ROCKSDB_NAMESPACE::SyncPoint::GetInstance()->ClearAllCallBacks();
 }
+
+TEST_F(EnvPosixTest, ThreadPoolCpuAffinity) {
+  // Use a private pool so the shared default Env pools are not left pinned.
+  ThreadPoolImpl pool;
+  pool.SetBackgroundThreads(1);
+
+  // Invalid CPU ids are rejected.
+  ASSERT_NOK(pool.SetCpuAffinity({-1}));
+  ASSERT_NOK(pool.SetCpuAffinity({CPU_SETSIZE}));
+
+  // CPU 0 always exists; the new affinity is applied by the worker before it
+  // picks up its next job.
+  ASSERT_OK(pool.SetCpuAffinity({0}));
+  std::atomic<bool> pinned(false);
+  std::atomic<bool> done(false);
+  pool.SubmitJob([&] {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0) {
+      pinned = (CPU_COUNT(&cpu_set) == 1 && CPU_ISSET(0, &cpu_set));
+    }
+    done = true;
+  });
+  for (int i = 0; i < kDelayMicros && !done.load(); ++i) {
+    Env::Default()->SleepForMicroseconds(1);
+  }
+  ASSERT_TRUE(done.load());
+  ASSERT_TRUE(pinned.load());
+
+  // An empty set removes the restriction.
+  ASSERT_OK(pool.SetCpuAffinity({}));
+  done = false;
+  std::atomic<int> usable_cpus(0);
+  pool.SubmitJob([&] {
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0) {
+      usable_cpus = CPU_COUNT(&cpu_set);
+    }
+    done = true;
+  });
+  for (int i = 0; i < kDelayMicros && !done.load(); ++i) {
+    Env::Default()->SleepForMicroseconds(1);
+  }
+  ASSERT_TRUE(done.load());
+  ASSERT_GE(usable_cpus.load(), 1);
+
+  pool.WaitForJobsAndJoinAllThreads();
+}
 #endif
 
 TEST_F(EnvPosixTest, MemoryMappedFileBuffer) {
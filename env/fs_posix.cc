@@ -305,6 +305,11 @@ class PosixFileSystem : public FileSystem {
     } else {
       flags |= O_WRONLY;
     }
+#ifdef O_DSYNC
+    if (options.use_dsync_writes && !options.use_mmap_writes) {
+      flags |= O_DSYNC;
+    }
+#endif
 
     flags = cloexec_flags(flags, &options);
 
@@ -393,6 +398,11 @@ class PosixFileSystem : public FileSystem {
     } else {
       flags |= O_WRONLY;
     }
+#ifdef O_DSYNC
+    if (options.use_dsync_writes && !options.use_mmap_writes) {
+      flags |= O_DSYNC;
+    }
+#endif
 
     flags = cloexec_flags(flags, &options);
 
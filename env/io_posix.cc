@@ -648,6 +648,30 @@ IOStatus PosixRandomAccessFile::Read(uint64_t offset, size_t n,
   return s;
 }
 
+#if defined(ROCKSDB_IOURING_PRESENT)
+namespace {
+// Map the activity issuing a read to a kernel I/O priority for the io_uring
+// submission (sqe->ioprio). Background maintenance reads go to the idle
+// class so they yield to foreground reads under device contention; all
+// other activities keep the default (best-effort) priority. Encoding is
+// from linux/ioprio.h, which liburing does not re-export. Like the
+// per-thread ioprio_set done by Env::LowerThreadPoolIOPriority for the
+// synchronous read/write paths, this only has an effect with an I/O
+// scheduler that supports I/O priorities.
+unsigned short IoUringPrioForActivity(const IOOptions& opts) {
+  constexpr int kIoprioClassShift = 13;
+  constexpr unsigned short kIoprioClassIdle = 3 << kIoprioClassShift;
+  switch (opts.io_activity) {
+    case Env::IOActivity::kFlush:
+    case Env::IOActivity::kCompaction:
+      return kIoprioClassIdle;
+    default:
+      return 0;
+  }
+}
+}  // namespace
+#endif
+
 IOStatus PosixRandomAccessFile::MultiRead(FSReadRequest* reqs, size_t num_reqs,
                                           const IOOptions& options,
                                           IODebugContext* dbg) {
@@ -722,6 +746,7 @@ IOStatus PosixRandomAccessFile::MultiRead(FSReadRequest* reqs, size_t num_reqs,
       io_uring_prep_readv(
           sqe, fd_, &rep_to_submit->iov, 1,
           rep_to_submit->req->offset + rep_to_submit->finished_len);
+      sqe->ioprio = IoUringPrioForActivity(options);
       io_uring_sqe_set_data(sqe, rep_to_submit);
       wrap_cache.emplace(rep_to_submit);
     }
@@ -900,7 +925,7 @@ IOStatus PosixRandomAccessFile::InvalidateCache(size_t offset, size_t length) {
 }
 
 IOStatus PosixRandomAccessFile::ReadAsync(
-    FSReadRequest& req, const IOOptions& /*opts*/,
+    FSReadRequest& req, const IOOptions& opts,
     std::function<void(FSReadRequest&, void*)> cb, void* cb_arg,
     void** io_handle, IOHandleDeleter* del_fn, IODebugContext* /*dbg*/) {
   if (use_direct_io()) {
@@ -927,6 +952,16 @@ IOStatus PosixRandomAccessFile::ReadAsync(
     return IOStatus::NotSupported("ReadAsync");
   }
 
+  // Grab a submission queue entry before allocating the io_handle, so a
+  // full submission queue doesn't leave the caller holding a handle for a
+  // request that was never queued. Callers fall back to synchronous reads
+  // on a non-OK status.
+  struct io_uring_sqe* sqe;
+  sqe = io_uring_get_sqe(iu);
+  if (sqe == nullptr) {
+    return IOStatus::Busy("io_uring submission queue is full");
+  }
+
   // Allocate io_handle.
   IOHandleDeleter deletefn = [](void* args) -> void {
     delete (static_cast<Posix_IOHandle*>(args));
@@ -944,11 +979,10 @@ IOStatus PosixRandomAccessFile::ReadAsync(
   *del_fn = deletefn;
 
   // Step 3: io_uring_sqe_set_data
-  struct io_uring_sqe* sqe;
-  sqe = io_uring_get_sqe(iu);
 
   io_uring_prep_readv(sqe, fd_, /*sqe->addr=*/&posix_handle->iov,
                       /*sqe->len=*/1, /*sqe->offset=*/posix_handle->offset);
+  sqe->ioprio = IoUringPrioForActivity(opts);
 
   // Sets sqe->user_data to posix_handle.
   io_uring_sqe_set_data(sqe, posix_handle);
@@ -963,6 +997,7 @@ IOStatus PosixRandomAccessFile::ReadAsync(
   return IOStatus::OK();
 #else
   (void)req;
+  (void)opts;
   (void)cb;
   (void)cb_arg;
   (void)io_handle;
@@ -1321,6 +1356,7 @@ PosixWritableFile::PosixWritableFile(const std::string& fname, int fd,
     : FSWritableFile(options),
       filename_(fname),
       use_direct_io_(options.use_direct_writes),
+      use_dsync_writes_(options.use_dsync_writes),
       fd_(fd),
       filesize_(0),
       logical_sector_size_(logical_block_size) {
@@ -1449,6 +1485,15 @@ IOStatus PosixWritableFile::Flush(const IOOptions& /*opts*/,
 
 IOStatus PosixWritableFile::Sync(const IOOptions& /*opts*/,
                                  IODebugContext* /*dbg*/) {
+#ifndef HAVE_FULLFSYNC
+  // With O_DSYNC every completed write already persisted the data and the
+  // metadata needed to retrieve it, so there is nothing left to sync. (When
+  // F_FULLFSYNC is required for durability, O_DSYNC is not sufficient and
+  // the regular path below is used.)
+  if (use_dsync_writes_) {
+    return IOStatus::OK();
+  }
+#endif  // HAVE_FULLFSYNC
 #ifdef HAVE_FULLFSYNC
   if (::fcntl(fd_, F_FULLFSYNC) < 0) {
     return IOError("while fcntl(F_FULLFSYNC)", filename_, errno);
@@ -358,6 +358,7 @@ class PosixWritableFile : public FSWritableFile {
  protected:
   const std::string filename_;
   const bool use_direct_io_;
+  const bool use_dsync_writes_;
   int fd_;
   uint64_t filesize_;
   size_t logical_sector_size_;
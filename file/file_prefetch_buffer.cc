@@ -178,11 +178,19 @@ Status FilePrefetchBuffer::Prefetch(const IOOptions& opts,
 
   TEST_SYNC_POINT("FilePrefetchBuffer::Prefetch:Start");
 
-  if (offset + n <= buf->offset_ + buf->CurrentSize()) {
+  if (offset >= buf->offset_ &&
+      offset + n <= buf->offset_ + buf->CurrentSize()) {
     // All requested bytes are already in the buffer. So no need to Read again.
     return Status::OK();
   }
 
+  if (offset < buf->offset_) {
+    // A backward-sequential caller is requesting a range below the buffered
+    // one. The tail-refit logic below only grows the buffer forward, so drop
+    // the stale contents and load the requested range from scratch.
+    buf->ClearBuffer();
+  }
+
   size_t alignment = GetRequiredBufferAlignment(reader);
   uint64_t rounddown_offset = offset, roundup_end = 0, aligned_useful_len = 0;
   size_t read_len = 0;
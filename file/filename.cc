@@ -84,6 +84,13 @@ std::string LogFileName(uint64_t number) {
   return MakeFileName(number, "log");
 }
 
+const std::string kPreparedLogFileSuffix = ".prepare";
+
+std::string PreparedLogFileName(const std::string& name, uint64_t number) {
+  assert(number > 0);
+  return LogFileName(name, number) + kPreparedLogFileSuffix;
+}
+
 std::string BlobFileName(uint64_t number) {
   assert(number > 0);
   return MakeFileName(number, kRocksDBBlobFileExt.c_str());
@@ -44,6 +44,16 @@ std::string LogFileName(const std::string& dbname, uint64_t number);
 
 std::string LogFileName(uint64_t number);
 
+// Suffix appended to a WAL file name for logs pre-created by the WAL
+// preparation task (see DBOptions::prepare_log_file_num). These names do
+// not parse as any FileType, so they are invisible to recovery and to
+// obsolete file deletion.
+extern const std::string kPreparedLogFileSuffix;
+
+// Return the name of a pre-created WAL file with the specified number in
+// the directory "name".
+std::string PreparedLogFileName(const std::string& name, uint64_t number);
+
 std::string BlobFileName(uint64_t number);
 
 std::string BlobFileName(const std::string& bdirname, uint64_t number);
@@ -963,6 +963,97 @@ TEST_P(PrefetchTest, ConfigureNumFilesReadsForReadaheadSize) {
   Close();
 }
 
+// This test verifies that a backward-sequential scan (SeekForPrev followed
+// by Prev) triggers prefetching of the blocks preceding the current one, via
+// the FS prefetch hint when supported and the internal prefetch buffer
+// otherwise.
+TEST_P(PrefetchTest, BackwardScanPrefetch) {
+  // First param is if the mockFS support_prefetch or not
+  bool support_prefetch =
+      std::get<0>(GetParam()) &&
+      test::IsPrefetchSupported(env_->GetFileSystem(), dbname_);
+
+  const int kNumKeys = 2000;
+  std::shared_ptr<MockFS> fs =
+      std::make_shared<MockFS>(env_->GetFileSystem(), support_prefetch);
+  std::unique_ptr<Env> env(new CompositeEnvWrapper(env_, fs));
+
+  // Second param is if directIO is enabled or not
+  bool use_direct_io = std::get<1>(GetParam());
+
+  Options options;
+  SetGenericOptions(env.get(), use_direct_io, options);
+  BlockBasedTableOptions table_options;
+  SetBlockBasedTableOptions(table_options);
+  options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+
+  int buff_prefetch_count = 0;
+  SyncPoint::GetInstance()->SetCallBack("FilePrefetchBuffer::Prefetch:Start",
+                                        [&](void*) { buff_prefetch_count++; });
+  SyncPoint::GetInstance()->EnableProcessing();
+
+  Status s = TryReopen(options);
+  if (use_direct_io && (s.IsNotSupported() || s.IsInvalidArgument())) {
+    // If direct IO is not supported, skip the test
+    return;
+  } else {
+    ASSERT_OK(s);
+  }
+
+  WriteBatch batch;
+  Random rnd(309);
+  for (int i = 0; i < kNumKeys; i++) {
+    ASSERT_OK(batch.Put(BuildKey(i), rnd.RandomString(1000)));
+  }
+  ASSERT_OK(db_->Write(WriteOptions(), &batch));
+
+  std::string start_key = BuildKey(0);
+  std::string end_key = BuildKey(kNumKeys - 1);
+  Slice least(start_key.data(), start_key.size());
+  Slice greatest(end_key.data(), end_key.size());
+
+  ASSERT_OK(db_->CompactRange(CompactRangeOptions(), &least, &greatest));
+
+  Close();
+  ASSERT_OK(TryReopen(options));
+
+  fs->ClearPrefetchCount();
+  buff_prefetch_count = 0;
+
+  {
+    auto iter = std::unique_ptr<Iterator>(db_->NewIterator(ReadOptions()));
+    // Walk the whole key space backward. After
+    // num_file_reads_for_auto_readahead consecutive backward block reads,
+    // windows ending at the current block should be prefetched, doubling up
+    // to max_auto_readahead_size just like the forward readahead.
+    int num_keys = 0;
+    for (iter->SeekForPrev(BuildKey(kNumKeys - 1)); iter->Valid();
+         iter->Prev()) {
+      ASSERT_OK(iter->status());
+      ASSERT_EQ(iter->key(), BuildKey(kNumKeys - 1 - num_keys));
+      num_keys++;
+    }
+    ASSERT_OK(iter->status());
+    ASSERT_EQ(num_keys, kNumKeys);
+
+    if (support_prefetch && !use_direct_io) {
+      // Multiple backward windows rule out a false positive from a single
+      // table-open tail prefetch.
+      ASSERT_GT(fs->GetPrefetchCount(), 1);
+      ASSERT_EQ(buff_prefetch_count, 0);
+      fs->ClearPrefetchCount();
+    } else {
+      ASSERT_FALSE(fs->IsPrefetchCalled());
+      ASSERT_GT(buff_prefetch_count, 1);
+      buff_prefetch_count = 0;
+    }
+  }
+
+  SyncPoint::GetInstance()->DisableProcessing();
+  SyncPoint::GetInstance()->ClearAllCallBacks();
+  Close();
+}
+
 // This test verifies the basic functionality of implicit autoreadahead:
 // - Enable implicit autoreadahead and prefetch only if sequential blocks are
 //   read,
@@ -122,13 +122,18 @@ IOStatus RandomAccessFileReader::Read(const IOOptions& opts, uint64_t offset,
 
   IOStatus io_s;
   uint64_t elapsed = 0;
-  size_t alignment = file_->GetRequiredBufferAlignment();
+  // Alignment is only relevant to direct I/O; skip the virtual call and the
+  // alignment checks on the buffered read path.
+  size_t alignment = 0;
   bool is_aligned = false;
-  if (scratch != nullptr) {
-    // Check if offset, length and buffer are aligned.
-    is_aligned = (offset & (alignment - 1)) == 0 &&
-                 (n & (alignment - 1)) == 0 &&
-                 (uintptr_t(scratch) & (alignment - 1)) == 0;
+  if (use_direct_io()) {
+    alignment = file_->GetRequiredBufferAlignment();
+    if (scratch != nullptr) {
+      // Check if offset, length and buffer are aligned.
+      is_aligned = (offset & (alignment - 1)) == 0 &&
+                   (n & (alignment - 1)) == 0 &&
+                   (uintptr_t(scratch) & (alignment - 1)) == 0;
+    }
   }
 
   {
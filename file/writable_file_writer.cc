@@ -359,8 +359,11 @@ IOStatus WritableFileWriter::Flush(const IOOptions& opts) {
     return GetWriterHasPreviousErrorStatus();
   }
 
-  const IOOptions io_options = FinalizeIOOptions(opts);
+  return FlushInternal(FinalizeIOOptions(opts));
+}
 
+IOStatus WritableFileWriter::FlushInternal(const IOOptions& io_options) {
+  // Caller is supposed to check seen_error_
   IOStatus s;
   TEST_KILL_RANDOM_WITH_WEIGHT("WritableFileWriter::Flush:0", REDUCE_ODDS2);
 
@@ -470,7 +473,7 @@ IOStatus WritableFileWriter::Sync(const IOOptions& opts, bool use_fsync) {
   }
 
   IOOptions io_options = FinalizeIOOptions(opts);
-  IOStatus s = Flush(io_options);
+  IOStatus s = FlushInternal(io_options);
   if (!s.ok()) {
     set_seen_error(s);
     return s;
@@ -508,6 +511,25 @@ IOStatus WritableFileWriter::SyncWithoutFlush(const IOOptions& opts,
   return s;
 }
 
+IOStatus WritableFileWriter::InitiateWriteback(const IOOptions& opts) {
+  if (seen_error()) {
+    return GetWriterHasPreviousErrorStatus();
+  }
+  IOStatus s;
+  if (!use_direct_io()) {
+    IOOptions io_options = FinalizeIOOptions(opts);
+    uint64_t flushed = flushed_size_.load(std::memory_order_acquire);
+    if (flushed > last_sync_size_) {
+      // Intentionally does not update last_sync_size_: re-requesting
+      // writeback of already clean pages is cheap, and the periodic
+      // bytes_per_sync range sync in Flush() assumes last_sync_size_ only
+      // tracks its own progress.
+      s = RangeSync(io_options, last_sync_size_, flushed - last_sync_size_);
+    }
+  }
+  return s;
+}
+
 IOStatus WritableFileWriter::SyncInternal(const IOOptions& opts,
                                           bool use_fsync) {
   // Caller is supposed to check seen_error_
@@ -269,6 +269,13 @@ class WritableFileWriter {
   // returns NotSupported status.
   IOStatus SyncWithoutFlush(const IOOptions& opts, bool use_fsync);
 
+  // Initiate OS writeback of the data that was already Flush()ed, without
+  // waiting for it to reach storage, so that a later Sync() has less dirty
+  // data left to wait on. Best effort: a no-op for direct I/O (data does not
+  // go through the OS page cache) and on file systems without range sync
+  // support.
+  IOStatus InitiateWriteback(const IOOptions& opts);
+
   // Size including unflushed data written to this writer. If the next op is
   // a successful Close, the file size will be this.
   uint64_t GetFileSize() const {
@@ -364,6 +371,8 @@ class WritableFileWriter {
   // `opts` should've been called with `FinalizeIOOptions()` before passing in
   IOStatus RangeSync(const IOOptions& opts, uint64_t offset, uint64_t nbytes);
   // `opts` should've been called with `FinalizeIOOptions()` before passing in
+  IOStatus FlushInternal(const IOOptions& opts);
+  // `opts` should've been called with `FinalizeIOOptions()` before passing in
   IOStatus SyncInternal(const IOOptions& opts, bool use_fsync);
   IOOptions FinalizeIOOptions(const IOOptions& opts) const;
 };
@@ -299,6 +299,22 @@ class Cache : public Customizable {
     return Lookup(key, nullptr, nullptr, Priority::LOW, stats);
   }
 
+  // Lookup a batch of independent keys, with the result for keys[i]
+  // returned in handles[i] (nullptr if not found). Semantically equivalent
+  // to calling Lookup() on each key in order, but sharded implementations
+  // group the keys by shard and resolve each shard's group with a single
+  // shard operation (e.g. one mutex acquisition for mutex-based shards),
+  // which is cheaper than one per key when several keys are known up front.
+  // All keys share the same helper, create_context and priority. NOTE:
+  // when a secondary cache is configured, this currently degrades to
+  // per-key Lookup() so that secondary cache promotion still applies.
+  virtual void MultiLookup(size_t num_keys, const Slice* keys,
+                           Handle** handles,
+                           const CacheItemHelper* helper = nullptr,
+                           CreateContext* create_context = nullptr,
+                           Priority priority = Priority::LOW,
+                           Statistics* stats = nullptr);
+
   // Increments the reference count for the handle if it refers to an entry in
   // the cache. Returns true if refcount was incremented; otherwise, returns
   // false.
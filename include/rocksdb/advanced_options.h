@@ -310,8 +310,11 @@ struct AdvancedColumnFamilyOptions {
 
   // Should really be called `memtable_bloom_size_ratio`. Enables a dynamic
   // Bloom filter in memtable to optimize many queries that must go beyond
-  // the memtable. The size in bytes of the filter is
-  // write_buffer_size * memtable_prefix_bloom_size_ratio.
+  // the memtable. The size in bytes of the filter is at most
+  // write_buffer_size * memtable_prefix_bloom_size_ratio; it may be sized
+  // smaller based on the number of entries the previous memtable of the
+  // column family held, to keep more of the filter in CPU cache when
+  // memtables hold fewer, larger entries than the ratio assumes.
   // * If prefix_extractor is set, the filter includes prefixes.
   // * If memtable_whole_key_filtering, the filter includes whole keys.
   // * If both, the filter includes both.
@@ -353,8 +356,11 @@ struct AdvancedColumnFamilyOptions {
   // Currently only the default skiplist based memtable implements the feature.
   // All other memtable implementation will ignore the option. It incurs ~250
   // additional bytes of memory overhead to store a hint for each prefix.
+  // Hints are stored in the memtable itself, so they persist across write
+  // batches for the lifetime of the memtable.
   // Also concurrent writes (when allow_concurrent_memtable_write is true) will
-  // ignore the option.
+  // ignore the option; see WriteOptions::memtable_insert_hint_per_batch for
+  // the per-batch hints available in that mode.
   //
   // The option is best suited for workloads where keys will likely to insert
   // to a location close the last inserted key with the same prefix.
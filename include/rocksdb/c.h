@@ -581,6 +581,33 @@ extern ROCKSDB_LIBRARY_API void rocksdb_batched_multi_get_cf(
     const char* const* keys_list, const size_t* keys_list_sizes,
     rocksdb_pinnableslice_t** values, char** errs, const bool sorted_input);
 
+// Variant of rocksdb_batched_multi_get_cf that writes all found values
+// contiguously into a single caller-provided buffer instead of returning one
+// allocation per value, so that foreign-function bindings can retrieve many
+// values with a single call and no per-value malloc.
+//
+// value_buf, value_buf_size - output buffer, allocated by the caller, and
+//   its capacity in bytes.
+// value_offsets, value_sizes - caller-allocated arrays of num_keys entries.
+//   The value of a found key i occupies bytes
+//   [value_offsets[i], value_offsets[i] + value_sizes[i]) of value_buf.
+// found_list - caller-allocated array of num_keys entries; found_list[i] is
+//   1 if key i was found, otherwise 0 (and value_sizes[i] is 0).
+// errs - as in rocksdb_multi_get_cf: errs[i] is NULL on success or not
+//   found, otherwise a malloc()ed, null terminated error string.
+//
+// Returns the total number of value bytes needed. If the returned size is
+// greater than value_buf_size, the values that did not fit were left
+// uncopied (their offsets and sizes are still filled in); call again with a
+// buffer of at least the returned size.
+extern ROCKSDB_LIBRARY_API size_t rocksdb_multi_get_cf_into_buffer(
+    rocksdb_t* db, const rocksdb_readoptions_t* options,
+    rocksdb_column_family_handle_t* column_family, size_t num_keys,
+    const char* const* keys_list, const size_t* keys_list_sizes,
+    char* value_buf, size_t value_buf_size, size_t* value_offsets,
+    size_t* value_sizes, unsigned char* found_list, char** errs,
+    const bool sorted_input);
+
 // The value is only allocated (using malloc) and returned if it is found and
 // value_found isn't NULL. In that case the user is responsible for freeing it.
 extern ROCKSDB_LIBRARY_API unsigned char rocksdb_key_may_exist(
@@ -738,6 +765,22 @@ extern ROCKSDB_LIBRARY_API void rocksdb_iter_seek_for_prev(rocksdb_iterator_t*,
                                                            const char* k,
                                                            size_t klen);
 extern ROCKSDB_LIBRARY_API void rocksdb_iter_next(rocksdb_iterator_t*);
+// Copies up to num_pairs key-value pairs, starting at the current position,
+// into a single caller-provided buffer, advancing the iterator past each
+// pair copied. Keys and values are laid out back to back in buf, with their
+// locations recorded in the caller-allocated key_offsets, key_sizes,
+// value_offsets and value_sizes arrays (num_pairs entries each).
+//
+// Stops early when the iterator becomes invalid or when the next pair does
+// not fit in the remaining buffer space; in the latter case the iterator is
+// left positioned on the pair that did not fit, so the caller can continue
+// with a fresh (or larger) buffer. Returns the number of pairs copied. As
+// with rocksdb_iter_next, check rocksdb_iter_get_error once the iterator
+// becomes invalid.
+extern ROCKSDB_LIBRARY_API size_t rocksdb_iter_next_batch(
+    rocksdb_iterator_t* iter, size_t num_pairs, char* buf, size_t buf_size,
+    size_t* key_offsets, size_t* key_sizes, size_t* value_offsets,
+    size_t* value_sizes);
 extern ROCKSDB_LIBRARY_API void rocksdb_iter_prev(rocksdb_iterator_t*);
 extern ROCKSDB_LIBRARY_API const char* rocksdb_iter_key(
     const rocksdb_iterator_t*, size_t* klen);
@@ -576,4 +576,30 @@ Status UpdateTieredCache(
     const std::shared_ptr<Cache>& cache, int64_t total_capacity = -1,
     double compressed_secondary_ratio = std::numeric_limits<double>::max(),
     TieredAdmissionPolicy adm_policy = TieredAdmissionPolicy::kAdmPolicyMax);
+
+// EXPERIMENTAL
+// A point-in-time snapshot of a TieredCache's capacity split and cumulative
+// secondary cache activity, for use with GetTieredCacheUsageInfo below.
+struct TieredCacheUsageInfo {
+  // Total memory budget, divided between the tiers
+  size_t total_capacity = 0;
+  // Portion of total_capacity currently assigned to the compressed
+  // secondary cache
+  size_t compressed_secondary_capacity = 0;
+  double compressed_secondary_ratio = 0.0;
+  // Cumulative count/bytes of blocks served out of the secondary cache and
+  // promoted to the primary since the cache was created
+  uint64_t secondary_hit_count = 0;
+  uint64_t secondary_hit_bytes = 0;
+};
+
+// EXPERIMENTAL
+// Query the current state of a TieredCache allocated by NewTieredCache.
+// Unlike the SECONDARY_CACHE_HITS statistics ticker, the counters here are
+// scoped to the cache itself, so they remain meaningful when the cache is
+// shared by multiple DBs. Sampling these periodically gives the byte hit
+// rate of the secondary tier, which can be used to drive re-tuning of the
+// capacity split via UpdateTieredCache.
+Status GetTieredCacheUsageInfo(const std::shared_ptr<Cache>& cache,
+                               TieredCacheUsageInfo* info);
 }  // namespace ROCKSDB_NAMESPACE
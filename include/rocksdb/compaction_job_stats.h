@@ -120,6 +120,17 @@ struct CompactionJobStats {
   // number of single-deletes which meet something other than a put
   uint64_t num_single_del_mismatch = 0;
 
+  // number of times the compaction iterator's reusable key buffer had to be
+  // reallocated to fit a larger key
+  uint64_t num_key_buffer_reallocations = 0;
+
+  // number of times the compaction iterator's reusable value buffers
+  // (compaction filter result, blob index scratch) had to be reallocated.
+  // Together with num_key_buffer_reallocations, this should stay near zero
+  // once the per-key working set reaches its high-water mark; nonzero counts
+  // in steady state indicate allocator traffic in the merge loop.
+  uint64_t num_value_buffer_reallocations = 0;
+
   // TODO: Add output_to_proximal_level output information
 };
 }  // namespace ROCKSDB_NAMESPACE
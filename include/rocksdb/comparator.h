@@ -114,6 +114,14 @@ class Comparator : public Customizable, public CompareInterface {
   // with the customized comparator.
   virtual bool CanKeysWithDifferentByteContentsBeEqual() const { return true; }
 
+  // If all keys seen by this comparator have one fixed length, return that
+  // length in bytes; return 0 (the default) for variable-length keys. A
+  // nonzero return additionally promises that Compare() orders keys exactly
+  // like memcmp() over the full key. Comparisons against comparators that
+  // declare a supported width may internally be routed to width-specialized
+  // compare kernels that beat a length-generic memcmp.
+  virtual size_t FixedKeyWidth() const { return 0; }
+
   // if it is a wrapped comparator, may return the root one.
   // return itself it is not wrapped.
   virtual const Comparator* GetRootComparator() const { return this; }
@@ -48,4 +48,23 @@ class ConcurrentTaskLimiter {
 ConcurrentTaskLimiter* NewConcurrentTaskLimiter(const std::string& name,
                                                 int32_t limit);
 
+// Create a ConcurrentTaskLimiter that, like NewConcurrentTaskLimiter,
+// enforces a global limit on concurrent tasks, and additionally balances
+// the budget across the DB instances sharing the limiter: an instance is
+// only admitted while its own outstanding task count is below
+// max(min_tasks_per_instance, limit / number of instances with outstanding
+// tasks). This keeps one busy instance from monopolizing the background
+// budget of a host running many instances, while the share of idle
+// instances is redistributed to busy ones.
+//
+// @param name: Name of the limiter.
+// @param limit: max concurrent tasks across all instances.
+//        limit = 0 means no new task allowed.
+//        limit < 0 means no limitation.
+// @param min_tasks_per_instance: number of concurrent tasks each instance
+//        is always allowed (within the global limit), regardless of how
+//        many instances are busy. Values below 1 are treated as 1.
+ConcurrentTaskLimiter* NewFairConcurrentTaskLimiter(
+    const std::string& name, int32_t limit, int32_t min_tasks_per_instance);
+
 }  // namespace ROCKSDB_NAMESPACE
@@ -11,6 +11,7 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -117,6 +118,18 @@ struct GetMergeOperandsOptions {
   //
   // If it is nullptr, `GetMergeOperands()` will behave as if it always returned
   // true (continue fetching merge operands until there are no more).
+  //
+  // When `continue_cb` is set, the `merge_operands` array argument to
+  // `GetMergeOperands()` may be nullptr. In that case the operands are only
+  // streamed to `continue_cb` (newest to oldest) and never materialized, and
+  // `expected_max_number_of_operands` is ignored. This is useful for callers
+  // that fold the operands on the fly (e.g. summing counters), possibly
+  // stopping early, and avoids both the copy/pin of each operand and the
+  // caller-side array sized for the worst-case operand count. Since the
+  // callback is not invoked on a base value, a caller that needs to handle
+  // chains ending in a plain Put can detect that case by comparing
+  // `*number_of_operands` (which includes the base value) against the number
+  // of callback invocations.
   ContinueCallback continue_cb;
 };
 
@@ -601,6 +614,23 @@ class DB {
     return DeleteRange(options, DefaultColumnFamily(), begin_key, end_key, ts);
   }
 
+  // Atomically removes the database entries covered by the `n` ranges in
+  // `ranges`, each interpreted like DeleteRange's ["start", "limit").
+  // `ranges` must be sorted in ascending order of start key according to the
+  // column family's comparator; a `Status::InvalidArgument` is returned
+  // otherwise, or if any range's limit comes before its start.
+  //
+  // Adjacent and overlapping ranges are coalesced into a single range
+  // tombstone before being written, so the number of tombstones accumulated
+  // in the memtable is proportional to the number of distinct gaps rather
+  // than the number of input ranges. Prefer this over issuing many
+  // contiguous DeleteRange calls (see caveat 1 on DeleteRange above).
+  //
+  // Not supported for column families with user-defined timestamps.
+  virtual Status DeleteRanges(const WriteOptions& options,
+                              ColumnFamilyHandle* column_family,
+                              const Range* ranges, size_t n);
+
   // Merge the database entry for "key" with "value".  Returns OK on success,
   // and a non-OK status on error. The semantics of this operation is
   // determined by the user provided merge_operator when opening DB.
@@ -747,7 +777,10 @@ class DB {
   //
   // `merge_operands`- Points to an array of at-least
   //             merge_operands_options.expected_max_number_of_operands and the
-  //             caller is responsible for allocating it.
+  //             caller is responsible for allocating it. May be nullptr when
+  //             `GetMergeOperandsOptions::continue_cb` is set, in which case
+  //             the operands are only streamed to the callback and not
+  //             materialized.
   //
   // The caller should delete or `Reset()` the `merge_operands` entries when
   // they are no longer needed. All `merge_operands` entries must be destroyed
@@ -1295,6 +1328,19 @@ class DB {
     //      files belong to the CF's current version.
     static const std::string kLiveSstFilesSize;
 
+    //  "rocksdb.max-live-sst-seqno" - returns the largest sequence number of
+    //      any entry in the CF's live SST files. Every write to this CF with
+    //      a sequence number at or below this value has been persisted to an
+    //      SST file. Because compaction may zero out sequence numbers of
+    //      entries visible to all snapshots, this is a (possibly regressing)
+    //      lower bound on the flushed point rather than an exact watermark.
+    //      Useful with WriteOptions::disableWAL when an external log (e.g. a
+    //      replication log) is the source of durability: after Flush(), the
+    //      external log can be trimmed up to this sequence number, and after
+    //      a crash, replay can resume from it (replaying already-persisted
+    //      entries must be tolerated).
+    static const std::string kMaxLiveSstSeqno;
+
     //  "rocksdb.obsolete-sst-files-size" - returns total size (bytes) of all
     //      SST files that became obsolete but have not yet been deleted or
     //      scheduled for deletion. SST files can end up in this state when
@@ -1748,6 +1794,22 @@ class DB {
   // sync is done.
   virtual Status SyncWAL() = 0;
 
+  // EXPERIMENTAL
+  // Initiate a WAL sync in the background and return without waiting for it.
+  // `callback` is invoked from a background thread with the result of the
+  // sync once all WAL writes that completed before this call are durable
+  // (or with a non-OK status if the sync failed). Callbacks from successive
+  // calls are invoked in call order, and several calls may be satisfied by
+  // a single sync. As with SyncWAL(), FlushWAL(false) must be called first
+  // when using manual_wal_flush=true.
+  //
+  // Callbacks should be lightweight and must not call back into the DB:
+  // they may run while internal locks are held, in particular when pending
+  // callbacks are failed with Status::ShutdownInProgress() during Close().
+  virtual Status SyncWALAsync(std::function<void(Status)> /*callback*/) {
+    return Status::NotSupported("SyncWALAsync not implemented");
+  }
+
   // Freezes the logical state of the DB (by stopping writes), and if WAL is
   // enabled, ensures that state has been flushed to DB files (as in
   // FlushWAL()). This can be used for taking a Checkpoint at a known DB
@@ -93,6 +93,13 @@ struct EnvOptions {
   // If true, then use O_DIRECT for writing data
   bool use_direct_writes = false;
 
+  // If true, open the file for synchronous writes (O_DSYNC where supported)
+  // so that every completed write is durable, including the metadata needed
+  // to retrieve it. Sync() on such a file may then be a no-op. File systems
+  // without synchronous-write support ignore this option and keep their
+  // regular Sync() behavior. Not compatible with use_mmap_writes.
+  bool use_dsync_writes = false;
+
   // If false, fallocate() calls are bypassed
   bool allow_fallocate = true;
 
@@ -592,6 +599,17 @@ class Env : public Customizable {
   // Lower CPU priority for threads from the specified pool.
   virtual void LowerThreadPoolCPUPriority(Priority /*pool*/ = LOW) {}
 
+  // Restrict the CPUs that threads from the specified pool may run on, e.g.
+  // the CPUs of the NUMA node holding the DB's memtables and block cache so
+  // background work stays local to that node. An empty `cpus` removes the
+  // restriction.
+  virtual Status SetThreadPoolCpuAffinity(Priority /*pool*/,
+                                          const std::vector<int>& /*cpus*/) {
+    return Status::NotSupported(
+        "Env::SetThreadPoolCpuAffinity(Priority, const std::vector<int>&) not "
+        "supported");
+  }
+
   // Converts seconds-since-Jan-01-1970 to a printable string
   virtual std::string TimeToString(uint64_t time) = 0;
 
@@ -1637,6 +1655,11 @@ class EnvWrapper : public Env {
     return target_.env->LowerThreadPoolCPUPriority(pool, pri);
   }
 
+  Status SetThreadPoolCpuAffinity(Priority pool,
+                                  const std::vector<int>& cpus) override {
+    return target_.env->SetThreadPoolCpuAffinity(pool, cpus);
+  }
+
   std::string TimeToString(uint64_t time) override {
     return target_.env->TimeToString(time);
   }
@@ -56,6 +56,69 @@ class FlushBlockPolicyFactory : public Customizable {
   virtual ~FlushBlockPolicyFactory() {}
 };
 
+struct FlushBlockByRangeOptions {
+  static const char* kName() { return "FlushBlockByRangeOptions"; }
+  // "start:end" user-key pairs separated by ',', e.g. "a:b,k:p". Keys are
+  // compared bytewise, so this is only meaningful with a bytewise-ordered
+  // comparator, and keys containing ':' or ',' are not representable.
+  std::string hot_ranges;
+  // Target data block size for blocks whose first key falls in one of
+  // hot_ranges. Blocks outside hot ranges use the table-wide block_size.
+  uint64_t hot_block_size = 4 * 1024;
+};
+
+// A FlushBlockPolicyFactory for mixed point-read/scan workloads with known
+// hot key ranges: data blocks starting inside a hot range are cut at
+// hot_block_size (small blocks amplify point reads less), while the rest of
+// the file keeps the table-wide block_size (large blocks compress better).
+// A block's size target is decided by its first key, so a block may straddle
+// a range boundary.
+class FlushBlockByRangePolicyFactory : public FlushBlockPolicyFactory {
+ public:
+  FlushBlockByRangePolicyFactory();
+
+  static const char* kClassName() { return "FlushBlockByRangePolicyFactory"; }
+  const char* Name() const override { return kClassName(); }
+
+  FlushBlockPolicy* NewFlushBlockPolicy(
+      const BlockBasedTableOptions& table_options,
+      const BlockBuilder& data_block_builder) const override;
+
+ private:
+  FlushBlockByRangeOptions options_;
+};
+
+struct FlushBlockByValueSizeOptions {
+  static const char* kName() { return "FlushBlockByValueSizeOptions"; }
+  // Values of at least this size are placed in a data block of their own
+  // instead of sharing a block with neighboring keys. 0 disables isolation,
+  // leaving plain by-size behavior.
+  uint64_t large_value_threshold = 16 * 1024;
+};
+
+// A FlushBlockPolicyFactory for column families that mix small and large
+// values (e.g. with values below BlobDB's separation threshold): values of
+// at least large_value_threshold are cut into single-entry data blocks while
+// the surrounding keys keep the table-wide block_size. Key-dense blocks stay
+// compact in the block cache and scans do not drag multi-KB values through
+// it unless those entries are actually read.
+class FlushBlockByValueSizePolicyFactory : public FlushBlockPolicyFactory {
+ public:
+  FlushBlockByValueSizePolicyFactory();
+
+  static const char* kClassName() {
+    return "FlushBlockByValueSizePolicyFactory";
+  }
+  const char* Name() const override { return kClassName(); }
+
+  FlushBlockPolicy* NewFlushBlockPolicy(
+      const BlockBasedTableOptions& table_options,
+      const BlockBuilder& data_block_builder) const override;
+
+ private:
+  FlushBlockByValueSizeOptions options_;
+};
+
 class FlushBlockBySizePolicyFactory : public FlushBlockPolicyFactory {
  public:
   FlushBlockBySizePolicyFactory();
@@ -88,9 +88,13 @@ class IteratorBase : public Cleanable {
   // status() to non-OK if there is an error while loading or preparing the
   // value.
   //
-  // Note: this option currently only applies to 1) large values stored in blob
-  // files using BlobDB and 2) multi-column-family iterators (CoalescingIterator
-  // and AttributeGroupIterator). Otherwise, it has no effect.
+  // Note: this option currently applies to 1) large values stored in blob
+  // files using BlobDB, 2) multi-column-family iterators (CoalescingIterator
+  // and AttributeGroupIterator), and 3) plain values during forward iteration
+  // over block-based tables whose index includes the first key of each block
+  // (IndexType::kBinarySearchWithFirstKey), where the data block itself is not
+  // read until the value is prepared, enabling key-only scans to skip block
+  // loads entirely. Otherwise, it has no effect.
   //
   // REQUIRES: Valid()
   virtual bool PrepareValue() { return true; }
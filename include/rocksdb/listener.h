@@ -534,6 +534,17 @@ struct BackgroundErrorRecoveryInfo {
   Status new_bg_error;
 };
 
+// Information about a file that failed checksum verification in
+// DB::VerifyChecksum() or DB::VerifyFileChecksums()
+struct ChecksumVerificationFailureInfo {
+  // DB name
+  std::string db_name;
+  // Path of the corrupt file
+  std::string file_path;
+  // The verification failure
+  Status status;
+};
+
 struct IOErrorInfo {
   IOErrorInfo(const IOStatus& _io_status, FileOperationType _operation,
               const std::string& _file_path, size_t _length, uint64_t _offset)
@@ -834,6 +845,15 @@ class EventListener : public Customizable {
   virtual void OnErrorRecoveryEnd(const BackgroundErrorRecoveryInfo& /*info*/) {
   }
 
+  // A callback function for RocksDB which will be called when a checksum
+  // verification requested through DB::VerifyChecksum() or
+  // DB::VerifyFileChecksums() finds a corrupt file, before the failure is
+  // returned to the caller. This lets a periodic scrub (e.g. a rate-limited
+  // VerifyFileChecksums() call) surface latent corruption to monitoring with
+  // the affected file identified, ahead of user reads hitting it.
+  virtual void OnChecksumVerificationFailure(
+      const ChecksumVerificationFailureInfo& /*info*/) {}
+
   // A callback function for RocksDB which will be called before
   // a blob file is being created. It will follow by OnBlobFileCreated after
   // the creation finishes.
@@ -84,4 +84,20 @@ Status NewJemallocNodumpAllocator(
     const JemallocAllocatorOptions& options,
     std::shared_ptr<MemoryAllocator>* memory_allocator);
 
+struct PooledAllocatorOptions {
+  static const char* kName() { return "PooledAllocatorOptions"; }
+  // Upper bound on the total bytes of freed buffers kept for reuse. Freed
+  // buffers beyond this bound are returned to the underlying allocator.
+  size_t max_recycled_bytes = 64 << 20;
+};
+
+// Generate a memory allocator that recycles freed buffers through
+// power-of-two size-classed free lists instead of returning them to the
+// heap. Intended for the block cache: blocks freed on eviction are reused
+// for subsequent block reads (which allocate through the cache's
+// allocator), so steady-state block turnover bypasses the heap allocator.
+Status NewPooledMemoryAllocator(
+    const PooledAllocatorOptions& options,
+    std::shared_ptr<MemoryAllocator>* memory_allocator);
+
 }  // namespace ROCKSDB_NAMESPACE
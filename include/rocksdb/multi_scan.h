@@ -101,13 +101,15 @@ class Scan {
         throw std::logic_error("Trying to advance invalid iterator");
       } else {
         db_iter_->Next();
-        status_ = db_iter_->status();
-        if (!status_.ok()) {
-          throw MultiScanException(status_);
+        valid_ = db_iter_->Valid();
+        if (valid_) {
+          result_ = value_type(db_iter_->key(), db_iter_->value());
         } else {
-          valid_ = db_iter_->Valid();
-          if (valid_) {
-            result_ = value_type(db_iter_->key(), db_iter_->value());
+          // Only query the status once the iterator is exhausted, like other
+          // scan loops, rather than copying a Status for every KV.
+          status_ = db_iter_->status();
+          if (!status_.ok()) {
+            throw MultiScanException(status_);
           }
         }
       }
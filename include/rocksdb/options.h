@@ -748,6 +748,13 @@ struct DBOptions {
   // Default: 16
   int max_file_opening_threads = 16;
 
+  // Number of files VerifyChecksum() and VerifyFileChecksums() verify in
+  // parallel. With the default of 1 files are verified serially, one at a
+  // time. Values larger than 1 speed up full-DB scrubs proportionally at the
+  // cost of the corresponding extra read load while verification runs.
+  // Default: 1
+  int max_file_verification_threads = 1;
+
   // Once write-ahead logs exceed this size, we will start forcing the flush of
   // column families whose memtables are backed by the oldest live WAL file
   // (i.e. the ones that are causing all the space amplification). If set to 0
@@ -864,6 +871,11 @@ struct DBOptions {
   // This value represents the maximum number of threads that will
   // concurrently perform a compaction job by breaking it into multiple,
   // smaller ones that are run simultaneously.
+  // Applies to leveled compactions from L0 and manual compactions, and to
+  // universal compactions that output below L0, including full and
+  // size-amplification compactions merging all sorted runs. Universal
+  // compactions that output to L0 always run as a single job since their
+  // output must form a single sorted run.
   // Default: 1 (i.e. no subcompactions)
   //
   // Dynamically changeable through SetDBOptions() API.
@@ -921,6 +933,29 @@ struct DBOptions {
   // Default: 0
   size_t recycle_log_file_num = 0;
 
+  // EXPERIMENTAL. If non-zero, a background task keeps up to this many
+  // pre-created WAL files ready: each is preallocated, zero-filled and
+  // synced ahead of time, so WAL rotation only renames a file instead of
+  // doing filesystem metadata work (allocation, unwritten-extent
+  // conversion) on the write path. Useful to reduce commit latency spikes
+  // at log rotation. Recycled WAL files (see recycle_log_file_num) count
+  // toward this target and are preferred when available. Unused prepared
+  // files are cleaned up on the next DB open.
+  // Default: 0 (disabled)
+  size_t prepare_log_file_num = 0;
+
+  // EXPERIMENTAL. If true, WAL files are opened for synchronous writes
+  // (O_DSYNC on POSIX) so that a durable commit is a single write with no
+  // separate fdatasync call, and Sync() on the WAL becomes a no-op. This
+  // lowers the latency floor of synchronous writes on low-latency devices
+  // (NVMe, PMEM) at the cost of making every WAL write synchronous, so
+  // non-sync writes are slowed down. Most effective combined with
+  // recycle_log_file_num or prepare_log_file_num, which keep WAL writes
+  // from allocating new blocks. Ignored by file systems without
+  // synchronous-write support.
+  // Default: false
+  bool use_dsync_for_wal = false;
+
   // manifest file is rolled over on reaching this limit.
   // The older manifest file be deleted.
   // The default value is 1GB so that the manifest file can grow, but not
@@ -1075,6 +1110,18 @@ struct DBOptions {
   // Dynamically changeable through SetDBOptions() API.
   size_t compaction_readahead_size = 2 * 1024 * 1024;
 
+  // EXPERIMENTAL
+  // If true and a block cache is configured, compaction input readers look
+  // up the block cache when sizing readahead: input blocks that are already
+  // cache-resident are served from the cache and excluded from readahead
+  // reads, cutting compaction read I/O when inputs are partially warm.
+  // Cached blocks are pinned while the readahead window covers them, so
+  // peak pinned memory is bounded by compaction_readahead_size per input
+  // file.
+  //
+  // Default: false
+  bool compaction_readahead_cache_lookup = false;
+
   // This is the maximum buffer size that is used by WritableFileWriter.
   // With direct IO, we need to maintain an aligned buffer for writes.
   // We allow the buffer to grow until it's size hits the limit in buffered
@@ -1177,6 +1224,19 @@ struct DBOptions {
   // Dynamically changeable through SetDBOptions() API.
   uint64_t delayed_write_rate = 0;
 
+  // EXPERIMENTAL
+  // If true, the delayed write rate is additionally capped by a smooth
+  // function of the distance to the stop condition: the cap decays
+  // gradually from `delayed_write_rate` at the slowdown trigger (L0 file
+  // count or soft pending compaction bytes limit) toward the minimum rate
+  // at the corresponding stop trigger, and recovers the same way as
+  // compaction catches up. This avoids throughput oscillating between
+  // full speed and a hard throttle when the workload hovers around the
+  // slowdown triggers.
+  //
+  // Default: false
+  bool use_smooth_write_delay = false;
+
   // By default, a single write thread queue is maintained. The thread gets
   // to the head of the queue becomes write batch group leader and responsible
   // for writing to WAL and memtable for the batch group.
@@ -1280,6 +1340,19 @@ struct DBOptions {
   // Default: false
   bool skip_checking_sst_file_sizes_on_db_open = false;
 
+  // If true, DB::Open() will not pre-open a table reader for every file even
+  // when max_open_files == -1. Only a small number of files, starting from
+  // L0, get their readers opened during recovery; the rest are opened on
+  // first use, where concurrent opens of the same file are coalesced by the
+  // table cache. This makes open time largely independent of the number of
+  // files, at the cost of detecting corruption in a not-yet-opened file at
+  // first read rather than at open, and of slightly slower reads until the
+  // readers have been materialized. Has no effect when max_open_files is
+  // finite, where table readers are always opened on demand.
+  //
+  // Default: false
+  bool skip_table_reader_preload_on_db_open = false;
+
   // Recovery mode to control the consistency while replaying WAL
   // Default: kPointInTimeRecovery
   WALRecoveryMode wal_recovery_mode = WALRecoveryMode::kPointInTimeRecovery;
@@ -1290,6 +1363,16 @@ struct DBOptions {
 
   // A global cache for table-level rows.
   // Used to speed up Get() queries.
+  //
+  // Entries are keyed by (SST file number, user key), plus a sequence number
+  // for reads at a snapshot older than the file, and are populated only when
+  // a lookup finds the key in that file. Keying by immutable file makes an
+  // entry trivially consistent for its lifetime: it never needs to observe
+  // memtable writes, and it naturally stops being reached once a newer
+  // version of the key lands in a file above it. The flip side is that
+  // compacting a file orphans its entries, so hit rates are best for
+  // read-mostly keys that have settled into stable lower-level files;
+  // write-hot keys re-warm after every flush or compaction that moves them.
   // NOTE: does not work with DeleteRange() yet.
   // Default: nullptr (disabled)
   std::shared_ptr<RowCache> row_cache = nullptr;
@@ -1836,9 +1919,24 @@ struct ReadOptions {
   // broken, stale keys could be served in read paths.
   bool ignore_range_deletions = false;
 
+  // EXPERIMENTAL
+  // If true, record an ordered per-stage timeline of this operation
+  // (memtable lookup, block cache probe, block read, decompression, merge)
+  // into the thread-local QueryTimeline, retrievable on the issuing thread
+  // via get_query_timeline() after the operation returns. Intended for
+  // sampled slow-query forensics; see rocksdb/query_timeline.h.
+  // Default: false
+  bool trace_timeline = false;
+
   // If async_io is enabled, RocksDB will prefetch some of data asynchronously.
   // RocksDB apply it if reads are sequential and its internal automatic
   // prefetching.
+  //
+  // In binaries built with coroutine support (USE_COROUTINES), async_io also
+  // lets MultiGet look up all the SST files a batch overlaps within a level
+  // together, awaiting their reads as one round instead of visiting files
+  // one at a time. Without coroutine support MultiGet processes files
+  // serially regardless of this flag.
   bool async_io = false;
 
   // Experimental
@@ -2005,9 +2103,13 @@ struct ReadOptions {
   // CPU when the values associated with certain keys may not be used by the
   // application. See also IteratorBase::PrepareValue().
   //
-  // Note: this option currently only applies to 1) large values stored in blob
-  // files using BlobDB and 2) multi-column-family iterators (CoalescingIterator
-  // and AttributeGroupIterator). Otherwise, it has no effect.
+  // Note: this option currently applies to 1) large values stored in blob
+  // files using BlobDB, 2) multi-column-family iterators (CoalescingIterator
+  // and AttributeGroupIterator), and 3) plain values during forward iteration
+  // over block-based tables whose index includes the first key of each block
+  // (IndexType::kBinarySearchWithFirstKey), where the data block itself is not
+  // read until the value is prepared, enabling key-only scans to skip block
+  // loads entirely. Otherwise, it has no effect.
   //
   // Default: false
   bool allow_unprepared_value = false;
@@ -2479,6 +2581,14 @@ struct SizeApproximationOptions {
   // If the value is non-positive - a more precise yet more CPU intensive
   // estimation is performed.
   double files_size_error_margin = -1.0;
+  // If true, never read table files (index blocks) to refine the estimate
+  // for files that partially overlap the queried range. Instead, the
+  // overlap is interpolated from the file's smallest/largest keys already
+  // held in memory, assuming keys are roughly uniformly distributed by byte
+  // prefix. This makes GetApproximateSizes a pure in-memory operation with
+  // no read interference, at the cost of accuracy on the (at most two per
+  // level, plus L0) boundary files of each range.
+  bool files_size_metadata_only = false;
 };
 
 struct CompactionServiceOptionsOverride {
@@ -0,0 +1,76 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "rocksdb/rocksdb_namespace.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+// Read-path stages recorded by QueryTimeline. Kept small so an entry fits
+// in 16 bytes.
+enum class TimelineStage : uint8_t {
+  kQueryStart,
+  // Memtable and immutable memtable lookup finished.
+  kMemtableLookup,
+  // Block cache probe finished (hit or miss).
+  kBlockCacheProbe,
+  // Block read from storage finished.
+  kBlockRead,
+  // Block decompression finished.
+  kBlockDecompress,
+  // Full merge of operands finished.
+  kMergeOperands,
+  kQueryEnd,
+};
+
+// A flight-recorder style timeline for a single sampled query, similar in
+// spirit to PerfContext but recording ordered (stage, timestamp) events
+// rather than aggregated durations. A thread-local instance is activated
+// for operations issued with ReadOptions::trace_timeline set; internal
+// read-path stages append events as they complete. After the operation
+// returns, the caller can inspect the events on the same thread via
+// get_query_timeline(), e.g. to export slow-query traces.
+//
+// Recording is bounded: at most kMaxEntries events are kept and later
+// events are dropped, so a pathological query cannot grow the buffer.
+// When trace_timeline is not set, the only cost on the read path is a
+// thread-local load and a predictable branch per stage.
+struct QueryTimeline {
+  static constexpr size_t kMaxEntries = 64;
+
+  struct Entry {
+    TimelineStage stage;
+    // From SystemClock::NowNanos(); comparable within one timeline only.
+    uint64_t timestamp_ns;
+  };
+
+  // Clears previous events and enables recording, logging kQueryStart.
+  void Start();
+
+  // Logs kQueryEnd and disables recording.
+  void Stop();
+
+  // Appends an event if recording is enabled and capacity remains.
+  void Record(TimelineStage stage);
+
+  // Human-readable dump, one "<stage> +<ns since start>" pair per event.
+  std::string ToString() const;
+
+  bool enabled = false;
+  size_t num_entries = 0;
+  Entry entries[kMaxEntries];
+};
+
+// Get the thread-local QueryTimeline. Events are only recorded between
+// Start() and Stop(), which DB operations invoke for queries issued with
+// ReadOptions::trace_timeline.
+QueryTimeline* get_query_timeline();
+
+}  // namespace ROCKSDB_NAMESPACE
@@ -60,6 +60,18 @@ class SecondaryCacheResultHandle {
 // Cache interface for caching blocks on a secondary tier (which can include
 // non-volatile media, or alternate forms of caching such as compressed data)
 //
+// Because entries cross this interface as self-contained persistable data
+// (see the helper callbacks on Insert() and the create_cb on Lookup()) rather
+// than as in-process object pointers, a SecondaryCache implementation may be
+// backed by storage shared between processes, such as a shared memory segment
+// or a tmpfs file. Block cache keys are derived from the SST file's embedded
+// identifiers and are stable across processes (see cache/cache_key.h), so
+// several instances on one host — e.g. a leader and its secondary/follower
+// read replicas opened on the same set of SST files — can deduplicate blocks
+// of shared immutable files through such an implementation, with each process
+// keeping only its own primary cache of materialized objects. Any required
+// cross-process synchronization is the implementation's responsibility.
+//
 // Exceptions MUST NOT propagate out of overridden functions into RocksDB,
 // because RocksDB is not exception-safe. This could cause undefined behavior
 // including data loss, unreported corruption, deadlocks, and more.
@@ -115,6 +115,14 @@ class Status {
     kIOFenced = 14,
     kMergeOperatorFailed = 15,
     kMergeOperandThresholdExceeded = 16,
+    // Subcodes for common flow-control statuses. Using a subcode instead of a
+    // message keeps construction and copying of these statuses free of heap
+    // allocations, which matters on hot paths (e.g. kBlockCacheTier reads and
+    // no_slowdown writes produce them routinely).
+    kBlockingIoNotAllowed = 17,
+    kWriteStall = 18,
+    kKeySeqExists = 19,
+    kTooManyInternalKeysSkipped = 20,
     kMaxSubCode
   };
 
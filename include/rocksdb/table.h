@@ -231,6 +231,20 @@ struct BlockBasedTableOptions {
   // overflowing block cache.
   MetadataCacheOptions metadata_cache_options;
 
+  // EXPERIMENTAL
+  // If > 0, index and filter blocks that are read into memory owned by the
+  // table reader (rather than by the block cache, e.g. with
+  // cache_index_and_filter_blocks=false, or partition pinning without a
+  // cache entry) are allocated from a huge page TLB backed arena owned by
+  // that table reader, using the given huge page size. Large long-lived
+  // index/filter blocks on 4KB pages incur measurable TLB miss overhead on
+  // partitioned-index walks; backing them with huge pages avoids that. Huge
+  // pages must be reserved for this to take effect (e.g.
+  // `sysctl -w vm.nr_hugepages=20`); on allocation failure this silently
+  // falls back to regular pages. Blocks resident in the block cache are
+  // unaffected since their memory is owned by the cache.
+  size_t metadata_block_huge_page_tlb_size = 0;
+
   // The index type that will be used for this table.
   enum IndexType : char {
     // A space efficient index block that is optimized for
@@ -306,6 +320,12 @@ struct BlockBasedTableOptions {
   // block size specified here corresponds to uncompressed data.  The
   // actual size of the unit read from disk may be smaller if
   // compression is enabled.  This parameter can be changed dynamically.
+  //
+  // A block is also the unit of I/O for an uncached point read: the format
+  // does not support reading part of a block (the checksum covers the whole
+  // block and the restart offset array is at its tail), so on storage where
+  // reads are priced per byte, a smaller block_size trades index size for
+  // less data read per Get().
   uint64_t block_size = 4 * 1024;
 
   // This is used to close a block before it reaches the configured
@@ -444,6 +464,16 @@ struct BlockBasedTableOptions {
   // decouple_partitioned_filters = true is expected to become the new default.
   bool decouple_partitioned_filters = false;
 
+  // EXPERIMENTAL. When partitioned filters and a prefix extractor are in
+  // use, also build a small whole-file prefix bloom that is written as its
+  // own meta block and kept in reader-owned memory while the table is open.
+  // Prefix seeks consult it before locating a filter partition, so seeks for
+  // absent prefixes are resolved without a block cache lookup or partition
+  // read. Costs extra space proportional to the number of distinct prefixes
+  // in the file. Files written with this option remain readable by versions
+  // without it.
+  bool partition_filter_top_level_prefix_bloom = false;
+
   // Option to generate Bloom/Ribbon filters that minimize memory
   // internal fragmentation.
   //
@@ -54,6 +54,7 @@ struct TablePropertiesNames {
   static const std::string kNumFilterEntries;
   static const std::string kDeletedKeys;
   static const std::string kMergeOperands;
+  static const std::string kKeyOverwrites;
   static const std::string kNumRangeDeletions;
   static const std::string kFormatVersion;
   static const std::string kFixedKeyLen;
@@ -243,6 +244,12 @@ struct TableProperties {
   uint64_t num_deletions = 0;
   // the number of merge operands in the table
   uint64_t num_merge_operands = 0;
+  // the number of point entries that have the same user key as the entry
+  // added just before them, i.e. older versions of keys that were
+  // overwritten (or deleted) and are still kept in this table. Files dense
+  // in such entries are prioritized for compaction so that dead versions
+  // are reclaimed sooner (see CompactionPri::kMinOverlappingRatio).
+  uint64_t num_key_overwrites = 0;
   // the number of range deletions in this table
   uint64_t num_range_deletions = 0;
   // format version, reserved for backward compatibility
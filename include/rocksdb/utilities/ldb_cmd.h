@@ -74,6 +74,8 @@ class LDBCommand {
   static const std::string ARG_DUMP_UNCOMPRESSED_BLOBS;
   static const std::string ARG_READ_TIMESTAMP;
   static const std::string ARG_GET_WRITE_UNIX_TIME;
+  static const std::string ARG_ASYNC_IO;
+  static const std::string ARG_SCAN_READAHEAD_SIZE;
 
   struct ParsedParams {
     std::string cmd;
@@ -28,10 +28,22 @@ struct ReplayOptions {
   //   If > 1, speed up the replay by this amount.
   double fast_forward;
 
-  ReplayOptions() : num_threads(1), fast_forward(1.0) {}
+  // If true, a read operation (e.g. Get, MultiGet, iterator Seek) is not
+  // executed until all write operations with earlier trace timestamps have
+  // finished executing, so replayed reads never observe a state older than
+  // the one the traced reads saw. Only relevant for multi-threaded replay;
+  // single-threaded replay always executes the operations in trace order.
+  // Note that enabling this may reduce replay concurrency and thus slow down
+  // the replay when the trace is write-heavy.
+  bool preserve_write_read_order;
+
+  ReplayOptions()
+      : num_threads(1), fast_forward(1.0), preserve_write_read_order(false) {}
 
   ReplayOptions(uint32_t num_of_threads, double fast_forward_ratio)
-      : num_threads(num_of_threads), fast_forward(fast_forward_ratio) {}
+      : num_threads(num_of_threads),
+        fast_forward(fast_forward_ratio),
+        preserve_write_read_order(false) {}
 };
 
 // Replayer helps to replay the captured RocksDB query level operations.
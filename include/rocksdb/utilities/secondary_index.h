@@ -12,6 +12,7 @@
 #include <variant>
 
 #include "rocksdb/iterator.h"
+#include "rocksdb/options.h"
 #include "rocksdb/rocksdb_namespace.h"
 #include "rocksdb/slice.h"
 #include "rocksdb/status.h"
@@ -19,6 +20,7 @@
 namespace ROCKSDB_NAMESPACE {
 
 class ColumnFamilyHandle;
+class DB;
 
 // EXPERIMENTAL
 //
@@ -64,6 +66,20 @@ class SecondaryIndex {
   // specifying kDefaultWideColumnName.
   virtual Slice GetPrimaryColumnName() const = 0;
 
+  // Whether the index is maintained lazily. With the default (eager)
+  // maintenance, an insert, update, or delete of a primary key-value reads
+  // the existing primary entry and removes any secondary index entries that
+  // refer to it, so the index is always exact. With lazy maintenance, the
+  // write path only adds secondary entries for the new value and never
+  // performs that point lookup, which significantly reduces write latency;
+  // in exchange, updates and deletes leave stale secondary entries behind.
+  // Queries then have to treat index entries as hints and verify them
+  // against the primary key-values, e.g. by using the verifying flavor of
+  // SecondaryIndexIterator below, which also filters out the stale entries.
+  // Since entries are only ever added for values actually written, the index
+  // can return false positives but never misses a current key-value.
+  virtual bool IsLazilyMaintained() const { return false; }
+
   // Optionally update the primary column value during an insert or update of a
   // primary key-value. Called by the transaction layer before the primary
   // key-value write is added to the transaction. Returning a non-OK status
@@ -130,6 +146,21 @@ class SecondaryIndexIterator {
   SecondaryIndexIterator(const SecondaryIndex* index,
                          std::unique_ptr<Iterator>&& underlying_it);
 
+  // Constructs a verifying SecondaryIndexIterator, which additionally checks
+  // each index entry against the primary key-value it refers to and skips
+  // entries that are out of date. Intended for querying lazily maintained
+  // indices (see SecondaryIndex::IsLazilyMaintained), whose entries may have
+  // been superseded by later updates or deletes of the primary key-value.
+  // The given read options are used for the primary lookups.
+  // PRE: index is not nullptr
+  // PRE: underlying_it is not nullptr and points to an iterator over the
+  // index's secondary column family
+  // PRE: db is not nullptr and is the database holding the index's primary
+  // column family
+  SecondaryIndexIterator(const SecondaryIndex* index,
+                         std::unique_ptr<Iterator>&& underlying_it, DB* db,
+                         const ReadOptions& read_options);
+
   // Returns whether the iterator is valid, i.e. whether it is positioned on a
   // secondary index entry matching the search target.
   bool Valid() const;
@@ -181,8 +212,13 @@ class SecondaryIndexIterator {
   Status GetProperty(std::string prop_name, std::string* prop) const;
 
  private:
+  Status CheckEntryUpToDate(bool* up_to_date) const;
+  void SkipStaleEntries(bool forward);
+
   const SecondaryIndex* index_;
   std::unique_ptr<Iterator> underlying_it_;
+  DB* db_ = nullptr;
+  ReadOptions read_options_;
   Status status_;
   std::string prefix_;
 };
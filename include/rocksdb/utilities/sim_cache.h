@@ -9,6 +9,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "rocksdb/advanced_cache.h"
 #include "rocksdb/env.h"
@@ -41,6 +42,16 @@ std::shared_ptr<SimCache> NewSimCache(std::shared_ptr<Cache> sim_cache,
                                       std::shared_ptr<Cache> cache,
                                       int num_shard_bits);
 
+// Same as above, but simulates several capacities at once (e.g. 0.5x, 1x, 2x
+// and 4x the real capacity), essentially producing a miss-ratio curve for the
+// workload. The first element of sim_capacities determines the capacity
+// reported by GetSimCapacity() and the hit/miss counters; the hit rates of all
+// simulated capacities are included in ToString(). Returns nullptr if
+// sim_capacities is empty.
+std::shared_ptr<SimCache> NewSimCache(std::shared_ptr<Cache> cache,
+                                      const std::vector<size_t>& sim_capacities,
+                                      int num_shard_bits);
+
 // An abstract base class (public interface) to the SimCache implementation
 class SimCache : public CacheWrapper {
  public:
@@ -423,6 +423,10 @@ class StackableDB : public DB {
 
   Status SyncWAL() override { return db_->SyncWAL(); }
 
+  Status SyncWALAsync(std::function<void(Status)> callback) override {
+    return db_->SyncWALAsync(std::move(callback));
+  }
+
   Status FlushWAL(bool sync) override { return db_->FlushWAL(sync); }
 
   Status LockWAL() override { return db_->LockWAL(); }
@@ -133,6 +133,52 @@ class CompactForTieringCollectorFactory
 std::shared_ptr<CompactForTieringCollectorFactory>
 NewCompactForTieringCollectorFactory(double compaction_trigger_ratio);
 
+// A factory of a table property collector that marks a SST file as
+// need-compaction when it observes at least "L" consecutive merge operands
+// for a single user key. Point lookups on such keys have to read and fold the
+// whole chain, so proactively compacting files with long chains (which
+// applies the merge operator via partial merge or a base value) bounds the
+// read cost of merge-heavy keys without waiting for a compaction to touch the
+// chain by chance. The collector also records the longest chain observed in
+// the file in the "rocksdb.max.merge.chain.length" user property.
+//
+// Setting the trigger to 0 disables the collector.
+class CompactOnLongMergeChainCollectorFactory
+    : public TablePropertiesCollectorFactory {
+ public:
+  // @param merge_chain_length_trigger "L"
+  explicit CompactOnLongMergeChainCollectorFactory(
+      size_t merge_chain_length_trigger);
+
+  ~CompactOnLongMergeChainCollectorFactory() override {}
+
+  TablePropertiesCollector* CreateTablePropertiesCollector(
+      TablePropertiesCollectorFactory::Context context) override;
+
+  // Change the value of merge_chain_length_trigger "L"
+  // Setting it to 0 disables the merge chain triggered compaction
+  void SetMergeChainLengthTrigger(size_t merge_chain_length_trigger) {
+    merge_chain_length_trigger_.store(merge_chain_length_trigger);
+  }
+
+  size_t GetMergeChainLengthTrigger() const {
+    return merge_chain_length_trigger_.load();
+  }
+
+  static const char* kClassName() {
+    return "CompactOnLongMergeChainCollector";
+  }
+  const char* Name() const override { return kClassName(); }
+
+  std::string ToString() const override;
+
+ private:
+  std::atomic<size_t> merge_chain_length_trigger_;
+};
+
+std::shared_ptr<CompactOnLongMergeChainCollectorFactory>
+NewCompactOnLongMergeChainCollectorFactory(size_t merge_chain_length_trigger);
+
 // Information for the unix write time of a collection of data. Combined with
 // the current unix time, these stats give an overview of how long the data
 // have been written to the DB.
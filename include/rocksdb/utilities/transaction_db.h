@@ -369,6 +369,9 @@ struct TransactionOptions {
   // skip memtable write and ingest into the DB directly during Commit(). This
   // makes Commit() much faster for transactions with many operations.
   // Transactions with Merge() or PutEntity() is not supported yet.
+  // Both prepared (2PC) and non-prepared commits take this path; non-prepared
+  // commits fall back to regular memtable insertion when two_write_queues or
+  // user-defined timestamps are in use.
   //
   // Note that the transaction will be ingested as an immutable memtable for
   // CFs it updates, and the current memtable will be switched to a new one.
@@ -391,6 +391,14 @@ class WriteBatchWithIndex : public WriteBatchBase {
 
   WBWIIterator* NewIterator(uint32_t cf_id) const;
 
+  // Eagerly move a small batch's index entries from the sorted vector into
+  // the skip list. The migration otherwise happens lazily on the first
+  // NewIterator* call with no synchronization, which is not safe once this
+  // WBWI is shared read-only across threads, e.g. after it is ingested as an
+  // immutable memtable. Must be called while the WBWI is still owned by a
+  // single thread.
+  void MigrateIndexToSkipList();
+
   // Returns the number of sub-batches inside the write batch. A sub-batch
   // starts right before inserting a key that is a duplicate of a key in the
   // last sub-batch.
@@ -533,6 +533,11 @@ class WriteBatch : public WriteBatchBase {
   // Maximum size of rep_.
   size_t max_bytes_;
 
+  // Capacity requested at construction time. Clear() re-reserves this much
+  // so a batch that is repeatedly refilled (or drained with Release()) does
+  // not have to grow its buffer from scratch each time.
+  size_t default_reserved_bytes_ = 0;
+
   std::unique_ptr<ProtectionInfo> prot_info_;
 
   size_t default_cf_ts_sz_ = 0;
@@ -60,6 +60,42 @@ Arena::~Arena() {
   }
 }
 
+void Arena::Reset() {
+  assert(tracker_ == nullptr);
+  // Only retain a block when every entry in blocks_ is a regular block of
+  // kBlockSize bytes; irregular blocks are sized for a specific allocation
+  // and block sizes are not recorded per block.
+  std::unique_ptr<char[]> retained;
+  if (irregular_block_num == 0 && !blocks_.empty()) {
+    retained = std::move(blocks_.back());
+    blocks_.pop_back();
+  }
+  blocks_.clear();
+  huge_blocks_.clear();
+  irregular_block_num = 0;
+  blocks_memory_ = sizeof(inline_block_);
+  alloc_bytes_remaining_ = sizeof(inline_block_);
+  aligned_alloc_ptr_ = inline_block_;
+  unaligned_alloc_ptr_ = inline_block_ + alloc_bytes_remaining_;
+  if (retained != nullptr) {
+    char* block = retained.get();
+    blocks_.push_back(std::move(retained));
+    size_t allocated_size;
+#ifdef ROCKSDB_MALLOC_USABLE_SIZE
+    allocated_size = malloc_usable_size(block);
+#else
+    allocated_size = kBlockSize;
+#endif  // ROCKSDB_MALLOC_USABLE_SIZE
+    blocks_memory_ += allocated_size;
+    // Serve allocations from the retained block right away. The inline
+    // block's capacity is skipped, which only matters for arenas small
+    // enough to never have allocated a block in the first place.
+    alloc_bytes_remaining_ = kBlockSize;
+    aligned_alloc_ptr_ = block;
+    unaligned_alloc_ptr_ = block + kBlockSize;
+  }
+}
+
 char* Arena::AllocateFallback(size_t bytes, bool aligned) {
   if (bytes > kBlockSize / 4) {
     ++irregular_block_num;
@@ -60,6 +60,14 @@ class Arena : public Allocator {
   char* AllocateAligned(size_t bytes, size_t huge_page_size = 0,
                         Logger* logger = nullptr) override;
 
+  // Frees all allocations, returning the arena to its freshly-constructed
+  // state except that one regular block (if any was allocated) is retained
+  // and reused, so an arena that is repeatedly recycled does not pay a
+  // malloc/free cycle each time it grows past the inline block. Must not be
+  // used on arenas with an AllocTracker, which only supports freeing all
+  // tracked memory at destruction.
+  void Reset();
+
   // Returns an estimate of the total memory usage of data allocated
   // by the arena (exclude the space allocated but not yet used for future
   // allocations).
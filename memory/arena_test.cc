@@ -203,6 +203,36 @@ TEST_F(ArenaTest, Simple) {
   SimpleTest(kHugePageSize);
 }
 
+TEST_F(ArenaTest, Reset) {
+  Arena arena;
+  // Reset of an arena still in its inline block retains nothing.
+  arena.Allocate(128);
+  arena.Reset();
+  ASSERT_TRUE(arena.IsInInlineBlock());
+
+  // Grow past the inline block; the first regular block should be retained
+  // across Reset() and reused without growing memory.
+  for (int i = 0; i < 100; ++i) {
+    arena.Allocate(64);
+  }
+  ASSERT_FALSE(arena.IsInInlineBlock());
+  const size_t allocated = arena.MemoryAllocatedBytes();
+  arena.Reset();
+  ASSERT_FALSE(arena.IsInInlineBlock());
+  for (int i = 0; i < 100; ++i) {
+    char* p = arena.Allocate(64);
+    memset(p, 0xcd, 64);
+  }
+  ASSERT_EQ(allocated, arena.MemoryAllocatedBytes());
+
+  // Irregular blocks are not retained.
+  arena.Allocate(Arena::kMinBlockSize * 2);
+  ASSERT_EQ(arena.IrregularBlockNum(), 1u);
+  arena.Reset();
+  ASSERT_TRUE(arena.IsInInlineBlock());
+  ASSERT_EQ(arena.IrregularBlockNum(), 0u);
+}
+
 // Number of minor page faults since last call
 size_t PopMinorPageFaultCount() {
 #ifdef RUSAGE_SELF
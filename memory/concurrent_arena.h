@@ -68,8 +68,7 @@ class ConcurrentArena : public Allocator {
   }
 
   size_t ApproximateMemoryUsage() const {
-    std::unique_lock<SpinMutex> lock(arena_mutex_, std::defer_lock);
-    lock.lock();
+    std::lock_guard<SpinMutex> lock(arena_mutex_);
     return arena_.ApproximateMemoryUsage() - ShardAllocatedAndUnused();
   }
 
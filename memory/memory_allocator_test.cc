@@ -8,6 +8,7 @@
 
 #include "memory/jemalloc_nodump_allocator.h"
 #include "memory/memkind_kmem_allocator.h"
+#include "memory/pooled_memory_allocator.h"
 #include "rocksdb/cache.h"
 #include "rocksdb/convenience.h"
 #include "rocksdb/db.h"
@@ -209,9 +210,43 @@ TEST_F(CreateMemoryAllocatorTest, NewJemallocNodumpAllocator) {
   ASSERT_EQ(opts->limit_tcache_size, jopts.limit_tcache_size);
 }
 
+TEST_F(CreateMemoryAllocatorTest, NewPooledMemoryAllocator) {
+  PooledAllocatorOptions popts;
+  std::shared_ptr<MemoryAllocator> allocator;
+  ASSERT_NOK(NewPooledMemoryAllocator(popts, nullptr));
+  ASSERT_OK(NewPooledMemoryAllocator(popts, &allocator));
+  ASSERT_NE(allocator, nullptr);
+  auto opts = allocator->GetOptions<PooledAllocatorOptions>();
+  ASSERT_NE(opts, nullptr);
+  ASSERT_EQ(opts->max_recycled_bytes, popts.max_recycled_bytes);
+
+  // A freed buffer of a size class is handed back to the next allocation
+  // of the same class.
+  void* p = allocator->Allocate(4000);
+  ASSERT_NE(p, nullptr);
+  memset(p, 0xab, 4000);
+  allocator->Deallocate(p);
+  void* q = allocator->Allocate(4000);
+  ASSERT_EQ(p, q);
+  // A different size class gets a different buffer.
+  void* r = allocator->Allocate(64 * 1024);
+  ASSERT_NE(q, r);
+  allocator->Deallocate(q);
+  allocator->Deallocate(r);
+
+  // Allocations beyond the largest size class bypass the pool.
+  void* big = allocator->Allocate(4 << 20);
+  ASSERT_NE(big, nullptr);
+  allocator->Deallocate(big);
+}
+
 INSTANTIATE_TEST_CASE_P(DefaultMemoryAllocator, MemoryAllocatorTest,
                         ::testing::Values(std::make_tuple(
                             DefaultMemoryAllocator::kClassName(), true)));
+
+INSTANTIATE_TEST_CASE_P(PooledMemoryAllocator, MemoryAllocatorTest,
+                        ::testing::Values(std::make_tuple(
+                            PooledMemoryAllocator::kClassName(), true)));
 #ifdef MEMKIND
 INSTANTIATE_TEST_CASE_P(
     MemkindkMemAllocator, MemoryAllocatorTest,
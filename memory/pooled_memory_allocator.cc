@@ -0,0 +1,119 @@
+//  Copyright (c) 2011-present, Facebook, Inc.  All rights reserved.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "memory/pooled_memory_allocator.h"
+
+#include <cstring>
+
+#include "rocksdb/utilities/options_type.h"
+#include "util/mutexlock.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+static std::unordered_map<std::string, OptionTypeInfo> pooled_type_info = {
+    {"max_recycled_bytes",
+     {offsetof(struct PooledAllocatorOptions, max_recycled_bytes),
+      OptionType::kSizeT, OptionVerificationType::kNormal,
+      OptionTypeFlags::kNone}},
+};
+
+PooledMemoryAllocator::PooledMemoryAllocator(
+    const PooledAllocatorOptions& options,
+    const std::shared_ptr<MemoryAllocator>& t)
+    : MemoryAllocatorWrapper(t), options_(options) {
+  RegisterOptions(&options_, &pooled_type_info);
+}
+
+PooledMemoryAllocator::~PooledMemoryAllocator() {
+  for (auto& fl : free_lists_) {
+    for (char* buf : fl.bufs) {
+      MemoryAllocatorWrapper::Deallocate(buf);
+    }
+  }
+}
+
+int PooledMemoryAllocator::SizeClass(size_t total) {
+  for (size_t cls = 0; cls < kNumClasses; ++cls) {
+    if (total <= ClassSize(cls)) {
+      return static_cast<int>(cls);
+    }
+  }
+  return -1;
+}
+
+void* PooledMemoryAllocator::Allocate(size_t size) {
+  const size_t total = size + kHeaderSize;
+  const int cls = SizeClass(total);
+  char* raw = nullptr;
+  uint64_t tag = kUnpooled;
+  if (cls >= 0) {
+    FreeList& fl = free_lists_[cls];
+    {
+      MutexLock l(&fl.mu);
+      if (!fl.bufs.empty()) {
+        raw = fl.bufs.back();
+        fl.bufs.pop_back();
+      }
+    }
+    if (raw != nullptr) {
+      recycled_bytes_.fetch_sub(ClassSize(cls), std::memory_order_relaxed);
+    } else {
+      // Allocate the full class size so the buffer can serve any future
+      // allocation of this class.
+      raw =
+          static_cast<char*>(MemoryAllocatorWrapper::Allocate(ClassSize(cls)));
+    }
+    tag = static_cast<uint64_t>(cls);
+  } else {
+    raw = static_cast<char*>(MemoryAllocatorWrapper::Allocate(total));
+  }
+  if (raw == nullptr) {
+    return nullptr;
+  }
+  std::memcpy(raw, &tag, sizeof(tag));
+  return raw + kHeaderSize;
+}
+
+void PooledMemoryAllocator::Deallocate(void* p) {
+  char* raw = static_cast<char*>(p) - kHeaderSize;
+  uint64_t tag;
+  std::memcpy(&tag, raw, sizeof(tag));
+  if (tag != kUnpooled) {
+    assert(tag < kNumClasses);
+    const size_t class_size = ClassSize(static_cast<size_t>(tag));
+    // Not an exact bound under concurrency, but keeps the pool within the
+    // configured order of magnitude, which is all that is needed here.
+    if (recycled_bytes_.load(std::memory_order_relaxed) + class_size <=
+        options_.max_recycled_bytes) {
+      recycled_bytes_.fetch_add(class_size, std::memory_order_relaxed);
+      FreeList& fl = free_lists_[static_cast<size_t>(tag)];
+      MutexLock l(&fl.mu);
+      fl.bufs.push_back(raw);
+      return;
+    }
+  }
+  MemoryAllocatorWrapper::Deallocate(raw);
+}
+
+size_t PooledMemoryAllocator::UsableSize(void* /*p*/,
+                                         size_t allocation_size) const {
+  // The header and any class-rounding slack are not usable by the caller,
+  // so report just the requested size rather than forwarding to the target
+  // (which would see the offset pointer).
+  return allocation_size;
+}
+
+Status NewPooledMemoryAllocator(
+    const PooledAllocatorOptions& options,
+    std::shared_ptr<MemoryAllocator>* memory_allocator) {
+  if (memory_allocator == nullptr) {
+    return Status::InvalidArgument("memory_allocator must be non-null.");
+  }
+  memory_allocator->reset(new PooledMemoryAllocator(
+      options, std::make_shared<DefaultMemoryAllocator>()));
+  return Status::OK();
+}
+
+}  // namespace ROCKSDB_NAMESPACE
@@ -0,0 +1,76 @@
+//  Copyright (c) 2011-present, Facebook, Inc.  All rights reserved.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "port/port.h"
+#include "rocksdb/memory_allocator.h"
+#include "utilities/memory_allocators.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+// A size-classed recycling layer on top of another MemoryAllocator. Freed
+// buffers are kept in per-class free lists and handed back to subsequent
+// allocations of the same class instead of going through the underlying
+// allocator. When used as the block cache allocator, this gives an
+// eviction-to-fetch fast path: the buffer released when a block is evicted
+// is reused for the next block read from file (BlockFetcher allocates
+// through the cache's allocator), so steady-state block turnover does not
+// touch the underlying heap.
+//
+// Each buffer is allocated with a small header recording its size class, so
+// Deallocate() can route it to the right free list. Allocations larger than
+// the largest size class bypass the pool. Total pooled memory is bounded by
+// PooledAllocatorOptions::max_recycled_bytes; beyond that, freed buffers go
+// back to the underlying allocator.
+class PooledMemoryAllocator : public MemoryAllocatorWrapper {
+ public:
+  explicit PooledMemoryAllocator(const PooledAllocatorOptions& options,
+                                 const std::shared_ptr<MemoryAllocator>& t);
+  ~PooledMemoryAllocator() override;
+
+  static const char* kClassName() { return "PooledMemoryAllocator"; }
+  const char* Name() const override { return kClassName(); }
+
+  void* Allocate(size_t size) override;
+  void Deallocate(void* p) override;
+  size_t UsableSize(void* p, size_t allocation_size) const override;
+
+ private:
+  // Size classes are powers of two in [1 << kMinClassShift,
+  // 1 << kMaxClassShift], covering data block sizes from compressed blocks
+  // up to large uncompressed blocks.
+  static constexpr size_t kMinClassShift = 10;  // 1KB
+  static constexpr size_t kMaxClassShift = 20;  // 1MB
+  static constexpr size_t kNumClasses = kMaxClassShift - kMinClassShift + 1;
+  // Room for the size class tag without disturbing the alignment the
+  // underlying allocator provides.
+  static constexpr size_t kHeaderSize = alignof(std::max_align_t);
+  // Tag for allocations that bypass the pool.
+  static constexpr uint64_t kUnpooled = ~uint64_t{0};
+
+  static size_t ClassSize(size_t cls) {
+    return size_t{1} << (cls + kMinClassShift);
+  }
+  // Returns the smallest class whose size is >= total, or -1 if total is
+  // larger than the largest class.
+  static int SizeClass(size_t total);
+
+  struct FreeList {
+    port::Mutex mu;
+    std::vector<char*> bufs;
+  };
+
+  PooledAllocatorOptions options_;
+  FreeList free_lists_[kNumClasses];
+  // Bytes currently sitting in free_lists_, compared against
+  // options_.max_recycled_bytes to bound pool growth.
+  std::atomic<size_t> recycled_bytes_{0};
+};
+
+}  // namespace ROCKSDB_NAMESPACE
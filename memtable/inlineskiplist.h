@@ -626,6 +626,7 @@ InlineSkipList<Comparator>::FindLast() const {
         level--;
       }
     } else {
+      PREFETCH(next->Next(level), 0, 1);
       x = next;
     }
   }
@@ -634,7 +635,6 @@ InlineSkipList<Comparator>::FindLast() const {
 template <class Comparator>
 typename InlineSkipList<Comparator>::Node*
 InlineSkipList<Comparator>::FindRandomEntry() const {
-  // TODO(bjlemaire): consider adding PREFETCH calls.
   Node *x = head_, *scan_node = nullptr, *limit_node = nullptr;
 
   // We start at the max level.
@@ -659,7 +659,11 @@ InlineSkipList<Comparator>::FindRandomEntry() const {
     scan_node = x;
     while (scan_node != limit_node) {
       lvl_nodes.push_back(scan_node);
-      scan_node = scan_node->Next(level);
+      Node* next = scan_node->Next(level);
+      if (next != nullptr) {
+        PREFETCH(next->Next(level), 0, 1);
+      }
+      scan_node = next;
     }
     uint32_t rnd_idx = rnd->Next() % lvl_nodes.size();
     x = lvl_nodes[rnd_idx];
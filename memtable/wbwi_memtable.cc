@@ -6,6 +6,7 @@
 #include "memtable/wbwi_memtable.h"
 
 #include "db/memtable.h"
+#include "utilities/write_batch_with_index/write_batch_with_index_internal.h"
 
 namespace ROCKSDB_NAMESPACE {
 
@@ -42,6 +43,28 @@ inline InternalIterator* WBWIMemTable::NewIterator() const {
       assigned_seqno_, comparator_, /*for_flush=*/false);
 }
 
+size_t WBWIMemTable::SharedMemoryUsageShare() const {
+  // The write batch data and the index are shared by all the WBWIMemTables
+  // ingested from this WBWI, so attribute a share proportional to this CF's
+  // entry count. The per-entry term covers the arena-allocated index
+  // entries; skip list tower overhead is not counted.
+  const auto& cf_stats = wbwi_->GetCFStats();
+  uint64_t total_entries = 0;
+  uint64_t cf_entries = 0;
+  for (const auto& cf_stat : cf_stats) {
+    total_entries += cf_stat.second.entry_count;
+    if (cf_stat.first == cf_id_) {
+      cf_entries = cf_stat.second.entry_count;
+    }
+  }
+  if (total_entries == 0) {
+    return 0;
+  }
+  uint64_t total_usage = wbwi_->GetWriteBatch()->GetDataSize() +
+                         total_entries * sizeof(WriteBatchIndexEntry);
+  return static_cast<size_t>(total_usage * cf_entries / total_entries);
+}
+
 bool WBWIMemTable::Get(const LookupKey& key, std::string* value,
                        PinnableWideColumns* columns, std::string* timestamp,
                        Status* s, MergeContext* merge_context,
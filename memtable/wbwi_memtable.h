@@ -62,6 +62,11 @@ class WBWIMemTable final : public ReadOnlyMemTable {
         num_entries_(stat.entry_count + stat.overwritten_sd_count),
         cf_id_(cf_id) {
     assert(wbwi->GetOverwriteKey());
+    // This memtable is shared read-only across threads, and Get() and
+    // NewIterator() create WBWI iterators concurrently. Force the index out
+    // of its single-threaded vector mode here, while the WBWI is still owned
+    // by a single thread (ingestion runs under the DB mutex).
+    wbwi->MigrateIndexToSkipList();
   }
 
   // No copying allowed
@@ -72,17 +77,15 @@ class WBWIMemTable final : public ReadOnlyMemTable {
 
   const char* Name() const override { return "WBWIMemTable"; }
 
-  size_t ApproximateMemoryUsage() override {
-    // FIXME: we can calculate for each CF or just divide evenly among CFs
-    // Used in ReportFlushInputSize(), MemPurgeDecider, flush job event logging,
-    // and InternalStats::HandleCurSizeAllMemTables
-    return 0;
-  }
+  // This CF's share of the memory used by the underlying WBWI, which is
+  // shared by the WBWIMemTables ingested from it (one per CF with updates).
+  // Used in ReportFlushInputSize(), MemPurgeDecider, flush job event logging,
+  // and InternalStats::HandleCurSizeAllMemTables.
+  size_t ApproximateMemoryUsage() override { return SharedMemoryUsageShare(); }
 
+  // Used in MemTableList to trim memtable history.
   size_t MemoryAllocatedBytes() const override {
-    // FIXME: similar to ApproximateMemoryUsage().
-    //   Used in MemTableList to trim memtable history.
-    return 0;
+    return SharedMemoryUsageShare();
   }
 
   void UniqueRandomSample(
@@ -224,6 +227,9 @@ class WBWIMemTable final : public ReadOnlyMemTable {
  private:
   inline InternalIterator* NewIterator() const;
 
+  // See ApproximateMemoryUsage().
+  size_t SharedMemoryUsageShare() const;
+
   Slice newest_udt_;
   std::shared_ptr<WriteBatchWithIndex> wbwi_;
   const Comparator* comparator_;
@@ -9,6 +9,7 @@
 
 #include "benchmark/benchmark.h"
 #include "db/db_impl/db_impl.h"
+#include "file/file_prefetch_buffer.h"
 #include "rocksdb/db.h"
 #include "rocksdb/filter_policy.h"
 #include "rocksdb/options.h"
@@ -342,6 +343,99 @@ static const uint64_t DBPutNum = 409600l;
 BENCHMARK(DBPut)->Threads(1)->Iterations(DBPutNum)->Apply(DBPutArguments);
 BENCHMARK(DBPut)->Threads(8)->Iterations(DBPutNum / 8)->Apply(DBPutArguments);
 
+// Measures WriteBatch writes, with the multi-threaded variants exercising
+// write group formation in WriteImpl: concurrent writers with WAL enabled
+// get batched into groups behind a single leader.
+static void DBBatchedWrite(benchmark::State& state) {
+  uint64_t batch_size = state.range(0);
+  uint64_t per_key_size = state.range(1);
+  bool enable_statistics = state.range(2);
+  bool enable_wal = state.range(3);
+  uint64_t key_num = (100l << 30) / per_key_size;
+
+  // setup DB
+  static std::unique_ptr<DB> db = nullptr;
+  Options options;
+  if (enable_statistics) {
+    options.statistics = CreateDBStatistics();
+  }
+
+  auto rnd = Random(301 + state.thread_index());
+  KeyGenerator kg(&rnd, key_num);
+
+  if (state.thread_index() == 0) {
+    SetupDB(state, options, &db, "DBBatchedWrite");
+  }
+
+  auto wo = WriteOptions();
+  wo.disableWAL = !enable_wal;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    WriteBatch batch;
+    char buff[256];
+    std::string val = rnd.RandomString(static_cast<int>(per_key_size));
+    for (uint64_t i = 0; i < batch_size; i++) {
+      Status s = batch.Put(kg.Next(buff), val);
+      if (!s.ok()) {
+        state.SkipWithError(s.ToString().c_str());
+      }
+    }
+    state.ResumeTiming();
+    Status s = db->Write(wo, &batch);
+    if (!s.ok()) {
+      state.SkipWithError(s.ToString().c_str());
+    }
+  }
+
+  if (state.thread_index() == 0) {
+    auto db_full = static_cast_with_check<DBImpl>(db.get());
+    Status s = db_full->WaitForCompact(WaitForCompactOptions());
+    if (!s.ok()) {
+      state.SkipWithError(s.ToString().c_str());
+      return;
+    }
+    if (enable_statistics) {
+      HistogramData histogram_data;
+      options.statistics->histogramData(DB_WRITE, &histogram_data);
+      state.counters["write_mean"] = histogram_data.average * std::milli::den;
+      state.counters["write_p95"] =
+          histogram_data.percentile95 * std::milli::den;
+      state.counters["write_p99"] =
+          histogram_data.percentile99 * std::milli::den;
+    }
+
+    TeardownDB(state, db, options, kg);
+  }
+}
+
+static void DBBatchedWriteArguments(benchmark::internal::Benchmark* b) {
+  for (int64_t batch_size : {1, 16, 128}) {
+    for (int64_t per_key_size : {256, 1024}) {
+      for (bool enable_statistics : {false, true}) {
+        for (bool wal : {false, true}) {
+          b->Args({batch_size, per_key_size, enable_statistics, wal});
+        }
+      }
+    }
+  }
+  b->ArgNames({"batch_size", "per_key_size", "enable_statistics", "wal"});
+}
+
+static const uint64_t DBBatchedWriteNum = 16384l;
+BENCHMARK(DBBatchedWrite)
+    ->Threads(1)
+    ->Iterations(DBBatchedWriteNum)
+    ->Apply(DBBatchedWriteArguments);
+BENCHMARK(DBBatchedWrite)
+    ->Threads(4)
+    ->Iterations(DBBatchedWriteNum / 4)
+    ->Apply(DBBatchedWriteArguments);
+BENCHMARK(DBBatchedWrite)
+    ->Threads(16)
+    ->Iterations(DBBatchedWriteNum / 16)
+    ->Apply(DBBatchedWriteArguments);
+
 static void ManualCompaction(benchmark::State& state) {
   auto compaction_style = static_cast<CompactionStyle>(state.range(0));
   uint64_t max_data = state.range(1);
@@ -704,6 +798,106 @@ static const uint64_t DBGetNum = 10000l;
 BENCHMARK(DBGet)->Threads(1)->Iterations(DBGetNum)->Apply(DBGetArguments);
 BENCHMARK(DBGet)->Threads(8)->Iterations(DBGetNum / 8)->Apply(DBGetArguments);
 
+// Measures MultiGet batch-size scaling. The block cache size argument
+// controls the cache hit ratio: a cache much smaller than the data set
+// exercises the miss/IO path, a cache larger than the data set converges to
+// all hits after warm-up.
+static void DBMultiGet(benchmark::State& state) {
+  uint64_t max_data = state.range(0);
+  uint64_t per_key_size = state.range(1);
+  int64_t batch_size = state.range(2);
+  uint64_t cache_mb = state.range(3);
+  uint64_t key_num = max_data / per_key_size;
+
+  // setup DB
+  static std::unique_ptr<DB> db;
+  Options options;
+  options.compression = kNoCompression;
+
+  BlockBasedTableOptions table_options;
+  table_options.block_cache = NewLRUCache(cache_mb << 20);
+  options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+
+  auto rnd = Random(301 + state.thread_index());
+
+  if (state.thread_index() == 0) {
+    KeyGenerator kg_seq(key_num /* max_key */);
+    SetupDB(state, options, &db, "DBMultiGet");
+
+    // Load all valid keys into DB, so every key in a batch is found.
+    auto wo = WriteOptions();
+    wo.disableWAL = true;
+    std::string val;
+    for (uint64_t i = 0; i < key_num; i++) {
+      CompressibleString(&rnd, 0.5, static_cast<int>(per_key_size), &val);
+      Status s = db->Put(wo, kg_seq.Next(), val);
+      if (!s.ok()) {
+        state.SkipWithError(s.ToString().c_str());
+      }
+    }
+
+    // Compact whole DB into one level, so each iteration will consider the
+    // same number of files (one).
+    Status s = db->CompactRange(CompactRangeOptions(), nullptr /* begin */,
+                                nullptr /* end */);
+    if (!s.ok()) {
+      state.SkipWithError(s.ToString().c_str());
+    }
+  }
+
+  KeyGenerator kg_rnd(&rnd, key_num /* max_key */);
+  auto ro = ReadOptions();
+  std::unique_ptr<char[]> key_buffs(new char[batch_size * 256]);
+  std::vector<Slice> keys(batch_size);
+  std::vector<PinnableSlice> values(batch_size);
+  std::vector<Status> statuses(batch_size);
+  size_t not_found = 0;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < batch_size; i++) {
+      keys[i] = kg_rnd.Next(key_buffs.get() + i * 256);
+    }
+    db->MultiGet(ro, db->DefaultColumnFamily(), batch_size, keys.data(),
+                 values.data(), statuses.data());
+    for (int64_t i = 0; i < batch_size; i++) {
+      if (statuses[i].IsNotFound()) {
+        not_found++;
+      }
+      values[i].Reset();
+      statuses[i] = Status::OK();
+    }
+  }
+
+  state.counters["neg_qu_pct"] = benchmark::Counter(
+      static_cast<double>(not_found * 100), benchmark::Counter::kAvgIterations);
+
+  if (state.thread_index() == 0) {
+    TeardownDB(state, db, options, kg_rnd);
+  }
+}
+
+static void DBMultiGetArguments(benchmark::internal::Benchmark* b) {
+  for (int64_t max_data : {512l << 20}) {
+    for (int64_t per_key_size : {256, 1024}) {
+      for (int64_t batch_size : {4, 16, 64}) {
+        for (int64_t cache_mb : {8, 1024}) {
+          b->Args({max_data, per_key_size, batch_size, cache_mb});
+        }
+      }
+    }
+  }
+  b->ArgNames({"max_data", "per_key_size", "batch_size", "cache_mb"});
+}
+
+static const uint64_t DBMultiGetNum = 10000l;
+BENCHMARK(DBMultiGet)
+    ->Threads(1)
+    ->Iterations(DBMultiGetNum)
+    ->Apply(DBMultiGetArguments);
+BENCHMARK(DBMultiGet)
+    ->Threads(8)
+    ->Iterations(DBMultiGetNum / 8)
+    ->Apply(DBMultiGetArguments);
+
 static void SimpleGetWithPerfContext(benchmark::State& state) {
   // setup DB
   static std::unique_ptr<DB> db;
@@ -1615,6 +1809,95 @@ BENCHMARK(RandomAccessFileReaderRead)
     ->Arg(1)
     ->ArgName("enable_statistics");
 
+// Measures `FilePrefetchBuffer` reads, another internal API. Sequential reads
+// are served from the prefetch buffer after the first miss; random reads
+// mostly miss the buffer and fall back to the file reader, like a
+// non-readahead-friendly access pattern would.
+static void FilePrefetchBufferRead(benchmark::State& state) {
+  size_t readahead_kb = state.range(0);
+  bool sequential = state.range(1);
+  constexpr size_t kFileSize = 32l << 20;
+  constexpr size_t kReadSize = 4l << 10;
+  auto env = Env::Default();
+  auto fs = env->GetFileSystem();
+  std::string db_path;
+  Status s = env->GetTestDirectory(&db_path);
+  if (!s.ok()) {
+    state.SkipWithError(s.ToString().c_str());
+    return;
+  }
+
+  Random rand(301);
+  std::string fname =
+      db_path + kFilePathSeparator + "file-prefetch-buffer-read";
+  {
+    std::unique_ptr<WritableFile> tgt_file;
+    env->NewWritableFile(fname, &tgt_file, EnvOptions());
+    for (size_t written = 0; written < kFileSize; written += 1l << 20) {
+      tgt_file->Append(rand.RandomString(1l << 20));
+    }
+    tgt_file->Close();
+  }
+
+  std::unique_ptr<FSRandomAccessFile> f;
+  fs->NewRandomAccessFile(fname, FileOptions(), &f, nullptr);
+  std::unique_ptr<RandomAccessFileReader> reader(new RandomAccessFileReader(
+      std::move(f), fname, env->GetSystemClock().get()));
+
+  ReadaheadParams readahead_params;
+  readahead_params.initial_readahead_size = readahead_kb << 10;
+  readahead_params.max_readahead_size = readahead_kb << 10;
+  FilePrefetchBuffer fpb(readahead_params, true /* enable */,
+                         false /* track_min_offset */, fs.get(),
+                         env->GetSystemClock().get());
+
+  IOOptions io_options;
+  std::unique_ptr<char[]> scratch(new char[kReadSize]);
+  Slice result;
+  uint64_t offset = 0;
+  uint64_t buffer_hit = 0;
+  for (auto _ : state) {
+    Status read_s;
+    if (fpb.TryReadFromCache(io_options, reader.get(), offset, kReadSize,
+                             &result, &read_s)) {
+      buffer_hit++;
+    } else if (read_s.ok()) {
+      // Buffer miss, read directly like the block fetchers do
+      read_s = reader->Read(io_options, offset, kReadSize, &result,
+                            scratch.get(), nullptr);
+    }
+    if (!read_s.ok()) {
+      state.SkipWithError(read_s.ToString().c_str());
+    }
+    if (sequential) {
+      offset += kReadSize;
+      if (offset + kReadSize > kFileSize) {
+        offset = 0;
+      }
+    } else {
+      offset = rand.Next() % (kFileSize - kReadSize);
+    }
+  }
+  state.counters["buffer_hit_pct"] = benchmark::Counter(
+      static_cast<double>(buffer_hit * 100), benchmark::Counter::kAvgIterations);
+  state.SetBytesProcessed(state.iterations() * kReadSize);
+
+  env->DeleteFile(fname);  // ignore return, okay to fail cleanup
+}
+
+static void FilePrefetchBufferReadArguments(benchmark::internal::Benchmark* b) {
+  for (int64_t readahead_kb : {16, 64, 512}) {
+    for (bool sequential : {false, true}) {
+      b->Args({readahead_kb, sequential});
+    }
+  }
+  b->ArgNames({"readahead_kb", "sequential"});
+}
+
+BENCHMARK(FilePrefetchBufferRead)
+    ->Iterations(100000)
+    ->Apply(FilePrefetchBufferReadArguments);
+
 }  // namespace ROCKSDB_NAMESPACE
 
 BENCHMARK_MAIN();
@@ -17,6 +17,7 @@
 
 #include "port/port.h"
 #include "util/cast_util.h"
+#include "util/math.h"
 
 namespace ROCKSDB_NAMESPACE {
 
@@ -39,16 +40,31 @@ HistogramBucketMapper::HistogramBucketMapper() {
   }
   maxBucketValue_ = bucketValues_.back();
   minBucketValue_ = bucketValues_.front();
+
+  for (int bits = 0; bits < 64; ++bits) {
+    const uint64_t smallest_for_bits = uint64_t{1} << bits;
+    firstIndexByBits_[bits] =
+        std::lower_bound(bucketValues_.begin(), bucketValues_.end(),
+                         smallest_for_bits) -
+        bucketValues_.begin();
+  }
 }
 
 size_t HistogramBucketMapper::IndexForValue(const uint64_t value) const {
-  auto beg = bucketValues_.begin();
-  auto end = bucketValues_.end();
   if (value >= maxBucketValue_) {
-    return end - beg - 1;  // bucketValues_.size() - 1
-  } else {
-    return std::lower_bound(beg, end, value) - beg;
+    return bucketValues_.size() - 1;
+  }
+  if (value == 0) {
+    return 0;
+  }
+  // All buckets before this index have limits smaller than any value of this
+  // bit width, and at most a couple of buckets share a bit width, so the scan
+  // below is a few steps at most.
+  size_t index = firstIndexByBits_[FloorLog2(value)];
+  while (bucketValues_[index] < value) {
+    ++index;
   }
+  return index;
 }
 
 namespace {
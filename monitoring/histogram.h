@@ -8,6 +8,7 @@
 // found in the LICENSE file. See the AUTHORS file for names of contributors.
 
 #pragma once
+#include <array>
 #include <cassert>
 #include <map>
 #include <mutex>
@@ -39,6 +40,12 @@ class HistogramBucketMapper {
 
  private:
   std::vector<uint64_t> bucketValues_;
+  // For each bit width of a value, the index of the first bucket whose limit
+  // is at least as large as the smallest value with that width. Lets
+  // IndexForValue() skip the binary search over all buckets: since
+  // consecutive bucket limits grow by ~1.5x, at most a couple of buckets
+  // share a bit width, so a short forward scan from here finds the index.
+  std::array<size_t, 64> firstIndexByBits_;
   uint64_t maxBucketValue_;
   uint64_t minBucketValue_;
 };
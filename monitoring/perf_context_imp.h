@@ -84,18 +84,13 @@ extern thread_local PerfContext perf_context;
   static_assert(true, "semicolon required")
 
 // Increase metric value
+// operator[] default-constructs the per-level context on first use, so a
+// single lookup covers both the existing-level and new-level cases
 #define PERF_COUNTER_BY_LEVEL_ADD(metric, value, level)               \
   if (perf_level >= PerfLevel::kEnableCount &&                        \
       perf_context.per_level_perf_context_enabled &&                  \
       perf_context.level_to_perf_context) {                           \
-    if ((*(perf_context.level_to_perf_context)).find(level) !=        \
-        (*(perf_context.level_to_perf_context)).end()) {              \
-      (*(perf_context.level_to_perf_context))[level].metric += value; \
-    } else {                                                          \
-      PerfContextByLevel empty_context;                               \
-      (*(perf_context.level_to_perf_context))[level] = empty_context; \
-      (*(perf_context.level_to_perf_context))[level].metric += value; \
-    }                                                                 \
+    (*(perf_context.level_to_perf_context))[level].metric += value;   \
   }
 
 #endif
@@ -0,0 +1,75 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "rocksdb/query_timeline.h"
+
+#include "rocksdb/system_clock.h"
+#include "util/string_util.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+thread_local QueryTimeline query_timeline;
+
+QueryTimeline* get_query_timeline() { return &query_timeline; }
+
+namespace {
+
+const char* StageName(TimelineStage stage) {
+  switch (stage) {
+    case TimelineStage::kQueryStart:
+      return "query_start";
+    case TimelineStage::kMemtableLookup:
+      return "memtable_lookup";
+    case TimelineStage::kBlockCacheProbe:
+      return "block_cache_probe";
+    case TimelineStage::kBlockRead:
+      return "block_read";
+    case TimelineStage::kBlockDecompress:
+      return "block_decompress";
+    case TimelineStage::kMergeOperands:
+      return "merge_operands";
+    case TimelineStage::kQueryEnd:
+      return "query_end";
+  }
+  return "unknown";
+}
+
+}  // namespace
+
+void QueryTimeline::Start() {
+  num_entries = 0;
+  enabled = true;
+  Record(TimelineStage::kQueryStart);
+}
+
+void QueryTimeline::Stop() {
+  Record(TimelineStage::kQueryEnd);
+  enabled = false;
+}
+
+void QueryTimeline::Record(TimelineStage stage) {
+  if (!enabled || num_entries >= kMaxEntries) {
+    return;
+  }
+  entries[num_entries].stage = stage;
+  entries[num_entries].timestamp_ns = SystemClock::Default()->NowNanos();
+  ++num_entries;
+}
+
+std::string QueryTimeline::ToString() const {
+  std::string result;
+  const uint64_t base = num_entries > 0 ? entries[0].timestamp_ns : 0;
+  for (size_t i = 0; i < num_entries; ++i) {
+    if (i > 0) {
+      result.append(", ");
+    }
+    result.append(StageName(entries[i].stage));
+    result.append(" +");
+    result.append(std::to_string(entries[i].timestamp_ns - base));
+  }
+  return result;
+}
+
+}  // namespace ROCKSDB_NAMESPACE
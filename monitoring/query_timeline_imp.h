@@ -0,0 +1,45 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#pragma once
+
+#include "port/likely.h"
+#include "rocksdb/query_timeline.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+extern thread_local QueryTimeline query_timeline;
+
+// Appends a stage-completion event to the thread-local timeline of the
+// current sampled query. A thread-local load plus a predicted-untaken
+// branch when no timeline is active.
+#define QUERY_TIMELINE_MARK(stage)                 \
+  do {                                             \
+    if (UNLIKELY(query_timeline.enabled)) {        \
+      query_timeline.Record(TimelineStage::stage); \
+    }                                              \
+  } while (0)
+
+// Scoped activation of the thread-local timeline for one sampled
+// operation; a no-op when `enable` is false. Stops on all exit paths.
+class QueryTimelineGuard {
+ public:
+  explicit QueryTimelineGuard(bool enable) : started_(enable) {
+    if (UNLIKELY(started_)) {
+      query_timeline.Start();
+    }
+  }
+
+  ~QueryTimelineGuard() {
+    if (UNLIKELY(started_)) {
+      query_timeline.Stop();
+    }
+  }
+
+ private:
+  bool started_;
+};
+
+}  // namespace ROCKSDB_NAMESPACE
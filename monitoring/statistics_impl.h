@@ -140,4 +140,59 @@ inline void SetTickerCount(Statistics* statistics, uint32_t ticker_type,
   }
 }
 
+// Accumulates ticker increments into plain local counters and flushes them
+// to the Statistics object in one batch, so hot loops pay the virtual
+// recordTick() call (and its core-local lookup) once per flush instead of
+// once per event. This is a generic counterpart to the hand-rolled batching
+// in GetContext::ReportCounters() and DBIter::LocalStatistics, for call
+// sites that touch a small, varying set of tickers. Flushed on destruction,
+// or explicitly at a coarser boundary such as end of block or file.
+// Not thread-safe: each thread or iterator uses its own recorder.
+class ScopedTickerRecorder {
+ public:
+  explicit ScopedTickerRecorder(Statistics* statistics)
+      : statistics_(statistics) {}
+  ~ScopedTickerRecorder() { Flush(); }
+  // No copying allowed
+  ScopedTickerRecorder(const ScopedTickerRecorder&) = delete;
+  void operator=(const ScopedTickerRecorder&) = delete;
+
+  void Record(uint32_t ticker_type, uint64_t count = 1) {
+    if (statistics_ == nullptr) {
+      return;
+    }
+    for (size_t i = 0; i < num_used_; ++i) {
+      if (types_[i] == ticker_type) {
+        counts_[i] += count;
+        return;
+      }
+    }
+    if (num_used_ < kMaxDistinctTickers) {
+      types_[num_used_] = ticker_type;
+      counts_[num_used_] = count;
+      ++num_used_;
+    } else {
+      // More distinct tickers than slots; record this one directly rather
+      // than grow. Callers are expected to size their ticker set to fit.
+      statistics_->recordTick(ticker_type, count);
+    }
+  }
+
+  void Flush() {
+    for (size_t i = 0; i < num_used_; ++i) {
+      statistics_->recordTick(types_[i], counts_[i]);
+    }
+    num_used_ = 0;
+  }
+
+ private:
+  // Enough for the distinct tickers a single hot loop touches.
+  static constexpr size_t kMaxDistinctTickers = 8;
+
+  Statistics* statistics_;
+  size_t num_used_ = 0;
+  uint32_t types_[kMaxDistinctTickers];
+  uint64_t counts_[kMaxDistinctTickers];
+};
+
 }  // namespace ROCKSDB_NAMESPACE
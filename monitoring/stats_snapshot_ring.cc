@@ -0,0 +1,118 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "monitoring/stats_snapshot_ring.h"
+
+#include <cstring>
+
+#include "rocksdb/system_clock.h"
+
+#ifdef ROCKSDB_PLATFORM_POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif  // ROCKSDB_PLATFORM_POSIX
+
+namespace ROCKSDB_NAMESPACE {
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "seqlock requires lock-free 64-bit atomics");
+
+StatsSnapshotRing::StatsSnapshotRing(void* base, size_t mapped_len)
+    : base_(base), mapped_len_(mapped_len) {}
+
+Status StatsSnapshotRing::Open(const std::string& file_path,
+                               uint32_t num_slots,
+                               std::shared_ptr<StatsSnapshotRing>* ring) {
+  if (ring == nullptr) {
+    return Status::InvalidArgument("ring must be non-null");
+  }
+  if (num_slots == 0) {
+    return Status::InvalidArgument("num_slots must be positive");
+  }
+#ifdef ROCKSDB_PLATFORM_POSIX
+  const size_t len = FileSize(num_slots);
+  int fd = ::open(file_path.c_str(), O_CREAT | O_RDWR | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    return Status::IOError("Failed to open " + file_path,
+                           strerror(errno));
+  }
+  if (::ftruncate(fd, static_cast<off_t>(len)) != 0) {
+    Status s = Status::IOError("Failed to size " + file_path,
+                               strerror(errno));
+    ::close(fd);
+    return s;
+  }
+  void* base =
+      ::mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  // The mapping keeps the file open; the descriptor is no longer needed.
+  ::close(fd);
+  if (base == MAP_FAILED) {
+    return Status::IOError("Failed to mmap " + file_path,
+                           strerror(errno));
+  }
+  ring->reset(new StatsSnapshotRing(base, len));
+  Header* h = (*ring)->header();
+  h->version = kVersion;
+  h->num_slots = num_slots;
+  h->ticker_count = TICKER_ENUM_MAX;
+  h->histogram_count = HISTOGRAM_ENUM_MAX;
+  h->slot_size = sizeof(Slot);
+  h->next_slot.store(0, std::memory_order_relaxed);
+  for (uint32_t i = 0; i < num_slots; ++i) {
+    (*ring)->SlotAt(i)->seq.store(0, std::memory_order_relaxed);
+  }
+  // Publish the magic last so an agent that maps the file mid-init does
+  // not read a half-written header.
+  std::atomic_thread_fence(std::memory_order_release);
+  h->magic = kMagic;
+  return Status::OK();
+#else
+  (void)file_path;
+  (void)num_slots;
+  return Status::NotSupported(
+      "StatsSnapshotRing requires a platform with mmap support");
+#endif  // ROCKSDB_PLATFORM_POSIX
+}
+
+StatsSnapshotRing::~StatsSnapshotRing() {
+#ifdef ROCKSDB_PLATFORM_POSIX
+  ::munmap(base_, mapped_len_);
+#endif  // ROCKSDB_PLATFORM_POSIX
+}
+
+void StatsSnapshotRing::Publish(Statistics* statistics, SystemClock* clock) {
+  assert(statistics != nullptr);
+  Header* h = header();
+  const uint64_t idx = h->next_slot.load(std::memory_order_relaxed);
+  Slot* slot = SlotAt(idx % h->num_slots);
+
+  const uint64_t seq = slot->seq.load(std::memory_order_relaxed);
+  assert(seq % 2 == 0);  // single writer
+  slot->seq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  slot->timestamp_us = clock->NowMicros();
+  for (uint32_t t = 0; t < TICKER_ENUM_MAX; ++t) {
+    slot->tickers[t] = statistics->getTickerCount(t);
+  }
+  HistogramData data;
+  for (uint32_t hist = 0; hist < HISTOGRAM_ENUM_MAX; ++hist) {
+    statistics->histogramData(hist, &data);
+    HistogramSnapshot& snap = slot->histograms[hist];
+    snap.median = data.median;
+    snap.percentile95 = data.percentile95;
+    snap.percentile99 = data.percentile99;
+    snap.max = data.max;
+    snap.count = data.count;
+    snap.sum = data.sum;
+  }
+
+  slot->seq.store(seq + 2, std::memory_order_release);
+  h->next_slot.store(idx + 1, std::memory_order_release);
+}
+
+}  // namespace ROCKSDB_NAMESPACE
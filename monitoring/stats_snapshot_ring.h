@@ -0,0 +1,101 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "rocksdb/statistics.h"
+#include "rocksdb/status.h"
+
+namespace ROCKSDB_NAMESPACE {
+class SystemClock;
+
+// A fixed-layout ring of statistics snapshots in a memory-mapped file, for
+// external agents that want sub-second metrics without calling into the DB.
+// The publisher (a periodic task inside the DB) overwrites the oldest slot
+// in place; an agent mmap()s the same file read-only and scrapes with zero
+// syscalls and zero DB-side locking.
+//
+// Consistency is per-slot seqlock: each slot carries a sequence counter
+// that is odd while the slot is being written. A reader loads the counter
+// (acquire), copies the slot, loads the counter again, and retries if the
+// two loads differ or the value is odd. Header::next_slot counts total
+// published snapshots, so the most recent slot is
+// (next_slot - 1) % num_slots.
+//
+// The layout below is the on-file ABI; bump kVersion when changing it or
+// when tickers/histograms are added (TICKER_ENUM_MAX and
+// HISTOGRAM_ENUM_MAX are baked into the slot size).
+class StatsSnapshotRing {
+ public:
+  struct HistogramSnapshot {
+    double median;
+    double percentile95;
+    double percentile99;
+    double max;
+    uint64_t count;
+    uint64_t sum;
+  };
+
+  struct Header {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t num_slots;
+    uint32_t ticker_count;
+    uint32_t histogram_count;
+    uint64_t slot_size;
+    // Total snapshots published; written with release ordering after the
+    // slot contents, so a reader that observes next_slot == n can read
+    // slot (n - 1) % num_slots.
+    std::atomic<uint64_t> next_slot;
+  };
+
+  struct Slot {
+    // Seqlock counter; odd while the publisher is writing the slot.
+    std::atomic<uint64_t> seq;
+    uint64_t timestamp_us;
+    uint64_t tickers[TICKER_ENUM_MAX];
+    HistogramSnapshot histograms[HISTOGRAM_ENUM_MAX];
+  };
+
+  static constexpr uint64_t kMagic = 0x676e727374617473;  // "statsrng"
+  static constexpr uint32_t kVersion = 1;
+
+  // Creates (or truncates and re-initializes) `file_path` and maps it
+  // read-write. Returns NotSupported on platforms without mmap support.
+  static Status Open(const std::string& file_path, uint32_t num_slots,
+                     std::shared_ptr<StatsSnapshotRing>* ring);
+
+  ~StatsSnapshotRing();
+  StatsSnapshotRing(const StatsSnapshotRing&) = delete;
+  StatsSnapshotRing& operator=(const StatsSnapshotRing&) = delete;
+
+  // Writes one snapshot of `statistics` into the next slot. Single writer
+  // only; called from the periodic task scheduler thread.
+  void Publish(Statistics* statistics, SystemClock* clock);
+
+  static size_t FileSize(uint32_t num_slots) {
+    return sizeof(Header) + num_slots * sizeof(Slot);
+  }
+
+ private:
+  StatsSnapshotRing(void* base, size_t mapped_len);
+
+  Header* header() const { return static_cast<Header*>(base_); }
+  Slot* SlotAt(uint64_t idx) const {
+    return reinterpret_cast<Slot*>(static_cast<char*>(base_) +
+                                   sizeof(Header) + idx * sizeof(Slot));
+  }
+
+  void* base_;
+  size_t mapped_len_;
+};
+
+}  // namespace ROCKSDB_NAMESPACE
@@ -2092,6 +2092,8 @@ TEST_F(LoadCustomizableTest, LoadFlushBlockPolicyFactoryTest) {
   std::unordered_set<std::string> expected = {
       FlushBlockBySizePolicyFactory::kClassName(),
       FlushBlockEveryKeyPolicyFactory::kClassName(),
+      FlushBlockByRangePolicyFactory::kClassName(),
+      FlushBlockByValueSizePolicyFactory::kClassName(),
   };
 
   ASSERT_OK(TestExpectedBuiltins<FlushBlockPolicyFactory>(
@@ -2103,6 +2105,23 @@ TEST_F(LoadCustomizableTest, LoadFlushBlockPolicyFactoryTest) {
   ASSERT_NE(result, nullptr);
   ASSERT_STREQ(result->Name(), FlushBlockBySizePolicyFactory::kClassName());
 
+  // The ByRange policy factory accepts its options in the URI
+  ASSERT_OK(FlushBlockPolicyFactory::CreateFromString(
+      config_options_,
+      "id=FlushBlockByRangePolicyFactory; hot_ranges=a:b; hot_block_size=4096",
+      &result));
+  ASSERT_NE(result, nullptr);
+  ASSERT_STREQ(result->Name(), FlushBlockByRangePolicyFactory::kClassName());
+
+  // So does the ByValueSize policy factory
+  ASSERT_OK(FlushBlockPolicyFactory::CreateFromString(
+      config_options_,
+      "id=FlushBlockByValueSizePolicyFactory; large_value_threshold=8192",
+      &result));
+  ASSERT_NE(result, nullptr);
+  ASSERT_STREQ(result->Name(),
+               FlushBlockByValueSizePolicyFactory::kClassName());
+
   std::string table_opts = "id=BlockBasedTable; flush_block_policy_factory=";
   ASSERT_OK(TableFactory::CreateFromString(
       config_options_,
@@ -82,6 +82,8 @@ void BuildDBOptions(const ImmutableDBOptions& immutable_db_options,
   options.max_open_files = mutable_db_options.max_open_files;
   options.max_file_opening_threads =
       immutable_db_options.max_file_opening_threads;
+  options.max_file_verification_threads =
+      immutable_db_options.max_file_verification_threads;
   options.max_total_wal_size = mutable_db_options.max_total_wal_size;
   options.statistics = immutable_db_options.statistics;
   options.use_fsync = immutable_db_options.use_fsync;
@@ -99,6 +101,9 @@ void BuildDBOptions(const ImmutableDBOptions& immutable_db_options,
   options.log_file_time_to_roll = immutable_db_options.log_file_time_to_roll;
   options.keep_log_file_num = immutable_db_options.keep_log_file_num;
   options.recycle_log_file_num = immutable_db_options.recycle_log_file_num;
+  options.prepare_log_file_num = immutable_db_options.prepare_log_file_num;
+  options.use_dsync_for_wal = immutable_db_options.use_dsync_for_wal;
+  options.use_smooth_write_delay = immutable_db_options.use_smooth_write_delay;
   options.max_manifest_file_size = immutable_db_options.max_manifest_file_size;
   options.table_cache_numshardbits =
       immutable_db_options.table_cache_numshardbits;
@@ -149,6 +154,10 @@ void BuildDBOptions(const ImmutableDBOptions& immutable_db_options,
       immutable_db_options.skip_stats_update_on_db_open;
   options.skip_checking_sst_file_sizes_on_db_open =
       immutable_db_options.skip_checking_sst_file_sizes_on_db_open;
+  options.skip_table_reader_preload_on_db_open =
+      immutable_db_options.skip_table_reader_preload_on_db_open;
+  options.compaction_readahead_cache_lookup =
+      immutable_db_options.compaction_readahead_cache_lookup;
   options.wal_recovery_mode = immutable_db_options.wal_recovery_mode;
   options.allow_2pc = immutable_db_options.allow_2pc;
   options.row_cache = immutable_db_options.row_cache;
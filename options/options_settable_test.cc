@@ -179,6 +179,7 @@ TEST_F(OptionsSettableTest, BlockBasedTableOptionsAllFieldsSettable) {
       "unpartitioned_pinning=kFlushedAndSimilar;};"
       "pin_l0_filter_and_index_blocks_in_cache=1;"
       "pin_top_level_index_and_filter=1;"
+      "metadata_block_huge_page_tlb_size=0;"
       "index_type=kHashSearch;"
       "data_block_index_type=kDataBlockBinaryAndHash;"
       "index_shortening=kNoShortening;"
@@ -189,6 +190,7 @@ TEST_F(OptionsSettableTest, BlockBasedTableOptionsAllFieldsSettable) {
       "metadata_block_size=1024;"
       "partition_filters=false;"
       "decouple_partitioned_filters=true;"
+      "partition_filter_top_level_prefix_bloom=true;"
       "optimize_filters_for_memory=true;"
       "use_delta_encoding=true;"
       "index_block_restart_interval=4;"
@@ -401,6 +403,8 @@ TEST_F(OptionsSettableTest, DBOptionsAllFieldsSettable) {
                              "keep_log_file_num=4890;"
                              "skip_stats_update_on_db_open=false;"
                              "skip_checking_sst_file_sizes_on_db_open=false;"
+                             "skip_table_reader_preload_on_db_open=false;"
+                             "compaction_readahead_cache_lookup=false;"
                              "max_manifest_file_size=4295009941;"
                              "db_log_dir=path/to/db_log_dir;"
                              "writable_file_max_buffer_size=1048576;"
@@ -415,6 +419,9 @@ TEST_F(OptionsSettableTest, DBOptionsAllFieldsSettable) {
                              "strict_bytes_per_sync=true;"
                              "enable_thread_tracking=false;"
                              "recycle_log_file_num=0;"
+                             "prepare_log_file_num=0;"
+                             "use_dsync_for_wal=false;"
+                             "use_smooth_write_delay=false;"
                              "create_missing_column_families=true;"
                              "log_file_time_to_roll=3097;"
                              "max_background_flushes=35;"
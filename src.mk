@@ -137,6 +137,7 @@ LIB_SOURCES =                                                   \
   memory/jemalloc_nodump_allocator.cc                           \
   memory/memkind_kmem_allocator.cc                              \
   memory/memory_allocator.cc                                    \
+  memory/pooled_memory_allocator.cc                             \
   memtable/alloc_tracker.cc                                     \
   memtable/hash_linklist_rep.cc                                 \
   memtable/hash_skiplist_rep.cc                                 \
@@ -152,7 +153,9 @@ LIB_SOURCES =                                                   \
   monitoring/perf_context.cc                                    \
   monitoring/perf_level.cc                                      \
   monitoring/persistent_stats_history.cc                        \
+  monitoring/query_timeline.cc                                  \
   monitoring/statistics.cc                                      \
+  monitoring/stats_snapshot_ring.cc                             \
   monitoring/thread_status_impl.cc                              \
   monitoring/thread_status_updater.cc                           \
   monitoring/thread_status_updater_debug.cc                     \
@@ -273,6 +276,7 @@ LIB_SOURCES =                                                   \
   utilities/blob_db/blob_file.cc                                \
   utilities/cache_dump_load.cc                                  \
   utilities/cache_dump_load_impl.cc                             \
+  utilities/cache_scrubber.cc                                   \
   utilities/cassandra/cassandra_compaction_filter.cc            \
   utilities/cassandra/format.cc                                 \
   utilities/cassandra/merge_operator.cc                         \
@@ -300,6 +304,8 @@ LIB_SOURCES =                                                   \
   utilities/object_registry.cc                                  \
   utilities/option_change_migration/option_change_migration.cc  \
   utilities/options/options_util.cc                             \
+  utilities/options_tuner.cc                                    \
+  utilities/path_routing_fs.cc                                  \
   utilities/persistent_cache/block_cache_tier.cc                \
   utilities/persistent_cache/block_cache_tier_file.cc           \
   utilities/persistent_cache/block_cache_tier_metadata.cc       \
@@ -311,6 +317,7 @@ LIB_SOURCES =                                                   \
   utilities/simulator_cache/sim_cache.cc                        \
   utilities/table_properties_collectors/compact_for_tiering_collector.cc \
   utilities/table_properties_collectors/compact_on_deletion_collector.cc \
+  utilities/table_properties_collectors/compact_on_long_merge_chain_collector.cc \
   utilities/trace/file_trace_reader_writer.cc                   \
   utilities/trace/replayer_impl.cc                              \
   utilities/transactions/lock/lock_manager.cc                   \
@@ -624,6 +631,7 @@ TEST_MAIN_SOURCES =                                                     \
   utilities/agg_merge/agg_merge_test.cc                                 \
   utilities/backup/backup_engine_test.cc                                \
   utilities/blob_db/blob_db_test.cc                                     \
+  utilities/cache_scrubber_test.cc                                      \
   utilities/cassandra/cassandra_format_test.cc                          \
   utilities/cassandra/cassandra_functional_test.cc                      \
   utilities/cassandra/cassandra_row_merge_test.cc                       \
@@ -632,15 +640,18 @@ TEST_MAIN_SOURCES =                                                     \
   utilities/env_timed_test.cc                                           \
   utilities/memory/memory_test.cc                                       \
   utilities/merge_operators/string_append/stringappend_test.cc          \
+  utilities/path_routing_fs_test.cc                                     \
   utilities/object_registry_test.cc                                     \
   utilities/option_change_migration/option_change_migration_test.cc     \
   utilities/options/options_util_test.cc                                \
+  utilities/options_tuner_test.cc                                       \
   utilities/persistent_cache/hash_table_test.cc                         \
   utilities/persistent_cache/persistent_cache_test.cc                   \
   utilities/simulator_cache/cache_simulator_test.cc                     \
   utilities/simulator_cache/sim_cache_test.cc                           \
   utilities/table_properties_collectors/compact_for_tiering_collector_test.cc \
   utilities/table_properties_collectors/compact_on_deletion_collector_test.cc  \
+  utilities/table_properties_collectors/compact_on_long_merge_chain_collector_test.cc \
   utilities/transactions/optimistic_transaction_test.cc                 \
   utilities/transactions/lock/range/range_locking_test.cc               \
   utilities/transactions/transaction_test.cc                            \
@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "monitoring/perf_context_imp.h"
+#include "port/lang.h"
 #include "port/port.h"
 #include "port/stack_trace.h"
 #include "rocksdb/comparator.h"
@@ -48,6 +49,13 @@ struct DecodeEntry {
     if ((*shared | *non_shared | *value_length) < 128) {
       // Fast path: all three values are encoded in one byte each
       p += 3;
+    } else if ((*shared | *non_shared) < 128) {
+      // Medium path: key lengths are one byte each; only value_length (the
+      // common multi-byte case, for values >= 128 bytes) needs a full
+      // varint decode.
+      if ((p = GetVarint32Ptr(p + 2, limit, value_length)) == nullptr) {
+        return nullptr;
+      }
     } else {
       if ((p = GetVarint32Ptr(p, limit, shared)) == nullptr) {
         return nullptr;
@@ -85,6 +93,13 @@ struct CheckAndDecodeEntry {
     if ((*shared | *non_shared | *value_length) < 128) {
       // Fast path: all three values are encoded in one byte each
       p += 3;
+    } else if ((*shared | *non_shared) < 128) {
+      // Medium path: key lengths are one byte each; only value_length (the
+      // common multi-byte case, for values >= 128 bytes) needs a full
+      // varint decode.
+      if ((p = GetVarint32Ptr(p + 2, limit, value_length)) == nullptr) {
+        return nullptr;
+      }
     } else {
       if ((p = GetVarint32Ptr(p, limit, shared)) == nullptr) {
         return nullptr;
@@ -152,6 +167,9 @@ struct DecodeEntryV4 {
   }
 };
 
+// The per-entry parse paths below dominate scan profiles; flatten them so the
+// varint decoding and key handling helpers are inlined into one unit.
+ROCKSDB_FLATTEN
 void DataBlockIter::NextImpl() {
 #ifndef NDEBUG
   if (TEST_Corrupt_Callback("DataBlockIter::NextImpl")) {
@@ -169,6 +187,7 @@ void MetaBlockIter::NextImpl() {
   ++cur_entry_idx_;
 }
 
+ROCKSDB_FLATTEN
 void IndexBlockIter::NextImpl() {
   ParseNextIndexKey();
   ++cur_entry_idx_;
@@ -299,6 +318,7 @@ void DataBlockIter::PrevImpl() {
   prev_entries_idx_ = static_cast<int32_t>(prev_entries_.size()) - 1;
 }
 
+ROCKSDB_FLATTEN
 void DataBlockIter::SeekImpl(const Slice& target) {
   Slice seek_key = target;
   PERF_TIMER_GUARD(block_seek_nanos);
@@ -307,14 +327,88 @@ void DataBlockIter::SeekImpl(const Slice& target) {
   }
   uint32_t index = 0;
   bool skip_linear_scan = false;
-  bool ok = BinarySeek<DecodeKey>(seek_key, &index, &skip_linear_scan);
-
-  if (!ok) {
-    return;
+  if (data_block_hash_index_ == nullptr ||
+      !TryHashIndexSeekHint(seek_key, &index, &skip_linear_scan)) {
+    bool ok = BinarySeek<DecodeKey>(seek_key, &index, &skip_linear_scan);
+    if (!ok) {
+      return;
+    }
   }
   FindKeyAfterBinarySeek(seek_key, index, skip_linear_scan);
 }
 
+bool DataBlockIter::TryHashIndexSeekHint(const Slice& target, uint32_t* index,
+                                         bool* skip_linear_scan) {
+  assert(data_block_hash_index_ != nullptr);
+  if (restarts_ == 0) {
+    return false;
+  }
+  const Slice target_user_key = ExtractUserKey(target);
+  const uint32_t map_offset = restarts_ + num_restarts_ * sizeof(uint32_t);
+  const uint32_t entry =
+      data_block_hash_index_->Lookup(data_, map_offset, target_user_key);
+  if (entry == kCollision || entry == kNoEntry || entry >= num_restarts_) {
+    return false;
+  }
+  // Establish the BinarySeek() postcondition for the hinted restart interval:
+  // restart key `entry` <= target < restart key `entry + 1`. The hash map only
+  // says the target user key probably lives in interval `entry`; the target's
+  // seqno can still order it before the interval's restart key, and false
+  // positives are possible, so verify with the real comparator and fall back
+  // when the check fails.
+  auto compare_restart_key = [&](uint32_t restart_index) {
+    uint32_t region_offset = GetRestartPoint(restart_index);
+    uint32_t shared, non_shared;
+    const char* key_ptr = DecodeKey()(data_ + region_offset, data_ + restarts_,
+                                      &shared, &non_shared);
+    if (key_ptr == nullptr || (shared != 0)) {
+      CorruptionError();
+      return 0;
+    }
+    UpdateRawKeyAndMaybePadMinTimestamp(Slice(key_ptr, non_shared));
+    return CompareCurrentKey(target);
+  };
+  int cmp = compare_restart_key(entry);
+  if (!status_.ok()) {
+    return false;
+  }
+  if (cmp == 0) {
+    *index = entry;
+    *skip_linear_scan = true;
+    return true;
+  }
+  if (cmp > 0) {
+    if (entry == 0) {
+      // The block's very first key is greater than target, which proves the
+      // first key is the seek result no matter what the hash map said.
+      *index = 0;
+      *skip_linear_scan = true;
+      return true;
+    }
+    return false;
+  }
+  if (entry + 1 == num_restarts_) {
+    *index = entry;
+    *skip_linear_scan = false;
+    return true;
+  }
+  cmp = compare_restart_key(entry + 1);
+  if (!status_.ok()) {
+    return false;
+  }
+  if (cmp > 0) {
+    *index = entry;
+    *skip_linear_scan = false;
+    return true;
+  }
+  if (cmp == 0) {
+    *index = entry + 1;
+    *skip_linear_scan = true;
+    return true;
+  }
+  return false;
+}
+
 void MetaBlockIter::SeekImpl(const Slice& target) {
   Slice seek_key = target;
   PERF_TIMER_GUARD(block_seek_nanos);
@@ -674,6 +768,13 @@ bool BlockIter<TValue>::ParseNextKey(bool* is_shared) {
       }
     }
     value_ = Slice(p + non_shared, value_length);
+    // Entries interleave keys and values, so with wide values the next
+    // entry's header sits on a distant cache line that a key-only scan still
+    // has to touch, and its load would otherwise issue only at the start of
+    // the next ParseNextKey() call. Start fetching it while the caller
+    // processes this entry. (Prefetching past the end of the block on the
+    // last entry is harmless.)
+    PREFETCH(p + non_shared + value_length, 0 /* rw */, 1 /* locality */);
     if (shared == 0) {
       while (restart_index_ + 1 < num_restarts_ &&
              GetRestartPoint(restart_index_ + 1) < current_) {
@@ -850,6 +951,21 @@ bool BlockIter<TValue>::BinarySeek(const Slice& target, uint32_t* index,
     // The `mid` is computed by rounding up so it lands in (`left`, `right`].
     int64_t mid = left + (right - left + 1) / 2;
     uint32_t region_offset = GetRestartPoint(static_cast<uint32_t>(mid));
+    if (right - left > 1) {
+      // The restart array itself is small and contiguous, but the keys it
+      // points at are scattered across the block, so each probe is a
+      // dependent cache miss. Hide part of that latency by prefetching the
+      // two entries that may be probed next while the key at `mid` is being
+      // decoded and compared.
+      const int64_t lo_mid = left + (mid - left) / 2;
+      const int64_t hi_mid = mid + (right - mid + 1) / 2;
+      if (lo_mid > left) {
+        PREFETCH(data_ + GetRestartPoint(static_cast<uint32_t>(lo_mid)), 0, 1);
+      }
+      if (hi_mid > mid) {
+        PREFETCH(data_ + GetRestartPoint(static_cast<uint32_t>(hi_mid)), 0, 1);
+      }
+    }
     uint32_t shared, non_shared;
     const char* key_ptr = DecodeKeyFunc()(
         data_ + region_offset, data_ + restarts_, &shared, &non_shared);
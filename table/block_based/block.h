@@ -781,6 +781,16 @@ class DataBlockIter final : public BlockIter<Slice> {
   DataBlockHashIndex* data_block_hash_index_;
 
   bool SeekForGetImpl(const Slice& target);
+
+  // Try to use the data block hash index as a shortcut for the binary search
+  // over restart keys in SeekImpl(). On success, *index and *skip_linear_scan
+  // satisfy the BinarySeek() postcondition (verified with at most two restart
+  // key comparisons, so the result is correct regardless of hash quality).
+  // Returns false when the hint is unusable -- collision, absent user key,
+  // false positive, or a seqno that places `target` outside the hinted
+  // restart interval -- in which case the caller runs the normal BinarySeek().
+  bool TryHashIndexSeekHint(const Slice& target, uint32_t* index,
+                            bool* skip_linear_scan);
 };
 
 // Iterator over MetaBlocks.  MetaBlocks are similar to Data Blocks and
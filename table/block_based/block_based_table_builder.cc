@@ -93,12 +93,19 @@ FilterBlockBuilder* CreateFilterBlockBuilder(
                                  99) /
                                 100);
       partition_size = std::max(partition_size, static_cast<uint32_t>(1));
+      FilterBitsBuilder* top_level_prefix_bits_builder = nullptr;
+      if (table_opt.partition_filter_top_level_prefix_bloom &&
+          mopt.prefix_extractor) {
+        top_level_prefix_bits_builder =
+            BloomFilterPolicy::GetBuilderFromContext(context);
+      }
       return new PartitionedFilterBlockBuilder(
           mopt.prefix_extractor.get(), table_opt.whole_key_filtering,
           filter_bits_builder, table_opt.index_block_restart_interval,
           use_delta_encoding_for_index_values, p_index_builder, partition_size,
           ts_sz, persist_user_defined_timestamps,
-          table_opt.decouple_partitioned_filters);
+          table_opt.decouple_partitioned_filters,
+          top_level_prefix_bits_builder);
     } else {
       return new FullFilterBlockBuilder(mopt.prefix_extractor.get(),
                                         table_opt.whole_key_filtering,
@@ -357,6 +364,10 @@ struct BlockBasedTableBuilder::Rep {
   std::unique_ptr<FilterBlockBuilder> filter_builder;
   OffsetableCacheKey base_cache_key;
   const TableFileCreationReason reason;
+  // Whether blocks should be inserted into block cache as they are written.
+  // Derived from prepopulate_block_cache and reason, both fixed at
+  // construction, so decided once here rather than per block.
+  const bool warm_cache;
 
   BlockHandle pending_handle;  // Handle to add to index block
 
@@ -497,6 +508,10 @@ struct BlockBasedTableBuilder::Rep {
         use_delta_encoding_for_index_values(table_opt.format_version >= 4 &&
                                             !table_opt.block_align),
         reason(tbo.reason),
+        warm_cache(table_opt.prepopulate_block_cache ==
+                       BlockBasedTableOptions::PrepopulateBlockCache::
+                           kFlushOnly &&
+                   tbo.reason == TableFileCreationReason::kFlush),
         flush_block_policy(
             table_options.flush_block_policy_factory->NewFlushBlockPolicy(
                 table_options, data_block)),
@@ -1086,6 +1101,13 @@ void BlockBasedTableBuilder::Add(const Slice& ikey, const Slice& value) {
       }
     }
 
+    if (!r->last_ikey.empty() &&
+        ExtractUserKeyAndStripTimestamp(ikey, r->ts_sz) ==
+            ExtractUserKeyAndStripTimestamp(r->last_ikey, r->ts_sz)) {
+      // Same user key as the previous entry: an older version of a key that
+      // was overwritten (or deleted) and is still kept in this file.
+      r->props.num_key_overwrites++;
+    }
     r->data_block.AddWithLastKey(ikey, value, r->last_ikey);
     r->last_ikey.assign(ikey.data(), ikey.size());
     assert(!r->last_ikey.empty());
@@ -1430,27 +1452,12 @@ void BlockBasedTableBuilder::WriteMaybeCompressedBlock(
     }
   }
 
-  {
-    bool warm_cache;
-    switch (r->table_options.prepopulate_block_cache) {
-      case BlockBasedTableOptions::PrepopulateBlockCache::kFlushOnly:
-        warm_cache = (r->reason == TableFileCreationReason::kFlush);
-        break;
-      case BlockBasedTableOptions::PrepopulateBlockCache::kDisable:
-        warm_cache = false;
-        break;
-      default:
-        // missing case
-        assert(false);
-        warm_cache = false;
-    }
-    if (warm_cache) {
-      Status s = InsertBlockInCacheHelper(*uncompressed_block_data, handle,
-                                          block_type);
-      if (!s.ok()) {
-        r->SetStatus(s);
-        return;
-      }
+  if (r->warm_cache) {
+    Status s = InsertBlockInCacheHelper(*uncompressed_block_data, handle,
+                                        block_type);
+    if (!s.ok()) {
+      r->SetStatus(s);
+      return;
     }
   }
 
@@ -1655,6 +1662,30 @@ void BlockBasedTableBuilder::WriteFilterBlock(
     key.append(rep_->table_options.filter_policy->CompatibilityName());
     meta_index_builder->Add(key, filter_block_handle);
   }
+  if (ok() && is_partitioned_filter) {
+    // Optional whole-file prefix bloom over all filter partitions, written as
+    // its own meta block. Older versions simply ignore the extra metaindex
+    // entry. See
+    // BlockBasedTableOptions::partition_filter_top_level_prefix_bloom.
+    std::unique_ptr<const char[]> filter_owner;
+    Slice filter_content;
+    Status s = rep_->filter_builder->FinishTopLevelPrefixBloom(&filter_content,
+                                                               &filter_owner);
+    if (!s.ok()) {
+      rep_->SetStatus(s);
+    } else if (!filter_content.empty()) {
+      rep_->props.filter_size += filter_content.size();
+      BlockHandle top_level_filter_block_handle;
+      WriteMaybeCompressedBlock(filter_content, kNoCompression,
+                                &top_level_filter_block_handle,
+                                BlockType::kFilter);
+      if (ok()) {
+        std::string key = BlockBasedTable::kTopLevelPrefixFilterBlockPrefix;
+        key.append(rep_->table_options.filter_policy->CompatibilityName());
+        meta_index_builder->Add(key, top_level_filter_block_handle);
+      }
+    }
+  }
 }
 
 void BlockBasedTableBuilder::WriteIndexBlock(
@@ -1932,7 +1963,9 @@ void BlockBasedTableBuilder::EnterUnbuffered() {
   const size_t kInitSampleIdx = kNumBlocksBuffered / 2;
 
   std::string compression_dict_samples;
+  compression_dict_samples.reserve(kSampleBytes);
   std::vector<size_t> compression_dict_sample_lens;
+  compression_dict_sample_lens.reserve(kNumBlocksBuffered);
   size_t buffer_idx = kInitSampleIdx;
   for (size_t i = 0;
        i < kNumBlocksBuffered && compression_dict_samples.size() < kSampleBytes;
@@ -2195,6 +2228,8 @@ const std::string BlockBasedTable::kObsoleteFilterBlockPrefix = "filter.";
 const std::string BlockBasedTable::kFullFilterBlockPrefix = "fullfilter.";
 const std::string BlockBasedTable::kPartitionedFilterBlockPrefix =
     "partitionedfilter.";
+const std::string BlockBasedTable::kTopLevelPrefixFilterBlockPrefix =
+    "toplevelprefixfilter.";
 
 #ifndef NDEBUG
 RelaxedAtomic<uint64_t> g_hack_mixed_compression_in_block_based_table{0};
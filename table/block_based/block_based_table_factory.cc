@@ -302,6 +302,10 @@ static struct BlockBasedTableTypeInfo {
         {"decouple_partitioned_filters",
          {offsetof(struct BlockBasedTableOptions, decouple_partitioned_filters),
           OptionType::kBoolean, OptionVerificationType::kNormal}},
+        {"partition_filter_top_level_prefix_bloom",
+         {offsetof(struct BlockBasedTableOptions,
+                   partition_filter_top_level_prefix_bloom),
+          OptionType::kBoolean, OptionVerificationType::kNormal}},
         {"optimize_filters_for_memory",
          {offsetof(struct BlockBasedTableOptions, optimize_filters_for_memory),
           OptionType::kBoolean, OptionVerificationType::kNormal}},
@@ -361,6 +365,10 @@ static struct BlockBasedTableTypeInfo {
          {offsetof(struct BlockBasedTableOptions,
                    pin_top_level_index_and_filter),
           OptionType::kBoolean, OptionVerificationType::kNormal}},
+        {"metadata_block_huge_page_tlb_size",
+         {offsetof(struct BlockBasedTableOptions,
+                   metadata_block_huge_page_tlb_size),
+          OptionType::kSizeT, OptionVerificationType::kNormal}},
         {kOptNameMetadataCacheOpts,
          OptionTypeInfo::Struct(
              kOptNameMetadataCacheOpts, &metadata_cache_options_type_info,
@@ -756,6 +764,10 @@ std::string BlockBasedTableFactory::GetPrintableOptions() const {
   snprintf(buffer, kBufferSize, "  pin_top_level_index_and_filter: %d\n",
            table_options_.pin_top_level_index_and_filter);
   ret.append(buffer);
+  snprintf(buffer, kBufferSize,
+           "  metadata_block_huge_page_tlb_size: %" ROCKSDB_PRIszt "\n",
+           table_options_.metadata_block_huge_page_tlb_size);
+  ret.append(buffer);
   snprintf(buffer, kBufferSize, "  index_type: %d\n",
            table_options_.index_type);
   ret.append(buffer);
@@ -812,6 +824,10 @@ std::string BlockBasedTableFactory::GetPrintableOptions() const {
   snprintf(buffer, kBufferSize, "  partition_filters: %d\n",
            table_options_.partition_filters);
   ret.append(buffer);
+  snprintf(buffer, kBufferSize,
+           "  partition_filter_top_level_prefix_bloom: %d\n",
+           table_options_.partition_filter_top_level_prefix_bloom);
+  ret.append(buffer);
   snprintf(buffer, kBufferSize, "  use_delta_encoding: %d\n",
            table_options_.use_delta_encoding);
   ret.append(buffer);
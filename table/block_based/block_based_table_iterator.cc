@@ -10,7 +10,7 @@
 
 namespace ROCKSDB_NAMESPACE {
 
-void BlockBasedTableIterator::SeekToFirst() { SeekImpl(nullptr, false); }
+void BlockBasedTableIterator::SeekToFirst() { SeekImpl(nullptr, true); }
 
 void BlockBasedTableIterator::Seek(const Slice& target) {
   SeekImpl(&target, true);
@@ -57,7 +57,12 @@ void BlockBasedTableIterator::SeekImpl(const Slice* target,
 
   bool autotune_readaheadsize =
       is_first_pass && read_options_.auto_readahead_size &&
-      (read_options_.iterate_upper_bound || read_options_.prefix_same_as_start);
+      (read_options_.iterate_upper_bound ||
+       read_options_.prefix_same_as_start ||
+       // Compaction scans the whole file strictly forward, so no upper
+       // bound is needed; CompactionJob sets auto_readahead_size when
+       // DBOptions::compaction_readahead_cache_lookup opts in.
+       lookup_context_.caller == TableReaderCaller::kCompaction);
 
   if (autotune_readaheadsize &&
       table_->get_rep()->table_options.block_cache.get() &&
@@ -72,16 +77,15 @@ void BlockBasedTableIterator::SeekImpl(const Slice* target,
   if (target &&
       !CheckPrefixMayMatch(*target, IterDirection::kForward, &filter_checked)) {
     ResetDataIter();
-    RecordTick(table_->GetStatistics(), is_last_level_
-                                            ? LAST_LEVEL_SEEK_FILTERED
-                                            : NON_LAST_LEVEL_SEEK_FILTERED);
+    ticker_recorder_.Record(is_last_level_ ? LAST_LEVEL_SEEK_FILTERED
+                                           : NON_LAST_LEVEL_SEEK_FILTERED);
     return;
   }
   if (filter_checked) {
     seek_stat_state_ = kFilterUsed;
-    RecordTick(table_->GetStatistics(), is_last_level_
-                                            ? LAST_LEVEL_SEEK_FILTER_MATCH
-                                            : NON_LAST_LEVEL_SEEK_FILTER_MATCH);
+    ticker_recorder_.Record(is_last_level_
+                                ? LAST_LEVEL_SEEK_FILTER_MATCH
+                                : NON_LAST_LEVEL_SEEK_FILTER_MATCH);
   }
 
   bool need_seek_index = true;
@@ -108,6 +112,22 @@ void BlockBasedTableIterator::SeekImpl(const Slice* target,
           user_comparator_.Compare(ExtractUserKey(*target),
                                    index_iter_->user_key()) < 0) {
         need_seek_index = false;
+      } else if (user_comparator_.Compare(ExtractUserKey(*target),
+                                          block_iter_.user_key()) <= 0) {
+        // The target is at or behind the current position. This is common
+        // when a reused iterator repeatedly seeks to the same hot prefix.
+        // If the target is still past the first key of the current block,
+        // the correct position is within this block and the index
+        // navigation can be skipped. Equality with the first key is
+        // excluded since entries with the same user key may spill into the
+        // preceding block. Repositioning block_iter_ here is fine: it is
+        // re-seeked below regardless of which block ends up being used.
+        block_iter_.SeekToFirst();
+        if (block_iter_.Valid() &&
+            user_comparator_.Compare(ExtractUserKey(*target),
+                                     block_iter_.user_key()) > 0) {
+          need_seek_index = false;
+        }
       }
     }
   }
@@ -191,16 +211,15 @@ void BlockBasedTableIterator::SeekForPrev(const Slice& target) {
   // have logic
   if (!CheckPrefixMayMatch(target, IterDirection::kBackward, &filter_checked)) {
     ResetDataIter();
-    RecordTick(table_->GetStatistics(), is_last_level_
-                                            ? LAST_LEVEL_SEEK_FILTERED
-                                            : NON_LAST_LEVEL_SEEK_FILTERED);
+    ticker_recorder_.Record(is_last_level_ ? LAST_LEVEL_SEEK_FILTERED
+                                           : NON_LAST_LEVEL_SEEK_FILTERED);
     return;
   }
   if (filter_checked) {
     seek_stat_state_ = kFilterUsed;
-    RecordTick(table_->GetStatistics(), is_last_level_
-                                            ? LAST_LEVEL_SEEK_FILTER_MATCH
-                                            : NON_LAST_LEVEL_SEEK_FILTER_MATCH);
+    ticker_recorder_.Record(is_last_level_
+                                ? LAST_LEVEL_SEEK_FILTER_MATCH
+                                : NON_LAST_LEVEL_SEEK_FILTER_MATCH);
   }
 
   SavePrevIndexValue();
@@ -411,9 +430,8 @@ void BlockBasedTableIterator::InitDataBlock() {
     CheckDataBlockWithinUpperBound();
     if (!is_for_compaction &&
         (seek_stat_state_ & kDataBlockReadSinceLastSeek) == 0) {
-      RecordTick(table_->GetStatistics(), is_last_level_
-                                              ? LAST_LEVEL_SEEK_DATA
-                                              : NON_LAST_LEVEL_SEEK_DATA);
+      ticker_recorder_.Record(is_last_level_ ? LAST_LEVEL_SEEK_DATA
+                                             : NON_LAST_LEVEL_SEEK_DATA);
       seek_stat_state_ = static_cast<SeekStatState>(
           seek_stat_state_ | kDataBlockReadSinceLastSeek | kReportOnUseful);
     }
@@ -504,9 +522,8 @@ void BlockBasedTableIterator::AsyncInitDataBlock(bool is_first_pass) {
 
   if (!is_for_compaction &&
       (seek_stat_state_ & kDataBlockReadSinceLastSeek) == 0) {
-    RecordTick(table_->GetStatistics(), is_last_level_
-                                            ? LAST_LEVEL_SEEK_DATA
-                                            : NON_LAST_LEVEL_SEEK_DATA);
+    ticker_recorder_.Record(is_last_level_ ? LAST_LEVEL_SEEK_DATA
+                                           : NON_LAST_LEVEL_SEEK_DATA);
     seek_stat_state_ = static_cast<SeekStatState>(
         seek_stat_state_ | kDataBlockReadSinceLastSeek | kReportOnUseful);
   }
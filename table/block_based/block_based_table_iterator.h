@@ -10,6 +10,7 @@
 #include <deque>
 
 #include "db/seqno_to_time_mapping.h"
+#include "monitoring/statistics_impl.h"
 #include "table/block_based/block_based_table_reader.h"
 #include "table/block_based/block_based_table_reader_impl.h"
 #include "table/block_based/block_prefetcher.h"
@@ -45,9 +46,40 @@ class BlockBasedTableIterator : public InternalIteratorBase<Slice> {
         check_filter_(check_filter),
         need_upper_bound_check_(need_upper_bound_check),
         async_read_in_progress_(false),
-        is_last_level_(table->IsLastLevel()) {}
+        is_last_level_(table->IsLastLevel()),
+        ticker_recorder_(table->GetStatistics()) {
+    if (read_options_.adaptive_readahead) {
+      // Seed the prefetcher with the readahead window learned by previous
+      // iterators over this table, if any. A later SetReadaheadState() from
+      // the cross-file hand-off simply overrides this.
+      const uint64_t learned =
+          table_->get_rep()->learned_readahead_size.LoadRelaxed();
+      if (learned > 0) {
+        ReadaheadFileInfo::ReadaheadInfo info;
+        info.readahead_size = static_cast<size_t>(learned);
+        info.num_file_reads =
+            table_->get_rep()->learned_num_file_reads.LoadRelaxed();
+        block_prefetcher_.SetReadaheadState(&info);
+      }
+    }
+  }
 
-  ~BlockBasedTableIterator() override { ClearBlockHandles(); }
+  ~BlockBasedTableIterator() override {
+    if (read_options_.adaptive_readahead &&
+        block_prefetcher_.prefetch_buffer() != nullptr) {
+      // Persist the learned readahead window in the table so iterators
+      // created later start from it instead of re-learning from scratch.
+      ReadaheadFileInfo::ReadaheadInfo info;
+      block_prefetcher_.prefetch_buffer()->GetReadaheadState(&info);
+      if (info.readahead_size > 0) {
+        table_->get_rep()->learned_readahead_size.StoreRelaxed(
+            info.readahead_size);
+        table_->get_rep()->learned_num_file_reads.StoreRelaxed(
+            info.num_file_reads);
+      }
+    }
+    ClearBlockHandles();
+  }
 
   void Seek(const Slice& target) override;
   void SeekForPrev(const Slice& target) override;
@@ -122,8 +154,7 @@ class BlockBasedTableIterator : public InternalIteratorBase<Slice> {
 
     if (seek_stat_state_ & kReportOnUseful) {
       bool filter_used = (seek_stat_state_ & kFilterUsed) != 0;
-      RecordTick(
-          table_->GetStatistics(),
+      ticker_recorder_.Record(
           filter_used
               ? (is_last_level_ ? LAST_LEVEL_SEEK_DATA_USEFUL_FILTER_MATCH
                                 : NON_LAST_LEVEL_SEEK_DATA_USEFUL_FILTER_MATCH)
@@ -328,6 +359,11 @@ class BlockBasedTableIterator : public InternalIteratorBase<Slice> {
 
   mutable SeekStatState seek_stat_state_ = SeekStatState::kNone;
   bool is_last_level_;
+  // Batches the seek-stat tickers recorded per seek and per data block read;
+  // they reach the Statistics object when the iterator is destroyed. An
+  // iterator only ever touches the tickers for its own level-ness, so the
+  // distinct set stays small.
+  mutable ScopedTickerRecorder ticker_recorder_;
 
   // If set to true, it'll lookup in the cache ahead to estimate the readahead
   // size based on cache hit and miss.
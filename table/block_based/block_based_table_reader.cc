@@ -29,7 +29,9 @@
 #include "file/file_util.h"
 #include "file/random_access_file_reader.h"
 #include "logging/logging.h"
+#include "memory/arena.h"
 #include "monitoring/perf_context_imp.h"
+#include "monitoring/query_timeline_imp.h"
 #include "parsed_full_filter_block.h"
 #include "port/lang.h"
 #include "rocksdb/cache.h"
@@ -71,6 +73,7 @@
 #include "test_util/sync_point.h"
 #include "util/coding.h"
 #include "util/crc32c.h"
+#include "util/mutexlock.h"
 #include "util/stop_watch.h"
 #include "util/string_util.h"
 
@@ -83,6 +86,43 @@ CacheAllocationPtr CopyBufferToHeap(MemoryAllocator* allocator, Slice& buf) {
   memcpy(heap_buf.get(), buf.data(), buf.size());
   return heap_buf;
 }
+
+// MemoryAllocator over a huge-page-backed Arena, used for index and filter
+// blocks owned by the table reader when
+// BlockBasedTableOptions::metadata_block_huge_page_tlb_size is set. Those
+// blocks live until the reader is destroyed, which is also when the arena is
+// freed, so Deallocate() is a no-op.
+class MetadataArenaAllocator : public MemoryAllocator {
+ public:
+  MetadataArenaAllocator(Arena* arena, size_t huge_page_tlb_size,
+                         Logger* logger)
+      : arena_(arena),
+        huge_page_tlb_size_(huge_page_tlb_size),
+        logger_(logger) {}
+
+  static const char* kClassName() { return "MetadataArenaAllocator"; }
+  const char* Name() const override { return kClassName(); }
+
+  void* Allocate(size_t size) override {
+    MutexLock l(&mu_);
+    if (size > arena_->BlockSize() / 4) {
+      // Arena falls back to plain malloc for allocations above a quarter of
+      // its block size, so large blocks (e.g. a monolithic index) request a
+      // dedicated huge page mapping instead. On failure this logs a warning
+      // and falls back to regular pages.
+      return arena_->AllocateAligned(size, huge_page_tlb_size_, logger_);
+    }
+    return arena_->AllocateAligned(size);
+  }
+
+  void Deallocate(void* /*p*/) override {}
+
+ private:
+  Arena* const arena_;
+  const size_t huge_page_tlb_size_;
+  Logger* const logger_;
+  port::Mutex mu_;
+};
 }  // namespace
 
 // Explicitly instantiate templates for each "blocklike" type we use (and
@@ -838,6 +878,16 @@ Status BlockBasedTable::Open(
     return s;
   }
   rep->verify_checksum_set_on_open = ro.verify_checksums;
+
+  if (table_options.metadata_block_huge_page_tlb_size > 0) {
+    rep->metadata_arena = std::make_unique<Arena>(
+        table_options.metadata_block_huge_page_tlb_size, /*tracker=*/nullptr,
+        table_options.metadata_block_huge_page_tlb_size);
+    rep->metadata_arena_allocator = std::make_unique<MetadataArenaAllocator>(
+        rep->metadata_arena.get(),
+        table_options.metadata_block_huge_page_tlb_size, rep->ioptions.logger);
+  }
+
   s = new_table->PrefetchIndexAndFilterBlocks(
       ro, prefetch_buffer.get(), metaindex_iter.get(), new_table.get(),
       prefetch_all, table_options, level, file_size,
@@ -1239,6 +1289,40 @@ Status BlockBasedTable::PrefetchIndexAndFilterBlocks(
     }
   }
 
+  if (rep_->filter_type == Rep::FilterType::kPartitionedFilter &&
+      rep_->filter != nullptr) {
+    // Optional whole-file prefix bloom written next to the partitioned
+    // filter. It is small, so it is read eagerly into reader-owned memory
+    // rather than going through the block cache. Absent in files written
+    // without partition_filter_top_level_prefix_bloom.
+    BlockHandle top_level_prefix_filter_handle;
+    s = FindOptionalMetaBlock(
+        meta_iter,
+        kTopLevelPrefixFilterBlockPrefix +
+            rep_->filter_policy->CompatibilityName(),
+        &top_level_prefix_filter_handle);
+    if (!s.ok()) {
+      return s;
+    }
+    if (!top_level_prefix_filter_handle.IsNull()) {
+      BlockContents contents;
+      BlockFetcher block_fetcher(
+          rep_->file.get(), prefetch_buffer, rep_->footer, ro,
+          top_level_prefix_filter_handle, &contents, rep_->ioptions,
+          false /* decompress */, false /* maybe_compressed */,
+          BlockType::kFilter, UncompressionDict::GetEmptyDict(),
+          rep_->persistent_cache_options);
+      s = block_fetcher.ReadBlockContents();
+      if (!s.ok()) {
+        return s;
+      }
+      rep_->top_level_prefix_filter_data = std::move(contents);
+      rep_->top_level_prefix_filter.reset(
+          rep_->filter_policy->GetFilterBitsReader(
+              rep_->top_level_prefix_filter_data.data));
+    }
+  }
+
   if (!rep_->compression_dict_handle.IsNull()) {
     std::unique_ptr<UncompressionDictReader> uncompression_dict_reader;
     s = UncompressionDictReader::Create(
@@ -1276,6 +1360,7 @@ size_t BlockBasedTable::ApproximateMemoryUsage() const {
   if (rep_->filter) {
     usage += rep_->filter->ApproximateMemoryUsage();
   }
+  usage += rep_->top_level_prefix_filter_data.ApproximateMemoryUsage();
   if (rep_->index_reader) {
     usage += rep_->index_reader->ApproximateMemoryUsage();
   }
@@ -1328,8 +1413,11 @@ Cache::Priority BlockBasedTable::GetCachePriority() const {
   // read path (prefix extractor setting is an O(1) size special case that we
   // are working not to require from TableProperties), so it is not given
   // high-priority treatment if it should go into BlockCache.
-  if constexpr (TBlocklike::kBlockType == BlockType::kData ||
-                TBlocklike::kBlockType == BlockType::kProperties) {
+  if constexpr (TBlocklike::kBlockType == BlockType::kProperties) {
+    // Not needed on the read path, so there is no stall to avoid by keeping
+    // it resident; let it be evicted before any read-path block.
+    return Cache::Priority::BOTTOM;
+  } else if constexpr (TBlocklike::kBlockType == BlockType::kData) {
     return Cache::Priority::LOW;
   } else if (rep_->table_options
                  .cache_index_and_filter_blocks_with_high_priority) {
@@ -1598,6 +1686,7 @@ BlockBasedTable::MaybeReadBlockAndLoadToCache(
       if (use_block_cache_for_lookup) {
         s = GetDataBlockFromCache(key, block_cache, out_parsed_block,
                                   get_context, &uncompression_dict);
+        QUERY_TIMELINE_MARK(kBlockCacheProbe);
         // Value could still be null at this point, so check the cache handle
         // and update the read pattern for prefetching
         if (out_parsed_block->GetValue() ||
@@ -1623,7 +1712,6 @@ BlockBasedTable::MaybeReadBlockAndLoadToCache(
     if (out_parsed_block->GetValue() == nullptr &&
         out_parsed_block->GetCacheHandle() == nullptr && !no_io &&
         ro.fill_cache) {
-      Statistics* statistics = rep_->ioptions.stats;
       const bool maybe_compressed =
           TBlocklike::kBlockType != BlockType::kFilter &&
           TBlocklike::kBlockType != BlockType::kCompressionDictionary &&
@@ -1639,7 +1727,7 @@ BlockBasedTable::MaybeReadBlockAndLoadToCache(
       if (!contents) {
         Histograms histogram = for_compaction ? READ_BLOCK_COMPACTION_MICROS
                                               : READ_BLOCK_GET_MICROS;
-        StopWatch sw(rep_->ioptions.clock, statistics, histogram);
+        StopWatch sw(rep_->ioptions.clock, rep_->ioptions.stats, histogram);
         // Setting do_uncompress to false may cause an extra mempcy in the
         // following cases -
         // 1. Compression is enabled, but block is not actually compressed
@@ -1859,7 +1947,7 @@ WithBlocklikeCheck<Status, TBlocklike> BlockBasedTable::RetrieveBlock(
 
   const bool no_io = ro.read_tier == kBlockCacheTier;
   if (no_io) {
-    return Status::Incomplete("no blocking io");
+    return Status::Incomplete(Status::SubCode::kBlockingIoNotAllowed);
   }
 
   const bool maybe_compressed =
@@ -1868,6 +1956,19 @@ WithBlocklikeCheck<Status, TBlocklike> BlockBasedTable::RetrieveBlock(
       rep_->blocks_maybe_compressed;
   std::unique_ptr<TBlocklike> block;
 
+  MemoryAllocator* memory_allocator = GetMemoryAllocator(rep_->table_options);
+  if (rep_->metadata_arena_allocator && lookup_context &&
+      lookup_context->caller == TableReaderCaller::kPrefetch &&
+      (TBlocklike::kBlockType == BlockType::kIndex ||
+       TBlocklike::kBlockType == BlockType::kFilter ||
+       TBlocklike::kBlockType == BlockType::kFilterPartitionIndex)) {
+    // Open-time (kPrefetch) reads of index/filter blocks that bypass the
+    // block cache produce blocks owned by the table reader for its whole
+    // lifetime, matching the arena's lifetime. Other uncached reads are
+    // transient and must not accumulate in the arena.
+    memory_allocator = rep_->metadata_arena_allocator.get();
+  }
+
   {
     Histograms histogram =
         for_compaction ? READ_BLOCK_COMPACTION_MICROS : READ_BLOCK_GET_MICROS;
@@ -1875,8 +1976,8 @@ WithBlocklikeCheck<Status, TBlocklike> BlockBasedTable::RetrieveBlock(
     s = ReadAndParseBlockFromFile(
         rep_->file.get(), prefetch_buffer, rep_->footer, ro, handle, &block,
         rep_->ioptions, rep_->create_context, maybe_compressed,
-        uncompression_dict, rep_->persistent_cache_options,
-        GetMemoryAllocator(rep_->table_options), for_compaction, async_read);
+        uncompression_dict, rep_->persistent_cache_options, memory_allocator,
+        for_compaction, async_read);
 
     if (get_context) {
       switch (TBlocklike::kBlockType) {
@@ -2216,6 +2317,110 @@ Status BlockBasedTable::ApproximateKeyAnchors(const ReadOptions& read_options,
   return Status::OK();
 }
 
+Status BlockBasedTable::GetDataBlockHandles(const ReadOptions& read_options,
+                                            std::vector<BlockHandle>* handles) {
+  assert(handles);
+  handles->clear();
+  // See the comment in ApproximateKeyAnchors() above: bring all index
+  // partitions into cache with one I/O before the full index scan.
+  Status s = rep_->index_reader->CacheDependencies(
+      read_options, false /* pin */, nullptr /* prefetch_buffer */);
+  if (!s.ok()) {
+    return s;
+  }
+
+  IndexBlockIter iiter_on_stack;
+  auto iiter = NewIndexIterator(
+      read_options, /*disable_prefix_seek=*/false, &iiter_on_stack,
+      /*get_context=*/nullptr, /*lookup_context=*/nullptr);
+  std::unique_ptr<InternalIteratorBase<IndexValue>> iiter_unique_ptr;
+  if (iiter != &iiter_on_stack) {
+    iiter_unique_ptr.reset(iiter);
+  }
+
+  for (iiter->SeekToFirst(); iiter->Valid(); iiter->Next()) {
+    handles->push_back(iiter->value().handle);
+  }
+  return iiter->status();
+}
+
+Status BlockBasedTable::AnalyzeDataBlock(const ReadOptions& read_options,
+                                         const BlockHandle& handle,
+                                         const SliceTransform* prefix_extractor,
+                                         DataBlockStats* stats) const {
+  assert(stats);
+  *stats = DataBlockStats();
+  stats->compressed_size = handle.size();
+
+  CachableEntry<UncompressionDict> uncompression_dict;
+  if (rep_->uncompression_dict_reader) {
+    Status s = rep_->uncompression_dict_reader->GetOrReadUncompressionDictionary(
+        /* prefetch_buffer= */ nullptr, read_options,
+        /* get_context= */ nullptr, /* lookup_context= */ nullptr,
+        &uncompression_dict);
+    if (!s.ok()) {
+      return s;
+    }
+  }
+  const UncompressionDict& dict = uncompression_dict.GetValue()
+                                      ? *uncompression_dict.GetValue()
+                                      : UncompressionDict::GetEmptyDict();
+
+  CachableEntry<Block_kData> block;
+  Status s = RetrieveBlock<Block_kData>(
+      /* prefetch_buffer= */ nullptr, read_options, handle, dict, &block,
+      /* get_context= */ nullptr, /* lookup_context= */ nullptr,
+      /* for_compaction= */ false, /* use_cache= */ false,
+      /* async_read= */ false, /* use_block_cache_for_lookup= */ false);
+  if (!s.ok()) {
+    return s;
+  }
+  assert(block.GetValue() != nullptr);
+
+  stats->uncompressed_size = block.GetValue()->size();
+  stats->num_restarts = block.GetValue()->NumRestarts();
+
+  std::unique_ptr<DataBlockIter> biter(block.GetValue()->NewDataIterator(
+      rep_->internal_comparator.user_comparator(),
+      rep_->get_global_seqno(BlockType::kData), /* iter= */ nullptr,
+      /* stats= */ nullptr, /* block_contents_pinned= */ false,
+      rep_->user_defined_timestamps_persisted));
+
+  std::string last_prefix;
+  bool has_last_prefix = false;
+  for (biter->SeekToFirst(); biter->Valid(); biter->Next()) {
+    ++stats->num_entries;
+
+    ParsedInternalKey ikey;
+    Status pik_status =
+        ParseInternalKey(biter->key(), &ikey, false /* log_err_key */);
+    if (!pik_status.ok()) {
+      return pik_status;
+    }
+    if (ikey.type == kTypeDeletion || ikey.type == kTypeSingleDeletion ||
+        ikey.type == kTypeDeletionWithTimestamp) {
+      ++stats->num_point_deletions;
+    }
+
+    Slice prefix;
+    if (prefix_extractor != nullptr &&
+        prefix_extractor->InDomain(ikey.user_key)) {
+      prefix = prefix_extractor->Transform(ikey.user_key);
+    } else {
+      prefix = Slice(ikey.user_key.data(),
+                     std::min(ikey.user_key.size(), size_t{8}));
+    }
+    // Keys within a block are sorted, so distinct prefixes can be counted
+    // by watching for the prefix to change.
+    if (!has_last_prefix || prefix.compare(last_prefix) != 0) {
+      ++stats->num_distinct_prefixes;
+      last_prefix.assign(prefix.data(), prefix.size());
+      has_last_prefix = true;
+    }
+  }
+  return biter->status();
+}
+
 bool BlockBasedTable::TimestampMayMatch(const ReadOptions& read_options) const {
   if (read_options.timestamp != nullptr && !rep_->min_timestamp.empty()) {
     RecordTick(rep_->ioptions.stats, TIMESTAMP_FILTER_TABLE_CHECKED);
@@ -2584,6 +2789,10 @@ BlockType BlockBasedTable::GetBlockTypeForMetaBlockByName(
     return BlockType::kFilterPartitionIndex;
   }
 
+  if (meta_block_name.starts_with(kTopLevelPrefixFilterBlockPrefix)) {
+    return BlockType::kFilter;
+  }
+
   if (meta_block_name == kPropertiesBlockName) {
     return BlockType::kProperties;
   }
@@ -18,6 +18,7 @@
 #include "db/range_tombstone_fragmenter.h"
 #include "db/seqno_to_time_mapping.h"
 #include "file/filename.h"
+#include "memory/arena.h"
 #include "rocksdb/slice_transform.h"
 #include "rocksdb/table_properties.h"
 #include "table/block_based/block.h"
@@ -26,6 +27,7 @@
 #include "table/block_based/block_type.h"
 #include "table/block_based/cachable_entry.h"
 #include "table/block_based/filter_block.h"
+#include "table/block_based/filter_policy_internal.h"
 #include "table/block_based/uncompression_dict_reader.h"
 #include "table/format.h"
 #include "table/persistent_cache_options.h"
@@ -72,6 +74,7 @@ class BlockBasedTable : public TableReader {
   static const std::string kObsoleteFilterBlockPrefix;
   static const std::string kFullFilterBlockPrefix;
   static const std::string kPartitionedFilterBlockPrefix;
+  static const std::string kTopLevelPrefixFilterBlockPrefix;
 
   // 1-byte compression type + 32-bit checksum
   static constexpr size_t kBlockTrailerSize = 5;
@@ -184,6 +187,31 @@ class BlockBasedTable : public TableReader {
   Status ApproximateKeyAnchors(const ReadOptions& read_options,
                                std::vector<Anchor>& anchors) override;
 
+  // Per-data-block statistics gathered by AnalyzeDataBlock().
+  struct DataBlockStats {
+    uint64_t compressed_size = 0;  // on-disk size, excluding block trailer
+    uint64_t uncompressed_size = 0;
+    uint32_t num_restarts = 0;
+    uint64_t num_entries = 0;
+    uint64_t num_point_deletions = 0;
+    // Number of distinct key prefixes in the block, using the prefix
+    // extractor passed to AnalyzeDataBlock() for in-domain keys and the
+    // first 8 bytes of the user key otherwise.
+    uint64_t num_distinct_prefixes = 0;
+  };
+
+  // Collects the handles of all data blocks, in index order.
+  Status GetDataBlockHandles(const ReadOptions& read_options,
+                             std::vector<BlockHandle>* handles);
+
+  // Reads, decompresses and iterates the data block at `handle`, filling
+  // `stats`. Does not populate the block cache. Safe to call from multiple
+  // threads concurrently.
+  Status AnalyzeDataBlock(const ReadOptions& read_options,
+                          const BlockHandle& handle,
+                          const SliceTransform* prefix_extractor,
+                          DataBlockStats* stats) const;
+
   bool EraseFromCache(const BlockHandle& handle) const;
 
   bool TEST_BlockInCache(const BlockHandle& handle) const;
@@ -252,6 +280,13 @@ class BlockBasedTable : public TableReader {
 
   class IndexReaderCommon;
 
+  // Computes the base cache key for the file. When the table properties
+  // carry the writing session's identifiers (db_session_id and
+  // orig_file_number), the key is derived from those rather than the
+  // current session/file number, making it stable across re-open,
+  // backup/restore, and checkpoint restore, and shared by byte-identical
+  // copies of the file in different DBs using the same block cache.
+  // *out_is_stable (optional) reports whether that was possible.
   static void SetupBaseCacheKey(const TableProperties* properties,
                                 const std::string& cur_db_session_id,
                                 uint64_t cur_file_number,
@@ -604,10 +639,26 @@ struct BlockBasedTable::Rep {
   // Footer contains the fixed table information
   Footer footer;
 
+  // Huge-page-backed arena from which reader-owned index and filter blocks
+  // are allocated when metadata_block_huge_page_tlb_size is set, and the
+  // MemoryAllocator wrapper handed to the block read path. Declared before
+  // index_reader/filter so the blocks they hold are destroyed while their
+  // backing memory is still alive.
+  std::unique_ptr<Arena> metadata_arena;
+  std::unique_ptr<MemoryAllocator> metadata_arena_allocator;
+
   std::unique_ptr<IndexReader> index_reader;
   std::unique_ptr<FilterBlockReader> filter;
   std::unique_ptr<UncompressionDictReader> uncompression_dict_reader;
 
+  // Optional whole-file prefix bloom written alongside partitioned filters
+  // (see BlockBasedTableOptions::partition_filter_top_level_prefix_bloom).
+  // Kept in reader-owned memory, outside the block cache, for the lifetime
+  // of the table. top_level_prefix_filter reads from
+  // top_level_prefix_filter_data.
+  BlockContents top_level_prefix_filter_data;
+  std::unique_ptr<FilterBitsReader> top_level_prefix_filter;
+
   enum class FilterType {
     kNoFilter,
     kFullFilter,
@@ -683,6 +734,15 @@ struct BlockBasedTable::Rep {
   // case of such a race, they will most likely be storing the same value.
   RelaxedAtomic<uint32_t> uncache_aggressiveness{0};
 
+  // Data-block readahead state saved by the most recently destroyed
+  // adaptive-readahead iterator over this table. New iterators seed their
+  // BlockPrefetcher from it, so a workload of many short-lived scans over
+  // the same file does not re-learn the readahead window from
+  // initial_auto_readahead_size every time. Zero means nothing learned yet.
+  // Racy updates are acceptable; any recently learned value is useful.
+  mutable RelaxedAtomic<uint64_t> learned_readahead_size{0};
+  mutable RelaxedAtomic<int64_t> learned_num_file_reads{0};
+
   std::unique_ptr<CacheReservationManager::CacheReservationHandle>
       table_reader_cache_res_handle = nullptr;
 
@@ -747,9 +747,9 @@ DEFINE_SYNC_AND_ASYNC(void, BlockBasedTable::MultiGet)
             break;
           }
           Status read_status;
-          bool ret = get_context->SaveValue(
-              parsed_key, biter->value(), &matched, &read_status,
-              value_pinner ? value_pinner : nullptr);
+          bool ret = get_context->SaveValue(parsed_key, biter->value(),
+                                            &matched, &read_status,
+                                            value_pinner);
           if (!read_status.ok()) {
             s = read_status;
             break;
@@ -987,6 +987,58 @@ TEST_P(BlockBasedTableReaderTestVerifyChecksum, ChecksumMismatch) {
   ASSERT_EQ(s.code(), Status::kCorruption);
 }
 
+class BlockBasedTableReaderMetadataArenaTest
+    : public BlockBasedTableReaderBaseTest {
+ protected:
+  void ConfigureTableFactory() override {
+    BlockBasedTableOptions opts;
+    opts.no_block_cache = true;
+    opts.cache_index_and_filter_blocks = false;
+    opts.filter_policy.reset(NewBloomFilterPolicy(10, false));
+    opts.metadata_block_huge_page_tlb_size = 2 * 1024 * 1024;
+    options_.table_factory.reset(
+        static_cast<BlockBasedTableFactory*>(NewBlockBasedTableFactory(opts)));
+  }
+};
+
+TEST_F(BlockBasedTableReaderMetadataArenaTest, OwnedIndexAndFilterUseArena) {
+  Options options;
+  std::vector<std::pair<std::string, std::string>> kv =
+      BlockBasedTableReaderBaseTest::GenerateKVMap(100 /* num_block */);
+
+  std::string table_name =
+      "BlockBasedTableReaderMetadataArenaTest_OwnedIndexAndFilterUseArena";
+  ImmutableOptions ioptions(options);
+  CreateTable(table_name, ioptions, CompressionType::kNoCompression, kv);
+
+  std::unique_ptr<BlockBasedTable> table;
+  FileOptions foptions;
+  InternalKeyComparator comparator(options.comparator);
+  NewBlockBasedTableReader(foptions, ioptions, comparator, table_name, &table);
+  ASSERT_NE(table, nullptr);
+
+  // The index and filter blocks read at open time are reader-owned (no block
+  // cache), so they should have been allocated from the metadata arena.
+  // Whether the arena actually got huge pages depends on how many the system
+  // has reserved; allocation transparently falls back to regular pages, so
+  // only arena usage is asserted here.
+  ASSERT_NE(table->get_rep()->metadata_arena, nullptr);
+  ASSERT_GT(table->get_rep()->metadata_arena->ApproximateMemoryUsage(), 0u);
+
+  ReadOptions read_opts;
+  std::unique_ptr<InternalIterator> iter(table->NewIterator(
+      read_opts, options_.prefix_extractor.get(), /*arena=*/nullptr,
+      /*skip_filters=*/false, TableReaderCaller::kUncategorized));
+  iter->SeekToFirst();
+  for (auto kv_iter = kv.begin(); kv_iter != kv.end(); kv_iter++) {
+    ASSERT_TRUE(iter->Valid());
+    ASSERT_EQ(iter->key().ToString(), kv_iter->first);
+    ASSERT_EQ(iter->value().ToString(), kv_iter->second);
+    iter->Next();
+  }
+  ASSERT_OK(iter->status());
+}
+
 // Param 1: compression type
 // Param 2: whether to use direct reads
 // Param 3: Block Based Table Index type, partitioned filters are also enabled
@@ -32,7 +32,12 @@ void BlockPrefetcher::PrefetchIfNeeded(
   const size_t len = BlockBasedTable::BlockSizeWithTrailer(handle);
   const size_t offset = handle.offset();
   if (is_for_compaction) {
-    if (!rep->file->use_direct_io() && compaction_readahead_size_ > 0) {
+    // When the iterator does block cache lookups to size readahead
+    // (readaheadsize_cb set), FS-level prefetch cannot skip cache-resident
+    // ranges, so prefer the internal prefetch buffer which honors the
+    // callback.
+    if (readaheadsize_cb == nullptr && !rep->file->use_direct_io() &&
+        compaction_readahead_size_ > 0) {
       // If FS supports prefetching (readahead_limit_ will be non zero in that
       // case) and current block exists in prefetch buffer then return.
       if (offset + len <= readahead_limit_) {
@@ -59,8 +64,7 @@ void BlockPrefetcher::PrefetchIfNeeded(
     readahead_params.initial_readahead_size = compaction_readahead_size_;
     readahead_params.max_readahead_size = compaction_readahead_size_;
     rep->CreateFilePrefetchBufferIfNotExists(
-        readahead_params, &prefetch_buffer_,
-        /*readaheadsize_cb=*/nullptr,
+        readahead_params, &prefetch_buffer_, readaheadsize_cb,
         /*usage=*/FilePrefetchBufferUsage::kCompactionPrefetch);
     return;
   }
@@ -101,6 +105,71 @@ void BlockPrefetcher::PrefetchIfNeeded(
     return;
   }
 
+  // Backward-sequential scans (SeekForPrev followed by Prev) visit blocks at
+  // strictly decreasing offsets, which the forward logic below would treat
+  // as random access. Detect the pattern and prefetch a window that *ends*
+  // at the current block instead of one that starts at it.
+  if (IsBlockBackwardSequential(offset, len)) {
+    num_backward_file_reads_++;
+    UpdateReadPattern(offset, len);
+    if (num_backward_file_reads_ <=
+        rep->table_options.num_file_reads_for_auto_readahead) {
+      return;
+    }
+    // Current block is already covered by the last backward window.
+    if (offset >= backward_prefetch_start_ &&
+        offset + len <= backward_prefetch_limit_) {
+      return;
+    }
+    if (backward_readahead_size_ == 0) {
+      backward_readahead_size_ = initial_auto_readahead_size_;
+    }
+    const uint64_t end = offset + len;
+    uint64_t start =
+        end > backward_readahead_size_ ? end - backward_readahead_size_ : 0;
+    // Always cover the full current block, even if it exceeds the window.
+    start = std::min(start, static_cast<uint64_t>(offset));
+    IOOptions opts;
+    Status s = rep->file->PrepareIOOptions(read_options, opts);
+    if (!s.ok()) {
+      return;
+    }
+    if (!rep->file->use_direct_io()) {
+      s = rep->file->Prefetch(opts, start, static_cast<size_t>(end - start));
+      if (s.ok()) {
+        backward_prefetch_start_ = start;
+        backward_prefetch_limit_ = end;
+        backward_readahead_size_ =
+            std::min(max_auto_readahead_size, backward_readahead_size_ * 2);
+        return;
+      } else if (!s.IsNotSupported()) {
+        return;
+      }
+    }
+    // Fall back to the internal prefetch buffer. The async multi-buffer
+    // mode only fills forward, so backward windows are loaded into a single
+    // synchronous buffer; when this iterator runs in async mode it may
+    // already own a multi-buffer FilePrefetchBuffer, in which case backward
+    // prefetching is not supported.
+    if (is_async_io_prefetch) {
+      return;
+    }
+    readahead_params.num_buffers = 1;
+    rep->CreateFilePrefetchBufferIfNotExists(
+        readahead_params, &prefetch_buffer_, readaheadsize_cb,
+        /*usage=*/FilePrefetchBufferUsage::kUserScanPrefetch);
+    s = prefetch_buffer_->Prefetch(opts, rep->file.get(), start,
+                                   static_cast<size_t>(end - start));
+    if (s.ok()) {
+      backward_prefetch_start_ = start;
+      backward_prefetch_limit_ = end;
+      backward_readahead_size_ =
+          std::min(max_auto_readahead_size, backward_readahead_size_ * 2);
+    }
+    return;
+  }
+  num_backward_file_reads_ = 0;
+
   // If FS supports prefetching (readahead_limit_ will be non zero in that case)
   // and current block exists in prefetch buffer then return.
   if (offset + len <= readahead_limit_) {
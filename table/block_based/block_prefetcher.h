@@ -35,6 +35,12 @@ class BlockPrefetcher {
     return (prev_len_ == 0 || (prev_offset_ + prev_len_ == offset));
   }
 
+  // True if the current block immediately precedes the previously read one,
+  // i.e. the iterator is moving backward (SeekForPrev/Prev).
+  bool IsBlockBackwardSequential(const uint64_t& offset, const size_t& len) {
+    return (prev_len_ != 0 && offset + len == prev_offset_);
+  }
+
   void ResetValues(size_t initial_auto_readahead_size) {
     num_file_reads_ = 1;
     // Since initial_auto_readahead_size_ can be different from
@@ -69,6 +75,14 @@ class BlockPrefetcher {
   uint64_t num_file_reads_ = 0;
   uint64_t prev_offset_ = 0;
   size_t prev_len_ = 0;
+  // State for backward-sequential scans: number of consecutive backward
+  // block reads, the window size to prefetch (doubles up to
+  // max_auto_readahead_size like the forward readahead), and the file range
+  // covered by the last backward prefetch.
+  uint64_t num_backward_file_reads_ = 0;
+  size_t backward_readahead_size_ = 0;
+  uint64_t backward_prefetch_start_ = 0;
+  uint64_t backward_prefetch_limit_ = 0;
   std::unique_ptr<FilePrefetchBuffer> prefetch_buffer_;
 };
 }  // namespace ROCKSDB_NAMESPACE
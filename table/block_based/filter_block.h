@@ -101,6 +101,17 @@ class FilterBlockBuilder {
     return Status::OK();
   }
 
+  // For builders that also maintain a whole-file top-level prefix bloom
+  // (see BlockBasedTableOptions::partition_filter_top_level_prefix_bloom):
+  // returns its serialized bytes, or an empty slice when none was built.
+  // Must be called after the final call to Finish(); lifetime of *filter
+  // follows the same rules as Finish().
+  virtual Status FinishTopLevelPrefixBloom(
+      Slice* filter, std::unique_ptr<const char[]>* /*filter_owner*/) {
+    *filter = Slice();
+    return Status::OK();
+  }
+
 #ifndef NDEBUG
   Slice TEST_Finish() {  // Generate Filter
     const BlockHandle empty_handle;
@@ -528,24 +528,47 @@ class FastLocalBloomBitsBuilder : public XXPH3FilterBitsBuilder {
     //                               num_probes, data);
     // }
 
-    const size_t num_entries = hash_entries_info_.entries.size();
+    std::deque<uint64_t>& entries = hash_entries_info_.entries;
+    const size_t num_entries = entries.size();
     constexpr size_t kBufferMask = 7;
     static_assert(((kBufferMask + 1) & kBufferMask) == 0,
                   "Must be power of 2 minus 1");
 
+    // Unless the hash entries must be kept around afterwards (to verify
+    // their checksum and for post-verification of the filter), consume the
+    // deque as we go and drop the corresponding cache reservations, so that
+    // hash entry memory (8 bytes/key) is released incrementally instead of
+    // held in full alongside the completed filter bits. This substantially
+    // reduces peak memory for building a large full filter.
+    const bool consume_entries = !detect_filter_construct_corruption_;
+    size_t num_consumed = 0;
+    std::deque<uint64_t>::iterator hash_entries_it = entries.begin();
+    auto next_hash = [&]() {
+      uint64_t h;
+      if (consume_entries) {
+        h = entries.front();
+        entries.pop_front();
+        if (((++num_consumed) % kUint64tHashEntryCacheResBucketSize) == 0 &&
+            !hash_entries_info_.cache_res_bucket_handles.empty()) {
+          hash_entries_info_.cache_res_bucket_handles.pop_front();
+        }
+      } else {
+        h = *hash_entries_it;
+        ++hash_entries_it;
+      }
+      return h;
+    };
+
     std::array<uint32_t, kBufferMask + 1> hashes;
     std::array<uint32_t, kBufferMask + 1> byte_offsets;
 
     // Prime the buffer
     size_t i = 0;
-    std::deque<uint64_t>::iterator hash_entries_it =
-        hash_entries_info_.entries.begin();
     for (; i <= kBufferMask && i < num_entries; ++i) {
-      uint64_t h = *hash_entries_it;
+      uint64_t h = next_hash();
       FastLocalBloomImpl::PrepareHash(Lower32of64(h), len, data,
                                       /*out*/ &byte_offsets[i]);
       hashes[i] = Upper32of64(h);
-      ++hash_entries_it;
     }
 
     // Process and buffer
@@ -556,11 +579,10 @@ class FastLocalBloomBitsBuilder : public XXPH3FilterBitsBuilder {
       FastLocalBloomImpl::AddHashPrepared(hash_ref, num_probes,
                                           data + byte_offset_ref);
       // And buffer
-      uint64_t h = *hash_entries_it;
+      uint64_t h = next_hash();
       FastLocalBloomImpl::PrepareHash(Lower32of64(h), len, data,
                                       /*out*/ &byte_offset_ref);
       hash_ref = Upper32of64(h);
-      ++hash_entries_it;
     }
 
     // Finish processing
@@ -610,6 +632,8 @@ class FastLocalBloomBitsReader : public BuiltinFilterBitsReader {
     }
   }
 
+  bool HashMayMatchSupported() const override { return true; }
+
   bool HashMayMatch(const uint64_t h) override {
     return FastLocalBloomImpl::HashMayMatch(Lower32of64(h), Upper32of64(h),
                                             len_bytes_, num_probes_, data_);
@@ -1055,6 +1079,8 @@ class Standard128RibbonBitsReader : public BuiltinFilterBitsReader {
     }
   }
 
+  bool HashMayMatchSupported() const override { return true; }
+
   bool HashMayMatch(const uint64_t h) override {
     return soln_.FilterQuery(h, hasher_);
   }
@@ -1357,6 +1383,7 @@ class AlwaysTrueFilter : public BuiltinFilterBitsReader {
  public:
   bool MayMatch(const Slice&) override { return true; }
   using FilterBitsReader::MayMatch;  // inherit overload
+  bool HashMayMatchSupported() const override { return true; }
   bool HashMayMatch(const uint64_t) override { return true; }
   using BuiltinFilterBitsReader::HashMayMatch;  // inherit overload
 };
@@ -1365,6 +1392,7 @@ class AlwaysFalseFilter : public BuiltinFilterBitsReader {
  public:
   bool MayMatch(const Slice&) override { return false; }
   using FilterBitsReader::MayMatch;  // inherit overload
+  bool HashMayMatchSupported() const override { return true; }
   bool HashMayMatch(const uint64_t) override { return false; }
   using BuiltinFilterBitsReader::HashMayMatch;  // inherit overload
 };
@@ -107,6 +107,19 @@ class FilterBitsReader {
       may_match[i] = MayMatch(*keys[i]);
     }
   }
+
+  // Whether HashMayMatch() can answer queries for this reader. A point
+  // lookup probes one filter per overlapping file with the same entry, so
+  // callers use this to hash the entry once (with GetSliceHash64()) and
+  // reuse the hash across probes. Readers whose scheme does not start from
+  // that hash must leave this false, in which case HashMayMatch() results
+  // are meaningless.
+  virtual bool HashMayMatchSupported() const { return false; }
+
+  // Check if the hash of the entry match the bits in filter. The hash must
+  // be GetSliceHash64() of the entry, and the result is only meaningful
+  // when HashMayMatchSupported() returns true.
+  virtual bool HashMayMatch(const uint64_t /* h */) { return true; }
 };
 
 // Exposes any extra information needed for testing built-in
@@ -129,11 +142,7 @@ class BuiltinFilterBitsBuilder : public FilterBitsBuilder {
 
 // Base class for RocksDB built-in filter reader with
 // extra useful functionalities for inernal.
-class BuiltinFilterBitsReader : public FilterBitsReader {
- public:
-  // Check if the hash of the entry match the bits in filter
-  virtual bool HashMayMatch(const uint64_t /* h */) { return true; }
-};
+class BuiltinFilterBitsReader : public FilterBitsReader {};
 
 // Base class for RocksDB built-in filter policies. This provides the
 // ability to read all kinds of built-in filters (so that old filters can
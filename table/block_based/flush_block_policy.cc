@@ -8,9 +8,11 @@
 #include <cassert>
 #include <mutex>
 
+#include "db/dbformat.h"
 #include "rocksdb/options.h"
 #include "rocksdb/slice.h"
 #include "rocksdb/utilities/customizable_util.h"
+#include "rocksdb/utilities/options_type.h"
 #include "table/block_based/block_based_table_reader.h"
 #include "table/block_based/block_builder.h"
 #include "table/block_based/flush_block_policy_impl.h"
@@ -75,6 +77,155 @@ class FlushBlockBySizePolicy : public FlushBlockPolicy {
   const BlockBuilder& data_block_builder_;
 };
 
+// Flush by size, with a smaller size target for blocks that start inside
+// one of the configured hot user-key ranges. See FlushBlockByRangeOptions.
+class FlushBlockByRangePolicy : public FlushBlockPolicy {
+ public:
+  FlushBlockByRangePolicy(
+      std::vector<std::pair<std::string, std::string>>&& hot_ranges,
+      const uint64_t hot_block_size, const uint64_t cold_block_size,
+      const uint64_t block_size_deviation, const bool align,
+      const BlockBuilder& data_block_builder)
+      : hot_ranges_(std::move(hot_ranges)),
+        hot_policy_(hot_block_size, block_size_deviation, align,
+                    data_block_builder),
+        cold_policy_(cold_block_size, block_size_deviation, align,
+                     data_block_builder),
+        data_block_builder_(data_block_builder) {}
+
+  bool Update(const Slice& key, const Slice& value) override {
+    if (data_block_builder_.empty()) {
+      // The incoming key starts a new block; its heat picks the size target
+      // for the whole block.
+      current_block_hot_ = IsHot(key.size() >= kNumInternalBytes
+                                     ? ExtractUserKey(key)
+                                     : key);
+      return false;
+    }
+    return current_block_hot_ ? hot_policy_.Update(key, value)
+                              : cold_policy_.Update(key, value);
+  }
+
+ private:
+  bool IsHot(const Slice& user_key) const {
+    for (const auto& range : hot_ranges_) {
+      if (user_key.compare(range.first) >= 0 &&
+          user_key.compare(range.second) <= 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  const std::vector<std::pair<std::string, std::string>> hot_ranges_;
+  FlushBlockBySizePolicy hot_policy_;
+  FlushBlockBySizePolicy cold_policy_;
+  const BlockBuilder& data_block_builder_;
+  bool current_block_hot_ = false;
+};
+
+// Flush by size, but give values of at least large_value_threshold a
+// single-entry data block of their own so key-dense blocks stay compact.
+// See FlushBlockByValueSizeOptions.
+class FlushBlockByValueSizePolicy : public FlushBlockPolicy {
+ public:
+  FlushBlockByValueSizePolicy(const uint64_t large_value_threshold,
+                              const uint64_t block_size,
+                              const uint64_t block_size_deviation,
+                              const bool align,
+                              const BlockBuilder& data_block_builder)
+      : large_value_threshold_(large_value_threshold),
+        size_policy_(block_size, block_size_deviation, align,
+                     data_block_builder),
+        data_block_builder_(data_block_builder) {}
+
+  bool Update(const Slice& key, const Slice& value) override {
+    const bool large = large_value_threshold_ > 0 &&
+                       value.size() >= large_value_threshold_;
+    if (data_block_builder_.empty()) {
+      current_block_holds_large_value_ = large;
+      return false;
+    }
+    if (current_block_holds_large_value_ || large) {
+      // Either the current block holds an isolated large value that must not
+      // grow, or a large value is about to join a dense block. Cut here; the
+      // incoming entry becomes the first of the next block.
+      current_block_holds_large_value_ = large;
+      return true;
+    }
+    return size_policy_.Update(key, value);
+  }
+
+ private:
+  const uint64_t large_value_threshold_;
+  FlushBlockBySizePolicy size_policy_;
+  const BlockBuilder& data_block_builder_;
+  bool current_block_holds_large_value_ = false;
+};
+
+static std::unordered_map<std::string, OptionTypeInfo>
+    flush_block_by_range_type_info = {
+        {"hot_ranges",
+         {offsetof(struct FlushBlockByRangeOptions, hot_ranges),
+          OptionType::kString, OptionVerificationType::kNormal,
+          OptionTypeFlags::kNone}},
+        {"hot_block_size",
+         {offsetof(struct FlushBlockByRangeOptions, hot_block_size),
+          OptionType::kUInt64T, OptionVerificationType::kNormal,
+          OptionTypeFlags::kNone}},
+};
+
+FlushBlockByRangePolicyFactory::FlushBlockByRangePolicyFactory()
+    : FlushBlockPolicyFactory() {
+  RegisterOptions(&options_, &flush_block_by_range_type_info);
+}
+
+FlushBlockPolicy* FlushBlockByRangePolicyFactory::NewFlushBlockPolicy(
+    const BlockBasedTableOptions& table_options,
+    const BlockBuilder& data_block_builder) const {
+  // Parse "start:end[,start:end]*"; malformed entries are dropped.
+  std::vector<std::pair<std::string, std::string>> ranges;
+  size_t pos = 0;
+  while (pos <= options_.hot_ranges.size()) {
+    size_t end = options_.hot_ranges.find(',', pos);
+    if (end == std::string::npos) {
+      end = options_.hot_ranges.size();
+    }
+    std::string pair = options_.hot_ranges.substr(pos, end - pos);
+    size_t sep = pair.find(':');
+    if (sep != std::string::npos) {
+      ranges.emplace_back(pair.substr(0, sep), pair.substr(sep + 1));
+    }
+    pos = end + 1;
+  }
+  return new FlushBlockByRangePolicy(
+      std::move(ranges), options_.hot_block_size, table_options.block_size,
+      table_options.block_size_deviation, table_options.block_align,
+      data_block_builder);
+}
+
+static std::unordered_map<std::string, OptionTypeInfo>
+    flush_block_by_value_size_type_info = {
+        {"large_value_threshold",
+         {offsetof(struct FlushBlockByValueSizeOptions, large_value_threshold),
+          OptionType::kUInt64T, OptionVerificationType::kNormal,
+          OptionTypeFlags::kNone}},
+};
+
+FlushBlockByValueSizePolicyFactory::FlushBlockByValueSizePolicyFactory()
+    : FlushBlockPolicyFactory() {
+  RegisterOptions(&options_, &flush_block_by_value_size_type_info);
+}
+
+FlushBlockPolicy* FlushBlockByValueSizePolicyFactory::NewFlushBlockPolicy(
+    const BlockBasedTableOptions& table_options,
+    const BlockBuilder& data_block_builder) const {
+  return new FlushBlockByValueSizePolicy(
+      options_.large_value_threshold, table_options.block_size,
+      table_options.block_size_deviation, table_options.block_align,
+      data_block_builder);
+}
+
 FlushBlockPolicy* FlushBlockBySizePolicyFactory::NewFlushBlockPolicy(
     const BlockBasedTableOptions& table_options,
     const BlockBuilder& data_block_builder) const {
@@ -107,7 +258,23 @@ static int RegisterFlushBlockPolicyFactories(ObjectLibrary& library,
         guard->reset(new FlushBlockEveryKeyPolicyFactory());
         return guard->get();
       });
-  return 2;
+  library.AddFactory<FlushBlockPolicyFactory>(
+      FlushBlockByRangePolicyFactory::kClassName(),
+      [](const std::string& /*uri*/,
+         std::unique_ptr<FlushBlockPolicyFactory>* guard,
+         std::string* /* errmsg */) {
+        guard->reset(new FlushBlockByRangePolicyFactory());
+        return guard->get();
+      });
+  library.AddFactory<FlushBlockPolicyFactory>(
+      FlushBlockByValueSizePolicyFactory::kClassName(),
+      [](const std::string& /*uri*/,
+         std::unique_ptr<FlushBlockPolicyFactory>* guard,
+         std::string* /* errmsg */) {
+        guard->reset(new FlushBlockByValueSizePolicyFactory());
+        return guard->get();
+      });
+  return 4;
 }
 
 FlushBlockBySizePolicyFactory::FlushBlockBySizePolicyFactory()
@@ -126,7 +126,16 @@ bool FullFilterBlockReader::MayMatch(const Slice& entry,
       filter_block.GetValue()->filter_bits_reader();
 
   if (filter_bits_reader) {
-    if (filter_bits_reader->MayMatch(entry)) {
+    bool may_match;
+    if (get_context != nullptr && filter_bits_reader->HashMayMatchSupported()) {
+      // A point lookup probes the filter of every overlapping file with the
+      // same entry; hash it once per lookup and share the hash across files.
+      may_match =
+          filter_bits_reader->HashMayMatch(get_context->FilterEntryHash(entry));
+    } else {
+      may_match = filter_bits_reader->MayMatch(entry);
+    }
+    if (may_match) {
       PERF_COUNTER_ADD(bloom_sst_hit_count, 1);
       return true;
     } else {
@@ -199,19 +208,23 @@ void FullFilterBlockReader::MayMatch(MultiGetRange* range,
   filter_bits_reader->MayMatch(num_keys, keys.data(), may_match.data());
 
   int i = 0;
+  int num_misses = 0;
   for (auto iter = filter_range.begin(); iter != filter_range.end(); ++iter) {
     if (!may_match[i]) {
       // Update original MultiGet range to skip this key. The filter_range
       // was temporarily used just to skip keys not in prefix_extractor domain
       range->SkipKey(iter);
-      PERF_COUNTER_ADD(bloom_sst_miss_count, 1);
-    } else {
-      // PERF_COUNTER_ADD(bloom_sst_hit_count, 1);
-      PerfContext* perf_ctx = get_perf_context();
-      perf_ctx->bloom_sst_hit_count++;
+      ++num_misses;
     }
     ++i;
   }
+  // Update the perf counters once for the whole batch rather than per key.
+  PERF_COUNTER_ADD(bloom_sst_miss_count, num_misses);
+  if (i > num_misses) {
+    // Direct update, bypassing the perf level check, to keep the same
+    // behavior as the per-key path had.
+    get_perf_context()->bloom_sst_hit_count += i - num_misses;
+  }
 }
 
 size_t FullFilterBlockReader::ApproximateMemoryUsage() const {
@@ -13,6 +13,7 @@
 #include "table/block_based/filter_policy_internal.h"
 #include "table/block_based/mock_block_based_table.h"
 #include "table/format.h"
+#include "table/get_context.h"
 #include "test_util/testharness.h"
 #include "test_util/testutil.h"
 #include "util/coding.h"
@@ -323,6 +324,45 @@ TEST_F(FullFilterBlockTest, SingleChunk) {
                                   /*lookup_context=*/nullptr, ReadOptions()));
 }
 
+TEST_F(FullFilterBlockTest, SingleChunkSharedHashLookup) {
+  FullFilterBlockBuilder builder(nullptr, true, GetBuilder());
+  builder.Add("foo");
+  builder.Add("bar");
+  Slice slice;
+  ASSERT_OK(builder.Finish(BlockHandle(), &slice));
+
+  CachableEntry<ParsedFullFilterBlock> block(
+      new ParsedFullFilterBlock(table_options_.filter_policy.get(),
+                                BlockContents(slice)),
+      nullptr /* cache */, nullptr /* cache_handle */, true /* own_value */);
+
+  FullFilterBlockReader reader(table_.get(), std::move(block));
+
+  // With a GetContext, probes share one hash of the entry across calls, the
+  // way Version::Get probes each L0 file's filter with the same user key.
+  // Results must match the plain probe path, including after the probed
+  // entry changes.
+  std::string key_buf = "foo";
+  Slice key(key_buf);
+  PinnableSlice value;
+  GetContext get_context(BytewiseComparator(), nullptr, nullptr, nullptr,
+                         GetContext::kNotFound, key, &value, nullptr, nullptr,
+                         nullptr, true, nullptr, nullptr);
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_TRUE(reader.KeyMayMatch(key,
+                                   /*const_ikey_ptr=*/nullptr, &get_context,
+                                   /*lookup_context=*/nullptr, ReadOptions()));
+  }
+  std::string missing_buf = "missing";
+  Slice missing(missing_buf);
+  ASSERT_TRUE(!reader.KeyMayMatch(missing,
+                                  /*const_ikey_ptr=*/nullptr, &get_context,
+                                  /*lookup_context=*/nullptr, ReadOptions()));
+  ASSERT_TRUE(reader.KeyMayMatch(key,
+                                 /*const_ikey_ptr=*/nullptr, &get_context,
+                                 /*lookup_context=*/nullptr, ReadOptions()));
+}
+
 }  // namespace ROCKSDB_NAMESPACE
 
 int main(int argc, char** argv) {
@@ -73,21 +73,96 @@ IndexBuilder* IndexBuilder::CreateIndexBuilder(
   return result;
 }
 
+namespace {
+
+// Specialization of BytewiseComparator()'s FindShortestSeparator() that
+// decides up front whether shortening applies, so the common "cannot
+// shorten" outcome copies nothing and a shortened separator copies only the
+// shared prefix instead of the whole start key. Returns true and fills
+// *scratch with a user key that is physically no longer than user_start but
+// logically larger, and smaller than user_limit; returns false when the
+// general algorithm would leave user_start unchanged.
+bool BytewiseFindShortestUserKeySeparator(const Slice& user_start,
+                                          const Slice& user_limit,
+                                          std::string* scratch) {
+  const size_t min_length = std::min(user_start.size(), user_limit.size());
+  size_t diff_index = 0;
+  while (diff_index < min_length &&
+         user_start[diff_index] == user_limit[diff_index]) {
+    diff_index++;
+  }
+  if (diff_index >= min_length) {
+    // Do not shorten if one string is a prefix of the other
+    return false;
+  }
+  const uint8_t start_byte = static_cast<uint8_t>(user_start[diff_index]);
+  const uint8_t limit_byte = static_cast<uint8_t>(user_limit[diff_index]);
+  if (start_byte >= limit_byte) {
+    // Cannot shorten since limit is smaller than start or start is
+    // already the shortest possible.
+    return false;
+  }
+  if (diff_index < user_limit.size() - 1 || start_byte + 1 < limit_byte) {
+    scratch->assign(user_start.data(), diff_index + 1);
+    (*scratch)[diff_index] = static_cast<char>(start_byte + 1);
+    return true;
+  }
+  // Incrementing the diverging byte would reach the limit; skip it and
+  // increment the first non-0xFF byte of start after it instead.
+  for (diff_index++; diff_index < user_start.size(); diff_index++) {
+    if (static_cast<uint8_t>(user_start[diff_index]) <
+        static_cast<uint8_t>(0xff)) {
+      scratch->assign(user_start.data(), diff_index + 1);
+      (*scratch)[diff_index]++;
+      return true;
+    }
+  }
+  return false;
+}
+
+// The analogous specialization of FindShortSuccessor().
+bool BytewiseFindShortUserKeySuccessor(const Slice& user_key,
+                                       std::string* scratch) {
+  // Find first character that can be incremented
+  for (size_t i = 0; i < user_key.size(); i++) {
+    if (static_cast<uint8_t>(user_key[i]) != static_cast<uint8_t>(0xff)) {
+      scratch->assign(user_key.data(), i + 1);
+      (*scratch)[i]++;
+      return true;
+    }
+  }
+  // user_key is a run of 0xffs.  Leave it alone.
+  return false;
+}
+
+}  // namespace
+
 Slice ShortenedIndexBuilder::FindShortestInternalKeySeparator(
     const Comparator& comparator, const Slice& start, const Slice& limit,
     std::string* scratch) {
   // Attempt to shorten the user portion of the key
   Slice user_start = ExtractUserKey(start);
   Slice user_limit = ExtractUserKey(limit);
-  scratch->assign(user_start.data(), user_start.size());
-  comparator.FindShortestSeparator(scratch, user_limit);
-  assert(comparator.Compare(user_start, *scratch) <= 0);
-  assert(comparator.Compare(user_start, user_limit) >= 0 ||
-         comparator.Compare(*scratch, user_limit) < 0);
-  if (scratch->size() <= user_start.size() &&
-      comparator.Compare(user_start, *scratch) < 0) {
+  bool shortened;
+  if (&comparator == BytewiseComparator()) {
+    // Skip the virtual dispatch and the copy of the full start key.
+    shortened =
+        BytewiseFindShortestUserKeySeparator(user_start, user_limit, scratch);
+  } else {
+    scratch->assign(user_start.data(), user_start.size());
+    comparator.FindShortestSeparator(scratch, user_limit);
+    assert(comparator.Compare(user_start, *scratch) <= 0);
+    assert(comparator.Compare(user_start, user_limit) >= 0 ||
+           comparator.Compare(*scratch, user_limit) < 0);
+    shortened = scratch->size() <= user_start.size() &&
+                comparator.Compare(user_start, *scratch) < 0;
+  }
+  if (shortened) {
     // User key has become shorter physically, but larger logically.
     // Tack on the earliest possible number to the shortened user key.
+    assert(comparator.Compare(user_start, *scratch) < 0);
+    assert(comparator.Compare(user_start, user_limit) >= 0 ||
+           comparator.Compare(*scratch, user_limit) < 0);
     PutFixed64(scratch,
                PackSequenceAndType(kMaxSequenceNumber, kValueTypeForSeek));
     assert(InternalKeyComparator(&comparator).Compare(start, *scratch) < 0);
@@ -101,13 +176,20 @@ Slice ShortenedIndexBuilder::FindShortestInternalKeySeparator(
 Slice ShortenedIndexBuilder::FindShortInternalKeySuccessor(
     const Comparator& comparator, const Slice& key, std::string* scratch) {
   Slice user_key = ExtractUserKey(key);
-  scratch->assign(user_key.data(), user_key.size());
-  comparator.FindShortSuccessor(scratch);
-  assert(comparator.Compare(user_key, *scratch) <= 0);
-  if (scratch->size() <= user_key.size() &&
-      comparator.Compare(user_key, *scratch) < 0) {
+  bool shortened;
+  if (&comparator == BytewiseComparator()) {
+    shortened = BytewiseFindShortUserKeySuccessor(user_key, scratch);
+  } else {
+    scratch->assign(user_key.data(), user_key.size());
+    comparator.FindShortSuccessor(scratch);
+    assert(comparator.Compare(user_key, *scratch) <= 0);
+    shortened = scratch->size() <= user_key.size() &&
+                comparator.Compare(user_key, *scratch) < 0;
+  }
+  if (shortened) {
     // User key has become shorter physically, but larger logically.
     // Tack on the earliest possible number to the shortened user key.
+    assert(comparator.Compare(user_key, *scratch) < 0);
     PutFixed64(scratch,
                PackSequenceAndType(kMaxSequenceNumber, kValueTypeForSeek));
     assert(InternalKeyComparator(&comparator).Compare(key, *scratch) < 0);
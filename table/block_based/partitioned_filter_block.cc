@@ -28,12 +28,14 @@ PartitionedFilterBlockBuilder::PartitionedFilterBlockBuilder(
     PartitionedIndexBuilder* const p_index_builder,
     const uint32_t partition_size, size_t ts_sz,
     const bool persist_user_defined_timestamps,
-    bool decouple_from_index_partitions)
+    bool decouple_from_index_partitions,
+    FilterBitsBuilder* top_level_prefix_bits_builder)
     : FullFilterBlockBuilder(_prefix_extractor, whole_key_filtering,
                              filter_bits_builder),
       p_index_builder_(p_index_builder),
       ts_sz_(ts_sz),
       decouple_from_index_partitions_(decouple_from_index_partitions),
+      top_level_prefix_bits_builder_(top_level_prefix_bits_builder),
       index_on_filter_block_builder_(
           index_block_restart_interval, true /*use_delta_encoding*/,
           use_value_delta_encoding,
@@ -186,6 +188,10 @@ void PartitionedFilterBlockBuilder::AddImpl(const Slice& key_without_ts,
   bool cut = DecideCutAFilterBlock();
   if (prefix_extractor() && prefix_extractor()->InDomain(key_without_ts)) {
     Slice prefix = prefix_extractor()->Transform(key_without_ts);
+    if (top_level_prefix_bits_builder_) {
+      // Duplicate adds are deduplicated by the bits builder.
+      top_level_prefix_bits_builder_->AddKey(prefix);
+    }
     if (cut) {
       CutAFilterBlock(&key_without_ts, &prefix, prev_key_without_ts);
     }
@@ -292,6 +298,24 @@ Status PartitionedFilterBlockBuilder::Finish(
   return s;
 }
 
+Status PartitionedFilterBlockBuilder::FinishTopLevelPrefixBloom(
+    Slice* filter, std::unique_ptr<const char[]>* filter_owner) {
+  if (top_level_prefix_bits_builder_ == nullptr ||
+      top_level_prefix_bits_builder_->EstimateEntriesAdded() == 0) {
+    *filter = Slice();
+    return Status::OK();
+  }
+  Status s = Status::OK();
+  *filter = top_level_prefix_bits_builder_->Finish(filter_owner, &s);
+  if (s.ok()) {
+    s = top_level_prefix_bits_builder_->MaybePostVerify(*filter);
+  }
+  if (!s.ok()) {
+    *filter = Slice();
+  }
+  return s;
+}
+
 PartitionedFilterBlockReader::PartitionedFilterBlockReader(
     const BlockBasedTable* t,
     CachableEntry<Block_kFilterPartitionIndex>&& filter_block)
@@ -353,6 +377,14 @@ bool PartitionedFilterBlockReader::PrefixMayMatch(
     GetContext* get_context, BlockCacheLookupContext* lookup_context,
     const ReadOptions& read_options) {
   assert(const_ikey_ptr != nullptr);
+  // Whole-file prefix bloom, if present, can rule out the prefix without
+  // touching any filter partition or the block cache.
+  FilterBitsReader* const top_level_prefix_filter =
+      table()->get_rep()->top_level_prefix_filter.get();
+  if (top_level_prefix_filter != nullptr &&
+      !top_level_prefix_filter->MayMatch(prefix)) {
+    return false;
+  }
   return MayMatch(prefix, const_ikey_ptr, get_context, lookup_context,
                   read_options, &FullFilterBlockReader::PrefixMayMatch);
 }
@@ -601,6 +633,12 @@ Status PartitionedFilterBlockReader::CacheDependencies(
       return s;
     }
   }
+  if (pin) {
+    // The partition index is normally built with restart interval 1, so its
+    // restart count is a good estimate of the number of partitions. Sizing
+    // the map up front avoids rehashing it while partitions are being read.
+    filter_map_.reserve(filter_block.GetValue()->NumRestarts());
+  }
   // After prefetch, read the partitions one by one
   for (biter.SeekToFirst(); biter.Valid(); biter.Next()) {
     handle = biter.value().handle;
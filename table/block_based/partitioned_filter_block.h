@@ -33,7 +33,8 @@ class PartitionedFilterBlockBuilder : public FullFilterBlockBuilder {
       PartitionedIndexBuilder* const p_index_builder,
       const uint32_t partition_size, size_t ts_sz,
       const bool persist_user_defined_timestamps,
-      bool decouple_from_index_partitions);
+      bool decouple_from_index_partitions,
+      FilterBitsBuilder* top_level_prefix_bits_builder = nullptr);
 
   virtual ~PartitionedFilterBlockBuilder();
 
@@ -67,6 +68,9 @@ class PartitionedFilterBlockBuilder : public FullFilterBlockBuilder {
     return Status::OK();
   }
 
+  Status FinishTopLevelPrefixBloom(
+      Slice* filter, std::unique_ptr<const char[]>* filter_owner) override;
+
  private:  // fns
   // Whether to cut a filter block before the next key
   bool DecideCutAFilterBlock();
@@ -104,6 +108,11 @@ class PartitionedFilterBlockBuilder : public FullFilterBlockBuilder {
   // then the whole partitioned filters should not be used.
   Status partitioned_filters_construction_status_;
 
+  // When non-null, every added prefix also goes into this builder, which
+  // produces one unpartitioned bloom over all prefixes in the file. See
+  // BlockBasedTableOptions::partition_filter_top_level_prefix_bloom.
+  std::unique_ptr<FilterBitsBuilder> top_level_prefix_bits_builder_;
+
   // For Add without prev key
   std::string prev_key_without_ts_;
 
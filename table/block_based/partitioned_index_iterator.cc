@@ -16,10 +16,42 @@ void PartitionedIndexIterator::SeekToFirst() { SeekImpl(nullptr); }
 void PartitionedIndexIterator::SeekImpl(const Slice* target) {
   SavePrevIndexValue();
 
-  if (target) {
-    index_iter_->Seek(*target);
-  } else {
-    index_iter_->SeekToFirst();
+  bool need_seek_index = true;
+  if (target && block_iter_points_to_real_block_ && block_iter_.Valid()) {
+    // The same reseek shortcut BlockBasedTableIterator uses for data
+    // blocks, applied at the partition level: sorted seek sequences (e.g.
+    // a merge join seeking in key order) usually land in the current or
+    // the next partition, so check those before re-binary-searching the
+    // top-level index. User keys are compared with equality excluded,
+    // since entries with the same user key may span partitions.
+    if (user_comparator_.Compare(ExtractUserKey(*target),
+                                 block_iter_.user_key()) > 0 &&
+        user_comparator_.Compare(ExtractUserKey(*target),
+                                 index_iter_->user_key()) < 0) {
+      // Above the partition's current position and below its separator:
+      // the target is within the current partition.
+      need_seek_index = false;
+    } else if (user_comparator_.Compare(ExtractUserKey(*target),
+                                        index_iter_->user_key()) > 0) {
+      // Past the current partition; probe the adjacent one before falling
+      // back to a full top-level seek.
+      index_iter_->Next();
+      if (index_iter_->Valid() &&
+          user_comparator_.Compare(ExtractUserKey(*target),
+                                   index_iter_->user_key()) < 0) {
+        need_seek_index = false;
+      }
+      // Otherwise the target is beyond the adjacent partition (or past the
+      // last one); the full seek below repositions index_iter_.
+    }
+  }
+
+  if (need_seek_index) {
+    if (target) {
+      index_iter_->Seek(*target);
+    } else {
+      index_iter_->SeekToFirst();
+    }
   }
 
   if (!index_iter_->Valid()) {
@@ -178,6 +178,12 @@ Status PartitionIndexReader::CacheDependencies(
   }
   // For saving "all or nothing" to partition_map_
   UnorderedMap<uint64_t, CachableEntry<Block>> map_in_progress;
+  if (pin) {
+    // The top-level index is normally built with restart interval 1, so its
+    // restart count is a good estimate of the number of partitions. Sizing
+    // the map up front avoids rehashing it while partitions are being read.
+    map_in_progress.reserve(index_block.GetValue()->NumRestarts());
+  }
 
   // After prefetch, read the partitions one by one
   biter.SeekToFirst();
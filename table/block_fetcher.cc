@@ -16,6 +16,7 @@
 #include "logging/logging.h"
 #include "memory/memory_allocator_impl.h"
 #include "monitoring/perf_context_imp.h"
+#include "monitoring/query_timeline_imp.h"
 #include "rocksdb/compression_type.h"
 #include "rocksdb/env.h"
 #include "table/block_based/block.h"
@@ -240,6 +241,12 @@ inline void BlockFetcher::GetBlockContents() {
 #endif
 }
 
+bool BlockFetcher::DeadlineExpired() const {
+  return read_options_.deadline.count() &&
+         ioptions_.clock->NowMicros() >
+             static_cast<uint64_t>(read_options_.deadline.count());
+}
+
 // Read a block from the file and verify its checksum. Upon return, io_status_
 // will be updated with the status of the read, and slice_ will be updated
 // with a pointer to the data.
@@ -384,8 +391,13 @@ IOStatus BlockFetcher::ReadBlockContents() {
       return io_status_;
     }
   }
+  QUERY_TIMELINE_MARK(kBlockRead);
 
   if (do_uncompress_ && compression_type_ != kNoCompression) {
+    if (DeadlineExpired()) {
+      io_status_ = IOStatus::TimedOut();
+      return io_status_;
+    }
     PERF_TIMER_GUARD(block_decompress_time);
     // compressed page, uncompress, update cache
     UncompressionContext context(compression_type_);
@@ -398,6 +410,7 @@ IOStatus BlockFetcher::ReadBlockContents() {
 #endif
     // Save the compressed block without trailer
     slice_ = Slice(slice_.data(), block_size_);
+    QUERY_TIMELINE_MARK(kBlockDecompress);
   } else {
     GetBlockContents();
     slice_ = Slice();
@@ -443,6 +456,10 @@ IOStatus BlockFetcher::ReadAsyncBlockContents() {
         used_buf_ = const_cast<char*>(slice_.data());
 
         if (do_uncompress_ && compression_type_ != kNoCompression) {
+          if (DeadlineExpired()) {
+            io_status_ = IOStatus::TimedOut();
+            return io_status_;
+          }
           PERF_TIMER_GUARD(block_decompress_time);
           // compressed page, uncompress, update cache
           UncompressionContext context(compression_type_);
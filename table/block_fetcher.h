@@ -152,6 +152,10 @@ class BlockFetcher {
   void GetBlockContents();
   void InsertCompressedBlockToPersistentCacheIfNeeded();
   void InsertUncompressedBlockToPersistentCacheIfNeeded();
+  // Returns true iff read_options_.deadline is set and has already passed.
+  // Checked before decompressing a block, since decompression of a large
+  // block has no abort point and can blow a tight deadline budget.
+  bool DeadlineExpired() const;
   void ProcessTrailerIfPresent();
   void ReadBlock(bool retry);
 
@@ -154,16 +154,30 @@ Status CuckooTableReader::Get(const ReadOptions& /*readOptions*/,
                               bool /*skip_filters*/) {
   assert(key.size() == key_length_ + (is_last_level_ ? 8 : 0));
   Slice user_key = ExtractUserKey(key);
+  const Slice unused_key_prefix(unused_key_.data(), user_key.size());
   for (uint32_t hash_cnt = 0; hash_cnt < num_hash_func_; ++hash_cnt) {
     uint64_t offset =
         bucket_length_ * CuckooHash(user_key, hash_cnt, use_module_hash_,
                                     table_size_, identity_as_first_hash_,
                                     get_slice_hash_);
     const char* bucket = &file_data_.data()[offset];
+    if (hash_cnt + 1 < num_hash_func_) {
+      // Overlap the memory latency of the next candidate's Cuckoo Block with
+      // the key comparisons in this one.
+      uint64_t next_addr =
+          reinterpret_cast<uint64_t>(file_data_.data()) +
+          bucket_length_ * CuckooHash(user_key, hash_cnt + 1, use_module_hash_,
+                                      table_size_, identity_as_first_hash_,
+                                      get_slice_hash_);
+      uint64_t next_end_addr = next_addr + cuckoo_block_bytes_minus_one_;
+      for (next_addr &= CACHE_LINE_MASK; next_addr < next_end_addr;
+           next_addr += CACHE_LINE_SIZE) {
+        PREFETCH(reinterpret_cast<const char*>(next_addr), 0, 3);
+      }
+    }
     for (uint32_t block_idx = 0; block_idx < cuckoo_block_size_;
          ++block_idx, bucket += bucket_length_) {
-      if (ucomp_->Equal(Slice(unused_key_.data(), user_key.size()),
-                        Slice(bucket, user_key.size()))) {
+      if (ucomp_->Equal(unused_key_prefix, Slice(bucket, user_key.size()))) {
         return Status::OK();
       }
       // Here, we compare only the user key part as we support only one entry
@@ -16,6 +16,7 @@
 #include "rocksdb/merge_operator.h"
 #include "rocksdb/statistics.h"
 #include "rocksdb/system_clock.h"
+#include "util/hash.h"
 
 namespace ROCKSDB_NAMESPACE {
 
@@ -114,6 +115,17 @@ void GetContext::SaveValue(const Slice& value, SequenceNumber /*seq*/) {
   }
 }
 
+uint64_t GetContext::FilterEntryHash(const Slice& entry) {
+  if (!filter_entry_hash_computed_ ||
+      entry.data() != filter_hash_entry_.data() ||
+      entry.size() != filter_hash_entry_.size()) {
+    filter_hash_entry_ = entry;
+    filter_entry_hash_ = GetSliceHash64(entry);
+    filter_entry_hash_computed_ = true;
+  }
+  return filter_entry_hash_;
+}
+
 void GetContext::ReportCounters() {
   if (get_context_stats_.num_cache_hit > 0) {
     RecordTick(statistics_, BLOCK_CACHE_HIT, get_context_stats_.num_cache_hit);
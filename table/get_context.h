@@ -191,6 +191,16 @@ class GetContext {
 
   uint64_t get_tracing_get_id() const { return tracing_get_id_; }
 
+  // Returns the 64-bit hash (GetSliceHash64()) of `entry`, computing it on
+  // the first call and serving the cached value as long as the same entry is
+  // passed. A point lookup probes the filter of every L0 file and every
+  // overlapping level with the same entry (the user key, or its prefix when
+  // only prefix filtering is enabled), so sharing one hash across those
+  // probes avoids rehashing per file. Entries are told apart by data pointer
+  // and size, which is exact here because all probes of a lookup reference
+  // the same key buffer.
+  uint64_t FilterEntryHash(const Slice& entry);
+
   void push_operand(const Slice& value, Cleanable* value_pinner);
 
  private:
@@ -246,6 +256,10 @@ class GetContext {
   // Get or a MultiGet.
   const uint64_t tracing_get_id_;
   BlobFetcher* blob_fetcher_;
+  // See FilterEntryHash().
+  Slice filter_hash_entry_;
+  uint64_t filter_entry_hash_ = 0;
+  bool filter_entry_hash_computed_ = false;
 };
 
 // Call this to replay a log and bring the get_context up to date. The replay
@@ -10,6 +10,7 @@
 #include "table/merging_iterator.h"
 
 #include "db/arena_wrapped_db_iter.h"
+#include "rocksdb/system_clock.h"
 
 namespace ROCKSDB_NAMESPACE {
 // MergingIterator uses a min/max heap to combine data from point iterators.
@@ -101,6 +102,18 @@ class MergingIterator : public InternalIterator {
     range_tombstone_iters_.emplace_back(std::move(iter));
   }
 
+  // Enable cooperative checking of `deadline` (same meaning as
+  // ReadOptions::deadline) in the loops that skip over range-deleted keys.
+  // When the deadline passes, this iterator becomes invalid with a
+  // TimedOut() status instead of continuing to advance.
+  void SetDeadline(SystemClock* clock,
+                   const std::chrono::microseconds& deadline) {
+    if (deadline.count() > 0) {
+      deadline_clock_ = clock;
+      deadline_micros_ = static_cast<uint64_t>(deadline.count());
+    }
+  }
+
   // Called by MergingIteratorBuilder when all point iterators and range
   // tombstone iterators are added. Initializes HeapItems for range tombstone
   // iterators.
@@ -191,7 +204,10 @@ class MergingIterator : public InternalIterator {
       active_.insert(level);
     }
     if (replace_top) {
+      assert(!building_min_heap_);
       minHeap_.replace_top(&pinned_heap_item_[level]);
+    } else if (building_min_heap_) {
+      minHeap_.push_unordered(&pinned_heap_item_[level]);
     } else {
       minHeap_.push(&pinned_heap_item_[level]);
     }
@@ -254,11 +270,26 @@ class MergingIterator : public InternalIterator {
 
   void SeekToFirst() override {
     ClearHeaps();
+    building_min_heap_ = true;
     status_ = Status::OK();
     for (auto& child : children_) {
       child.iter.SeekToFirst();
+      // With async_io, a child may return TryAgain after submitting an
+      // asynchronous read for its first block. Skip it here and complete it
+      // in the second pass below, so that the block reads of all children
+      // are in flight concurrently instead of completing level by level.
+      if (child.iter.status().IsTryAgain()) {
+        continue;
+      }
       AddToMinHeapOrCheckStatus(&child);
     }
+    for (auto& child : children_) {
+      if (child.iter.status().IsTryAgain()) {
+        child.iter.SeekToFirst();
+        AddToMinHeapOrCheckStatus(&child);
+        PERF_COUNTER_ADD(number_async_seek, 1);
+      }
+    }
 
     for (size_t i = 0; i < range_tombstone_iters_.size(); ++i) {
       if (range_tombstone_iters_[i]) {
@@ -269,6 +300,8 @@ class MergingIterator : public InternalIterator {
         }
       }
     }
+    building_min_heap_ = false;
+    minHeap_.restore_heap();
     FindNextVisibleKey();
     direction_ = kForward;
     current_ = CurrentForward();
@@ -656,6 +689,10 @@ class MergingIterator : public InternalIterator {
   // exception is to modify heap top item directly (by caller iter->Next()), and
   // it should be followed by a call to replace_top() or pop().
   MergerMinIterHeap minHeap_;
+  // True while SeekToFirst()/SeekImpl() rebuild minHeap_ from scratch with
+  // push_unordered(). They call restore_heap() before the heap is used, so
+  // the min heap invariant above is suspended only within those calls.
+  bool building_min_heap_ = false;
 
   // Max heap is used for reverse iteration, which is way less common than
   // forward. Lazily initialize it to save memory.
@@ -666,6 +703,33 @@ class MergingIterator : public InternalIterator {
   // take care of boundary checking.
   const Slice* iterate_upper_bound_;
 
+  // For cooperative enforcement of ReadOptions::deadline in
+  // FindNextVisibleKey()/FindPrevVisibleKey(). Deadlines are otherwise only
+  // enforced at I/O boundaries, so an advance that skips over many
+  // tombstone-covered keys could run long past the deadline with no abort
+  // point. nullptr means no deadline checking. See SetDeadline().
+  SystemClock* deadline_clock_ = nullptr;
+  uint64_t deadline_micros_ = 0;
+  uint32_t deadline_check_counter_ = 0;
+  // Only read the clock once every this many skipped keys, to keep the
+  // per-key cost of deadline checking negligible.
+  static constexpr uint32_t kDeadlineCheckInterval = 256;
+
+  // Returns true iff deadline checking is enabled and the deadline has
+  // passed, in which case status_ is set to TimedOut. Cheap when the clock
+  // is not due to be read.
+  bool DeadlineExpired() {
+    if (deadline_clock_ == nullptr ||
+        (++deadline_check_counter_ % kDeadlineCheckInterval) != 0) {
+      return false;
+    }
+    if (deadline_clock_->NowMicros() > deadline_micros_) {
+      considerStatus(Status::TimedOut());
+      return true;
+    }
+    return false;
+  }
+
   // In forward direction, process a child that is not in the min heap.
   // If valid, add to the min heap. Otherwise, check status.
   void AddToMinHeapOrCheckStatus(HeapItem*);
@@ -773,14 +837,16 @@ void MergingIterator::SeekImpl(const Slice& target, size_t starting_level,
                                bool range_tombstone_reseek) {
   // active range tombstones before `starting_level` remain active
   ClearHeaps(false /* clear_active */);
+  // minHeap_ is rebuilt from scratch below and its content is not examined
+  // until then, so insert unordered and heapify once at the end: O(n)
+  // comparisons instead of one upheap per insertion.
+  building_min_heap_ = true;
   ParsedInternalKey pik;
   if (!range_tombstone_iters_.empty()) {
     // pik is only used in InsertRangeTombstoneToMinHeap().
     ParseInternalKey(target, &pik, false).PermitUncheckedError();
   }
 
-  // TODO: perhaps we could save some upheap cost by add all child iters first
-  //  and then do a single heapify.
   // Invariant(children_) for level < starting_level
   for (size_t level = 0; level < starting_level; ++level) {
     PERF_TIMER_GUARD(seek_min_heap_time);
@@ -804,7 +870,7 @@ void MergingIterator::SeekImpl(const Slice& target, size_t starting_level,
                  HeapItem::Type::DELETE_RANGE_END);
           // if it was active, then start key must be within upper_bound,
           // so we can add to minHeap_ directly.
-          minHeap_.push(&pinned_heap_item_[level]);
+          minHeap_.push_unordered(&pinned_heap_item_[level]);
         } else {
           assert(pinned_heap_item_[level].type ==
                  HeapItem::Type::DELETE_RANGE_START);
@@ -922,6 +988,8 @@ void MergingIterator::SeekImpl(const Slice& target, size_t starting_level,
       PERF_COUNTER_ADD(number_async_seek, 1);
     }
   }
+  building_min_heap_ = false;
+  minHeap_.restore_heap();
 }
 
 // Returns true iff the current key (min heap top) should not be returned
@@ -1294,7 +1362,11 @@ void MergingIterator::AddToMinHeapOrCheckStatus(HeapItem* child) {
   // Invariant(children_)
   if (child->iter.Valid()) {
     assert(child->iter.status().ok());
-    minHeap_.push(child);
+    if (building_min_heap_) {
+      minHeap_.push_unordered(child);
+    } else {
+      minHeap_.push(child);
+    }
   } else {
     considerStatus(child->iter.status());
   }
@@ -1631,6 +1703,11 @@ inline void MergingIterator::FindNextVisibleKey() {
       !minHeap_.empty() &&
       (!active_.empty() || minHeap_.top()->iter.IsDeleteRangeSentinelKey()) &&
       SkipNextDeleted()) {
+    if (UNLIKELY(DeadlineExpired())) {
+      // Give up: invalidate this iterator with status_ == TimedOut().
+      ClearHeaps();
+      return;
+    }
     PopDeleteRangeStart();
   }
   // Checks Invariant (1)
@@ -1646,6 +1723,11 @@ inline void MergingIterator::FindPrevVisibleKey() {
       !maxHeap_->empty() &&
       (!active_.empty() || maxHeap_->top()->iter.IsDeleteRangeSentinelKey()) &&
       SkipPrevDeleted()) {
+    if (UNLIKELY(DeadlineExpired())) {
+      // Give up: invalidate this iterator with status_ == TimedOut().
+      ClearHeaps();
+      return;
+    }
     PopDeleteRangeEnd();
   }
 }
@@ -1686,6 +1768,11 @@ MergeIteratorBuilder::~MergeIteratorBuilder() {
   }
 }
 
+void MergeIteratorBuilder::SetDeadline(
+    SystemClock* clock, const std::chrono::microseconds& deadline) {
+  merge_iter->SetDeadline(clock, deadline);
+}
+
 void MergeIteratorBuilder::AddIterator(InternalIterator* iter) {
   if (!use_merging_iter && first_iter != nullptr) {
     merge_iter->AddIterator(first_iter);
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <chrono>
+
 #include "db/range_del_aggregator.h"
 #include "rocksdb/slice.h"
 #include "rocksdb/types.h"
@@ -19,6 +21,7 @@ namespace ROCKSDB_NAMESPACE {
 class Arena;
 class ArenaWrappedDBIter;
 class InternalKeyComparator;
+class SystemClock;
 
 template <class TValue>
 class InternalIteratorBase;
@@ -79,6 +82,12 @@ class MergeIteratorBuilder {
   // iterator needs to be allocated.
   Arena* GetArena() { return arena; }
 
+  // Enable cooperative checking of ReadOptions::deadline in the merging
+  // iterator's skip loops (see MergingIterator::SetDeadline()). No-op if the
+  // builder ends up returning a single child iterator directly.
+  void SetDeadline(SystemClock* clock,
+                   const std::chrono::microseconds& deadline);
+
   // Return the result merging iterator.
   // If db_iter is not nullptr, then db_iter->SetMemtableRangetombstoneIter()
   // will be called with pointer to where the merging iterator
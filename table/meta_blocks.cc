@@ -97,6 +97,7 @@ void PropertyBlockBuilder::AddTableProperty(const TableProperties& props) {
   Add(TablePropertiesNames::kNumFilterEntries, props.num_filter_entries);
   Add(TablePropertiesNames::kDeletedKeys, props.num_deletions);
   Add(TablePropertiesNames::kMergeOperands, props.num_merge_operands);
+  Add(TablePropertiesNames::kKeyOverwrites, props.num_key_overwrites);
   Add(TablePropertiesNames::kNumRangeDeletions, props.num_range_deletions);
   Add(TablePropertiesNames::kNumDataBlocks, props.num_data_blocks);
   Add(TablePropertiesNames::kFilterSize, props.filter_size);
@@ -357,6 +358,8 @@ Status ReadTablePropertiesHelper(
          &new_table_properties->num_deletions},
         {TablePropertiesNames::kMergeOperands,
          &new_table_properties->num_merge_operands},
+        {TablePropertiesNames::kKeyOverwrites,
+         &new_table_properties->num_key_overwrites},
         {TablePropertiesNames::kNumRangeDeletions,
          &new_table_properties->num_range_deletions},
         {TablePropertiesNames::kFormatVersion,
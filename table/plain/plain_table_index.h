@@ -11,6 +11,7 @@
 #include "memory/arena.h"
 #include "monitoring/histogram.h"
 #include "options/cf_options.h"
+#include "port/port.h"
 #include "rocksdb/options.h"
 
 namespace ROCKSDB_NAMESPACE {
@@ -83,6 +84,15 @@ class PlainTableIndex {
   IndexSearchResult GetOffset(uint32_t prefix_hash,
                               uint32_t* bucket_value) const;
 
+  // Prefetch the hash bucket for `prefix_hash` into CPU cache. Useful for
+  // overlapping the bucket cache misses of a batch of lookups.
+  void PrefetchBucket(uint32_t prefix_hash) const {
+    if (index_size_ > 0) {
+      PREFETCH(&index_[prefix_hash % index_size_], 0 /* rw */,
+               3 /* locality */);
+    }
+  }
+
   // Initialize data from `index_data`, which points to raw data for
   // index stored in the SST file.
   Status InitFromRawData(Slice index_data);
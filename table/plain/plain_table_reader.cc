@@ -628,6 +628,33 @@ Status PlainTableReader::Get(const ReadOptions& /*ro*/, const Slice& target,
   return Status::OK();
 }
 
+void PlainTableReader::MultiGet(const ReadOptions& readOptions,
+                                const MultiGetContext::Range* mget_range,
+                                const SliceTransform* prefix_extractor,
+                                bool skip_filters) {
+  // First pass: warm up the bloom filter and hash index buckets for the
+  // whole batch, so the cache misses of the individual lookups overlap
+  // instead of being paid one after another.
+  for (auto iter = mget_range->begin(); iter != mget_range->end(); ++iter) {
+    const Slice& target = iter->ikey;
+    if (IsTotalOrderMode()) {
+      if (enable_bloom_) {
+        bloom_.Prefetch(GetSliceHash(ExtractUserKey(target)));
+      }
+    } else {
+      const uint32_t prefix_hash = GetSliceHash(GetPrefix(target));
+      if (enable_bloom_) {
+        bloom_.Prefetch(prefix_hash);
+      }
+      index_.PrefetchBucket(prefix_hash);
+    }
+  }
+  for (auto iter = mget_range->begin(); iter != mget_range->end(); ++iter) {
+    *iter->s = Get(readOptions, iter->ikey, iter->get_context,
+                   prefix_extractor, skip_filters);
+  }
+}
+
 uint64_t PlainTableReader::ApproximateOffsetOf(
     const ReadOptions& /*read_options*/, const Slice& /*key*/,
     TableReaderCaller /*caller*/) {
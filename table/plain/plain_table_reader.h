@@ -92,6 +92,11 @@ class PlainTableReader : public TableReader {
              GetContext* get_context, const SliceTransform* prefix_extractor,
              bool skip_filters = false) override;
 
+  void MultiGet(const ReadOptions& readOptions,
+                const MultiGetContext::Range* mget_range,
+                const SliceTransform* prefix_extractor,
+                bool skip_filters = false) override;
+
   uint64_t ApproximateOffsetOf(const ReadOptions& read_options,
                                const Slice& key,
                                TableReaderCaller caller) override;
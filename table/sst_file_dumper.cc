@@ -6,6 +6,7 @@
 
 #include "table/sst_file_dumper.h"
 
+#include <atomic>
 #include <chrono>
 #include <cinttypes>
 #include <iostream>
@@ -19,6 +20,8 @@
 #include "db/wide/wide_column_serialization.h"
 #include "db/wide/wide_columns_helper.h"
 #include "db/write_batch_internal.h"
+#include "logging/event_logger.h"
+#include "monitoring/histogram.h"
 #include "options/cf_options.h"
 #include "port/port.h"
 #include "rocksdb/db.h"
@@ -31,11 +34,13 @@
 #include "table/block_based/block.h"
 #include "table/block_based/block_based_table_builder.h"
 #include "table/block_based/block_based_table_factory.h"
+#include "table/block_based/block_based_table_reader.h"
 #include "table/block_based/block_builder.h"
 #include "table/format.h"
 #include "table/meta_blocks.h"
 #include "table/plain/plain_table_factory.h"
 #include "table/table_reader.h"
+#include "util/cast_util.h"
 #include "util/compression.h"
 #include "util/random.h"
 #include "util/udt_util.h"
@@ -221,6 +226,122 @@ Status SstFileDumper::DumpTable(const std::string& out_filename) {
   return out_file->Close();
 }
 
+Status SstFileDumper::AnalyzeBlocks(size_t num_threads, std::string* result) {
+  assert(result);
+  if (!table_reader_) {
+    return init_result_;
+  }
+  if (!options_.table_factory->IsInstanceOf(
+          TableFactory::kBlockBasedTableName())) {
+    return Status::NotSupported(
+        "analyze is only supported for block-based table files");
+  }
+  auto* table = static_cast_with_check<BlockBasedTable>(table_reader_.get());
+
+  std::vector<BlockHandle> handles;
+  Status s = table->GetDataBlockHandles(read_options_, &handles);
+  if (!s.ok()) {
+    return s;
+  }
+
+  if (num_threads == 0) {
+    num_threads = 1;
+  }
+  if (!handles.empty() && num_threads > handles.size()) {
+    num_threads = handles.size();
+  }
+
+  std::vector<BlockBasedTable::DataBlockStats> block_stats(handles.size());
+  std::vector<Status> worker_status(num_threads);
+  std::atomic<size_t> next_block{0};
+  // Workers pull the next unprocessed block from a shared counter so that
+  // unevenly sized blocks do not leave some workers idle.
+  auto decode_blocks = [&](size_t worker) {
+    size_t i;
+    while ((i = next_block.fetch_add(1, std::memory_order_relaxed)) <
+           handles.size()) {
+      Status block_status = table->AnalyzeDataBlock(
+          read_options_, handles[i], moptions_.prefix_extractor.get(),
+          &block_stats[i]);
+      if (!block_status.ok()) {
+        worker_status[worker] = block_status;
+        return;
+      }
+    }
+  };
+  std::vector<port::Thread> workers;
+  for (size_t t = 1; t < num_threads; ++t) {
+    workers.emplace_back(decode_blocks, t);
+  }
+  decode_blocks(0);
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  for (const auto& ws : worker_status) {
+    if (!ws.ok()) {
+      return ws;
+    }
+  }
+
+  uint64_t total_compressed = 0;
+  uint64_t total_uncompressed = 0;
+  uint64_t total_entries = 0;
+  uint64_t total_point_deletions = 0;
+  HistogramImpl entries_per_block;
+  // Compressed size as a percentage of uncompressed size, per block.
+  HistogramImpl compressed_pct_per_block;
+  HistogramImpl entries_per_restart;
+  HistogramImpl distinct_prefixes_per_block;
+  for (const auto& bs : block_stats) {
+    total_compressed += bs.compressed_size;
+    total_uncompressed += bs.uncompressed_size;
+    total_entries += bs.num_entries;
+    total_point_deletions += bs.num_point_deletions;
+    entries_per_block.Add(bs.num_entries);
+    if (bs.uncompressed_size > 0) {
+      compressed_pct_per_block.Add(bs.compressed_size * 100 /
+                                   bs.uncompressed_size);
+    }
+    if (bs.num_restarts > 0) {
+      entries_per_restart.Add(bs.num_entries / bs.num_restarts);
+    }
+    distinct_prefixes_per_block.Add(bs.num_distinct_prefixes);
+  }
+
+  JSONWriter jw;
+  jw << "file" << file_name_;
+  jw << "num_data_blocks" << handles.size();
+  jw << "total_compressed_bytes" << total_compressed;
+  jw << "total_uncompressed_bytes" << total_uncompressed;
+  jw << "compression_ratio"
+     << (total_compressed > 0
+             ? static_cast<double>(total_uncompressed) / total_compressed
+             : 0.0);
+  jw << "num_entries" << total_entries;
+  jw << "num_point_deletions" << total_point_deletions;
+  jw << "tombstone_density"
+     << (total_entries > 0
+             ? static_cast<double>(total_point_deletions) / total_entries
+             : 0.0);
+  if (table_properties_) {
+    jw << "num_range_deletions" << table_properties_->num_range_deletions;
+  }
+  auto add_distribution = [&](const std::string& key, const HistogramImpl& h) {
+    jw.AddKey(key);
+    jw.StartObject();
+    jw << "min" << h.min() << "max" << h.max() << "avg" << h.Average() << "p50"
+       << h.Percentile(50) << "p99" << h.Percentile(99);
+    jw.EndObject();
+  };
+  add_distribution("entries_per_block", entries_per_block);
+  add_distribution("compressed_pct_per_block", compressed_pct_per_block);
+  add_distribution("entries_per_restart", entries_per_restart);
+  add_distribution("distinct_prefixes_per_block", distinct_prefixes_per_block);
+  jw.EndObject();
+  *result = jw.Get();
+  return Status::OK();
+}
+
 Status SstFileDumper::CalculateCompressedTableSize(
     const TableBuilderOptions& tb_options, size_t block_size,
     uint64_t* num_data_blocks, uint64_t* compressed_table_size) {
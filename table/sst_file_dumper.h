@@ -42,6 +42,13 @@ class SstFileDumper {
   Status DumpTable(const std::string& out_filename);
   Status getStatus() { return init_result_; }
 
+  // Decodes every data block, spreading the work across `num_threads`
+  // workers, and fills `result` with a JSON summary of per-block statistics:
+  // compression ratio, entries per block, restart-interval efficiency,
+  // key-prefix cardinality and tombstone density. Only supported for
+  // block-based table files.
+  Status AnalyzeBlocks(size_t num_threads, std::string* result);
+
   Status ShowAllCompressionSizes(
       size_t block_size,
       const std::vector<std::pair<CompressionType, const char*>>&
@@ -120,7 +120,8 @@ struct SstFileWriter::Rep {
     file_info.largest_key.assign(user_key.data(), user_key.size());
     file_info.file_size = builder->FileSize();
 
-    InvalidatePageCache(false /* closing */).PermitUncheckedError();
+    InvalidatePageCache(false /* closing */, file_info.file_size)
+        .PermitUncheckedError();
     return builder->status();
   }
 
@@ -234,7 +235,8 @@ struct SstFileWriter::Rep {
     file_info.num_range_del_entries++;
     file_info.file_size = builder->FileSize();
 
-    InvalidatePageCache(false /* closing */).PermitUncheckedError();
+    InvalidatePageCache(false /* closing */, file_info.file_size)
+        .PermitUncheckedError();
     return Status::OK();
   }
 
@@ -277,13 +279,16 @@ struct SstFileWriter::Rep {
     return DeleteRangeImpl(begin_key_with_ts, end_key_with_ts);
   }
 
-  Status InvalidatePageCache(bool closing) {
+  // `file_size` is the builder's current file size, which all callers have
+  // already fetched to update file_info; taking it as a parameter avoids
+  // re-querying the builder on every Add().
+  Status InvalidatePageCache(bool closing, uint64_t file_size) {
     Status s = Status::OK();
     if (invalidate_page_cache == false) {
       // Fadvise disabled
       return s;
     }
-    uint64_t bytes_since_last_fadvise = builder->FileSize() - last_fadvise_size;
+    uint64_t bytes_since_last_fadvise = file_size - last_fadvise_size;
     if (bytes_since_last_fadvise > kFadviseTrigger || closing) {
       TEST_SYNC_POINT_CALLBACK("SstFileWriter::Rep::InvalidatePageCache",
                                &(bytes_since_last_fadvise));
@@ -294,7 +299,7 @@ struct SstFileWriter::Rep {
         // cache.
         s = Status::OK();
       }
-      last_fadvise_size = builder->FileSize();
+      last_fadvise_size = file_size;
     }
     return s;
   }
@@ -484,7 +489,8 @@ Status SstFileWriter::Finish(ExternalSstFileInfo* file_info) {
   }
   if (s.ok()) {
     s = r->file_writer->Sync(opts, r->ioptions.use_fsync);
-    r->InvalidatePageCache(true /* closing */).PermitUncheckedError();
+    r->InvalidatePageCache(true /* closing */, r->file_info.file_size)
+        .PermitUncheckedError();
     if (s.ok()) {
       s = r->file_writer->Close(opts);
     }
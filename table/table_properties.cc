@@ -51,6 +51,8 @@ std::string TableProperties::ToString(const std::string& prop_delim,
   AppendProperty(result, "# deletions", num_deletions, prop_delim, kv_delim);
   AppendProperty(result, "# merge operands", num_merge_operands, prop_delim,
                  kv_delim);
+  AppendProperty(result, "# key overwrites", num_key_overwrites, prop_delim,
+                 kv_delim);
   AppendProperty(result, "# range deletions", num_range_deletions, prop_delim,
                  kv_delim);
 
@@ -191,6 +193,7 @@ void TableProperties::Add(const TableProperties& tp) {
   num_filter_entries += tp.num_filter_entries;
   num_deletions += tp.num_deletions;
   num_merge_operands += tp.num_merge_operands;
+  num_key_overwrites += tp.num_key_overwrites;
   num_range_deletions += tp.num_range_deletions;
   slow_compression_estimated_data_size +=
       tp.slow_compression_estimated_data_size;
@@ -213,6 +216,7 @@ TableProperties::GetAggregatablePropertiesAsMap() const {
   rv["num_filter_entries"] = num_filter_entries;
   rv["num_deletions"] = num_deletions;
   rv["num_merge_operands"] = num_merge_operands;
+  rv["num_key_overwrites"] = num_key_overwrites;
   rv["num_range_deletions"] = num_range_deletions;
   rv["slow_compression_estimated_data_size"] =
       slow_compression_estimated_data_size;
@@ -280,6 +284,8 @@ const std::string TablePropertiesNames::kNumFilterEntries =
 const std::string TablePropertiesNames::kDeletedKeys = "rocksdb.deleted.keys";
 const std::string TablePropertiesNames::kMergeOperands =
     "rocksdb.merge.operands";
+const std::string TablePropertiesNames::kKeyOverwrites =
+    "rocksdb.key.overwrites";
 const std::string TablePropertiesNames::kNumRangeDeletions =
     "rocksdb.num.range-deletions";
 const std::string TablePropertiesNames::kFilterPolicy = "rocksdb.filter.policy";
@@ -377,6 +383,10 @@ static std::unordered_map<std::string, OptionTypeInfo>
          {offsetof(struct TableProperties, num_merge_operands),
           OptionType::kUInt64T, OptionVerificationType::kNormal,
           OptionTypeFlags::kNone}},
+        {"num_key_overwrites",
+         {offsetof(struct TableProperties, num_key_overwrites),
+          OptionType::kUInt64T, OptionVerificationType::kNormal,
+          OptionTypeFlags::kNone}},
         {"num_range_deletions",
          {offsetof(struct TableProperties, num_range_deletions),
           OptionType::kUInt64T, OptionVerificationType::kNormal,
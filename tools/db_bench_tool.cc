@@ -170,6 +170,10 @@ DEFINE_string(
     " mode\n"
     "\tfilluniquerandomdeterministic       -- write N values in a random"
     " key order and keep the shape of the LSM tree\n"
+    "\twbmstallstress -- N-1 threads write random keys to column "
+    "families with Zipfian skew against the shared WriteBufferManager "
+    "while one thread reports stall-time distribution, flush-cascade "
+    "counts and memtable-utilization timelines\n"
     "\toverwrite     -- overwrite N values in random key order in "
     "async mode\n"
     "\tfillsync      -- write N/1000 values in random key order in "
@@ -418,6 +422,17 @@ DEFINE_double(read_random_exp_range, 0.0,
 
 DEFINE_bool(histogram, false, "Print histogram of operation timings");
 
+DEFINE_double(latency_slo_micros, 0.0,
+              "If > 0, check the per-operation-type latency histogram of each "
+              "benchmark against this bound (in microseconds) at the "
+              "percentile given by --latency_slo_percentile, and exit with a "
+              "non-zero code if any operation type exceeds it. Implies "
+              "--histogram. Intended for wiring workload regression tests "
+              "into CI.");
+
+DEFINE_double(latency_slo_percentile, 99.0,
+              "The latency percentile checked by --latency_slo_micros");
+
 DEFINE_bool(confidence_interval_only, false,
             "Print 95% confidence interval upper and lower bounds only for "
             "aggregate stats.");
@@ -437,6 +452,16 @@ DEFINE_int64(db_write_buffer_size,
 DEFINE_bool(cost_write_buffer_to_cache, false,
             "The usage of memtable is costed to the block cache");
 
+DEFINE_double(wbm_stress_cf_skew, 0.0,
+              "Zipfian exponent used by the wbmstallstress benchmark to "
+              "distribute writes across column families. 0 means uniform; "
+              "larger values concentrate writes on low CF indices.");
+
+DEFINE_int64(wbm_stress_sample_interval_ms, 100,
+             "Interval at which the wbmstallstress monitor thread samples "
+             "WriteBufferManager stall state, memtable utilization and "
+             "flush concurrency.");
+
 DEFINE_int64(arena_block_size, ROCKSDB_NAMESPACE::Options().arena_block_size,
              "The size, in bytes, of one block in arena memory allocation.");
 
@@ -1574,6 +1599,12 @@ DEFINE_double(mix_put_ratio, 0.0,
               "The ratio of Put queries of mix_graph workload");
 DEFINE_double(mix_seek_ratio, 0.0,
               "The ratio of Seek queries of mix_graph workload");
+DEFINE_double(mix_multiget_ratio, 0.0,
+              "The ratio of MultiGet queries ratio in mix_graph");
+
+DEFINE_int64(mix_multiget_batch_size, 16,
+             "The number of keys in one MultiGet batch in mix_graph");
+
 DEFINE_int64(mix_max_scan_len, 10000, "The max scan length of Iterator");
 DEFINE_int64(mix_max_value_size, 1024, "The max value size of this workload");
 DEFINE_double(
@@ -2178,6 +2209,10 @@ static std::unordered_map<OperationType, std::string, std::hash<unsigned char>>
                            {kCrc, "crc"},           {kHash, "hash"},
                            {kOthers, "op"}};
 
+// Set when a benchmark exceeds the --latency_slo_micros bound. Makes db_bench
+// exit with a non-zero code after all benchmarks have run.
+static bool latency_slo_violated = false;
+
 class CombinedStats;
 class Stats {
  private:
@@ -2467,6 +2502,22 @@ class Stats {
                 it->second->ToString().c_str());
       }
     }
+    if (FLAGS_latency_slo_micros > 0) {
+      for (auto it = hist_.begin(); it != hist_.end(); ++it) {
+        double observed =
+            it->second->Percentile(FLAGS_latency_slo_percentile);
+        if (observed > FLAGS_latency_slo_micros) {
+          fprintf(stderr,
+                  "SLO violation in %s: %s p%g latency is %.2f micros, bound "
+                  "is %.2f micros\n",
+                  name.ToString().c_str(),
+                  OperationTypeString[it->first].c_str(),
+                  FLAGS_latency_slo_percentile, observed,
+                  FLAGS_latency_slo_micros);
+          latency_slo_violated = true;
+        }
+      }
+    }
     if (FLAGS_report_file_operations) {
       auto* counted_fs =
           FLAGS_env->GetFileSystem()->CheckedCast<CountedFileSystem>();
@@ -3572,6 +3623,9 @@ class Benchmark {
           num_threads = 1;
         }
         method = &Benchmark::WriteUniqueRandom;
+      } else if (name == "wbmstallstress") {
+        fresh_db = true;
+        method = &Benchmark::WBMStallStress;
       } else if (name == "overwrite") {
         method = &Benchmark::WriteRandom;
       } else if (name == "fillsync") {
@@ -5067,6 +5121,144 @@ class Benchmark {
     DoWrite(thread, UNIQUE_RANDOM);
   }
 
+  // Drives skewed random writes across column families against the shared
+  // WriteBufferManager while thread 0 samples stall state, memtable
+  // utilization and flush concurrency, so WBM changes can be compared on
+  // stall-time distribution, flush-cascade counts and utilization timelines.
+  // Requires -db_write_buffer_size > 0; use -num_column_families for the CF
+  // count and -wbm_stress_cf_skew to concentrate writes on low CF indices.
+  void WBMStallStress(ThreadState* thread) {
+    WriteBufferManager* wbm = open_options_.write_buffer_manager.get();
+    if (wbm == nullptr || !wbm->enabled()) {
+      fprintf(stderr, "wbmstallstress requires -db_write_buffer_size > 0\n");
+      ErrorExit();
+    }
+    if (thread->tid == 0 && thread->shared->total > 1) {
+      WBMStallMonitor(thread, wbm);
+    } else {
+      WBMStallWriter(thread);
+    }
+  }
+
+  void WBMStallWriter(ThreadState* thread) {
+    DBWithColumnFamilies* db_with_cfh = SelectDBWithCfh(thread);
+    // Cumulative Zipfian weights over CF indices; CF i is picked with
+    // probability proportional to 1 / (i + 1)^skew.
+    const size_t num_cfs = std::max<size_t>(size_t{1}, db_with_cfh->cfh.size());
+    std::vector<double> cum_weights(num_cfs);
+    double weight_sum = 0;
+    for (size_t i = 0; i < num_cfs; ++i) {
+      weight_sum +=
+          1.0 / std::pow(static_cast<double>(i + 1), FLAGS_wbm_stress_cf_skew);
+      cum_weights[i] = weight_sum;
+    }
+    RandomGenerator gen;
+    std::unique_ptr<const char[]> key_guard;
+    Slice key = AllocateKey(&key_guard);
+    int64_t bytes = 0;
+    Duration duration(FLAGS_duration, writes_ == 0 ? num_ : writes_);
+    while (!duration.Done(1)) {
+      GenerateKeyFromInt(thread->rand.Next() % FLAGS_num, FLAGS_num, &key);
+      const double r =
+          static_cast<double>(thread->rand.Next() % 1000000) / 1000000.0 *
+          weight_sum;
+      const size_t cf_idx = static_cast<size_t>(
+          std::lower_bound(cum_weights.begin(), cum_weights.end(), r) -
+          cum_weights.begin());
+      ColumnFamilyHandle* cfh =
+          db_with_cfh->cfh.empty()
+              ? db_with_cfh->db->DefaultColumnFamily()
+              : db_with_cfh->cfh[std::min(cf_idx,
+                                          db_with_cfh->cfh.size() - 1)];
+      Slice val = gen.Generate();
+      Status s = db_with_cfh->db->Put(write_options_, cfh, key, val);
+      if (!s.ok()) {
+        fprintf(stderr, "put error: %s\n", s.ToString().c_str());
+        ErrorExit();
+      }
+      bytes += key.size() + val.size();
+      thread->stats.FinishedOps(db_with_cfh, db_with_cfh->db, 1, kWrite);
+    }
+    thread->stats.AddBytes(bytes);
+  }
+
+  void WBMStallMonitor(ThreadState* thread, WriteBufferManager* wbm) {
+    DB* db = db_.db != nullptr ? db_.db : multi_dbs_[0].db;
+    HistogramImpl stall_ms_histogram;
+    HistogramImpl utilization_pct_histogram;
+    uint64_t stall_episodes = 0;
+    uint64_t total_stall_ms = 0;
+    uint64_t flush_cascades = 0;
+    uint64_t max_running_flushes = 0;
+    uint64_t prev_running_flushes = 0;
+    size_t peak_usage = 0;
+    uint64_t samples = 0;
+    bool in_stall = false;
+    uint64_t stall_start_ms = 0;
+    for (;;) {
+      {
+        MutexLock l(&thread->shared->mu);
+        // All other threads are writers; stop once they have finished.
+        if (thread->shared->num_done + 1 >= thread->shared->total) {
+          break;
+        }
+      }
+      const uint64_t now_ms = FLAGS_env->NowMicros() / 1000;
+      const size_t usage = wbm->memory_usage();
+      peak_usage = std::max(peak_usage, usage);
+      utilization_pct_histogram.Add(usage * 100 / wbm->buffer_size());
+      const bool stalled = wbm->ShouldStall();
+      if (stalled && !in_stall) {
+        in_stall = true;
+        stall_start_ms = now_ms;
+        ++stall_episodes;
+      } else if (!stalled && in_stall) {
+        in_stall = false;
+        stall_ms_histogram.Add(now_ms - stall_start_ms);
+        total_stall_ms += now_ms - stall_start_ms;
+      }
+      uint64_t running_flushes = 0;
+      db->GetIntProperty(DB::Properties::kNumRunningFlushes, &running_flushes);
+      if (running_flushes >= 2 && prev_running_flushes < 2) {
+        ++flush_cascades;
+      }
+      max_running_flushes = std::max(max_running_flushes, running_flushes);
+      prev_running_flushes = running_flushes;
+      ++samples;
+      FLAGS_env->SleepForMicroseconds(
+          static_cast<int>(FLAGS_wbm_stress_sample_interval_ms * 1000));
+    }
+    if (in_stall) {
+      const uint64_t now_ms = FLAGS_env->NowMicros() / 1000;
+      stall_ms_histogram.Add(now_ms - stall_start_ms);
+      total_stall_ms += now_ms - stall_start_ms;
+    }
+    fprintf(stdout,
+            "\nWriteBufferManager stall stress report\n"
+            "buffer_size: %" PRIu64 " peak_usage: %" PRIu64
+            " samples: %" PRIu64 "\n"
+            "stall episodes: %" PRIu64 " total stall ms: %" PRIu64 "\n"
+            "stall ms per episode: avg %.1f P50 %.1f P99 %.1f max %" PRIu64
+            "\n"
+            "memtable utilization pct: avg %.1f P50 %.1f P99 %.1f\n"
+            "flush cascades (2+ concurrent): %" PRIu64
+            " max concurrent flushes: %" PRIu64 "\n",
+            static_cast<uint64_t>(wbm->buffer_size()),
+            static_cast<uint64_t>(peak_usage), samples, stall_episodes,
+            total_stall_ms, stall_ms_histogram.Average(),
+            stall_ms_histogram.Median(), stall_ms_histogram.Percentile(99),
+            stall_ms_histogram.max(), utilization_pct_histogram.Average(),
+            utilization_pct_histogram.Median(),
+            utilization_pct_histogram.Percentile(99), flush_cascades,
+            max_running_flushes);
+    char msg[100];
+    snprintf(msg, sizeof(msg),
+             "(stalls: %" PRIu64 " stall_ms: %" PRIu64 " cascades: %" PRIu64
+             ")",
+             stall_episodes, total_stall_ms, flush_cascades);
+    thread->stats.AddMessage(msg);
+  }
+
   class KeyGenerator {
    public:
     KeyGenerator(Random64* rand, WriteMode mode, uint64_t num,
@@ -6619,7 +6811,7 @@ class Benchmark {
     bool use_random_modeling = false;
     GenerateTwoTermExpKeys gen_exp;
     std::vector<double> ratio{FLAGS_mix_get_ratio, FLAGS_mix_put_ratio,
-                              FLAGS_mix_seek_ratio};
+                              FLAGS_mix_seek_ratio, FLAGS_mix_multiget_ratio};
     char value_buffer[default_value_max];
     QueryDecider query;
     RandomGenerator gen;
@@ -6633,6 +6825,20 @@ class Benchmark {
     PinnableSlice pinnable_val;
     query.Initiate(ratio);
 
+    // Buffers for the MultiGet queries
+    int64_t mgets = 0;
+    int64_t mget_found = 0;
+    const int64_t multiget_batch_size = FLAGS_mix_multiget_batch_size;
+    std::vector<Slice> mget_keys;
+    std::vector<std::unique_ptr<const char[]>> mget_key_guards;
+    std::vector<std::string> mget_values(multiget_batch_size);
+    if (FLAGS_mix_multiget_ratio > 0.0) {
+      while (static_cast<int64_t>(mget_keys.size()) < multiget_batch_size) {
+        mget_key_guards.push_back(std::unique_ptr<const char[]>());
+        mget_keys.push_back(AllocateKey(&mget_key_guards.back()));
+      }
+    }
+
     // the limit of qps initiation
     if (FLAGS_sine_mix_rate) {
       thread->shared->read_rate_limiter.reset(
@@ -6653,25 +6859,33 @@ class Benchmark {
       use_random_modeling = true;
     }
 
-    Duration duration(FLAGS_duration, reads_);
-    while (!duration.Done(1)) {
-      DBWithColumnFamilies* db_with_cfh = SelectDBWithCfh(thread);
-      int64_t ini_rand, rand_v, key_rand, key_seed;
-      ini_rand = GetRandomKey(&thread->rand);
-      rand_v = ini_rand % FLAGS_num;
-      double u = static_cast<double>(rand_v) / FLAGS_num;
-
-      // Generate the keyID based on the key hotness and prefix hotness
+    // Generate a keyID based on the key hotness and prefix hotness
+    auto dist_key_id = [&](int64_t ini_rand) {
+      int64_t key_rand;
       if (use_random_modeling) {
         key_rand = ini_rand;
       } else if (use_prefix_modeling) {
         key_rand =
             gen_exp.DistGetKeyID(ini_rand, FLAGS_key_dist_a, FLAGS_key_dist_b);
       } else {
-        key_seed = PowerCdfInversion(u, FLAGS_key_dist_a, FLAGS_key_dist_b);
+        double u = static_cast<double>(ini_rand % FLAGS_num) / FLAGS_num;
+        int64_t key_seed =
+            PowerCdfInversion(u, FLAGS_key_dist_a, FLAGS_key_dist_b);
         Random64 rand(key_seed);
         key_rand = static_cast<int64_t>(rand.Next()) % FLAGS_num;
       }
+      return key_rand;
+    };
+
+    Duration duration(FLAGS_duration, reads_);
+    while (!duration.Done(1)) {
+      DBWithColumnFamilies* db_with_cfh = SelectDBWithCfh(thread);
+      int64_t ini_rand, rand_v, key_rand;
+      ini_rand = GetRandomKey(&thread->rand);
+      rand_v = ini_rand % FLAGS_num;
+      double u = static_cast<double>(rand_v) / FLAGS_num;
+
+      key_rand = dist_key_id(ini_rand);
       GenerateKeyFromInt(key_rand, FLAGS_num, &key);
       int query_type = query.GetType(rand_v);
 
@@ -6692,7 +6906,8 @@ class Benchmark {
         thread->stats.ResetSineInterval();
         double mix_rate_with_noise = AddNoise(
             SineRate(usecs_since_start / 1000000.0), FLAGS_sine_mix_rate_noise);
-        read_rate = mix_rate_with_noise * (query.ratio_[0] + query.ratio_[2]);
+        read_rate = mix_rate_with_noise *
+                    (query.ratio_[0] + query.ratio_[2] + query.ratio_[3]);
         write_rate = mix_rate_with_noise * query.ratio_[1];
 
         if (read_rate > 0) {
@@ -6784,16 +6999,46 @@ class Benchmark {
           delete single_iter;
         }
         thread->stats.FinishedOps(db_with_cfh, db_with_cfh->db, 1, kSeek);
+      } else if (query_type == 3) {
+        // MultiGet query
+        mgets++;
+        GenerateKeyFromInt(key_rand, FLAGS_num, &mget_keys[0]);
+        for (int64_t i = 1; i < multiget_batch_size; i++) {
+          int64_t batch_key_rand = dist_key_id(GetRandomKey(&thread->rand));
+          GenerateKeyFromInt(batch_key_rand, FLAGS_num, &mget_keys[i]);
+        }
+        std::vector<Status> statuses =
+            db_with_cfh->db->MultiGet(read_options_, mget_keys, &mget_values);
+        assert(static_cast<int64_t>(statuses.size()) == multiget_batch_size);
+        for (int64_t i = 0; i < multiget_batch_size; i++) {
+          if (statuses[i].ok()) {
+            mget_found++;
+            bytes += mget_keys[i].size() + mget_values[i].size();
+          } else if (!statuses[i].IsNotFound()) {
+            fprintf(stderr, "MultiGet returned an error: %s\n",
+                    statuses[i].ToString().c_str());
+            abort();
+          }
+        }
+
+        if (thread->shared->read_rate_limiter && mgets % 100 == 0) {
+          thread->shared->read_rate_limiter->Request(
+              100 * multiget_batch_size, Env::IO_HIGH, nullptr /*stats*/);
+        }
+        thread->stats.FinishedOps(db_with_cfh, db_with_cfh->db,
+                                  multiget_batch_size, kRead);
       }
     }
     char msg[256];
     snprintf(msg, sizeof(msg),
              "( Gets:%" PRIu64 " Puts:%" PRIu64 " Seek:%" PRIu64
-             ", reads %" PRIu64 " in %" PRIu64
+             " MultiGets:%" PRIu64 ", reads %" PRIu64 " in %" PRIu64
              " found, "
              "avg size: %.1f value, %.1f scan)\n",
-             gets, puts, seek, get_found + seek_found, gets + seek,
-             total_val_size / puts, total_scan_length / seek);
+             gets, puts, seek, mgets,
+             get_found + seek_found + mget_found,
+             gets + seek + mgets * multiget_batch_size, total_val_size / puts,
+             total_scan_length / seek);
 
     thread->stats.AddBytes(bytes);
     thread->stats.AddMessage(msg);
@@ -8806,6 +9051,11 @@ int db_bench_tool(int argc, char** argv, ToolHooks& hooks) {
     exit(1);
   }
 
+  // SLO checking needs the per-operation-type latency histograms
+  if (FLAGS_latency_slo_micros > 0) {
+    FLAGS_histogram = true;
+  }
+
   ROCKSDB_NAMESPACE::Benchmark benchmark;
   benchmark.Run(hooks);
 
@@ -8815,6 +9065,9 @@ int db_bench_tool(int argc, char** argv, ToolHooks& hooks) {
     fprintf(stdout, "Malloc stats:\n%s\n", stats_string.c_str());
   }
 
+  if (ROCKSDB_NAMESPACE::latency_slo_violated) {
+    return 1;
+  }
   return 0;
 }
 }  // namespace ROCKSDB_NAMESPACE
@@ -110,6 +110,8 @@ class DBDumperCommand : public LDBCommand {
   std::string path_;
   bool decode_blob_index_;
   bool dump_uncompressed_blobs_;
+  bool async_io_;
+  size_t scan_readahead_size_;
 
   static const std::string ARG_COUNT_ONLY;
   static const std::string ARG_COUNT_DELIM;
@@ -512,6 +514,8 @@ class ScanCommand : public LDBCommand {
   int max_keys_scanned_;
   bool no_value_;
   bool get_write_unix_time_;
+  bool async_io_;
+  size_t scan_readahead_size_;
 };
 
 class DeleteCommand : public LDBCommand {
@@ -365,6 +365,25 @@ TEST_F(SSTDumpToolTest, MemEnv) {
   }
 }
 
+TEST_F(SSTDumpToolTest, Analyze) {
+  Options opts;
+  opts.env = env();
+  std::string file_path = MakeFilePath("rocksdb_sst_analyze.sst");
+  createSST(opts, file_path);
+
+  char* usage[4];
+  PopulateCommandArgs(file_path, "--command=analyze", usage);
+  snprintf(usage[3], kOptLength, "--analyze_threads=2");
+
+  ROCKSDB_NAMESPACE::SSTDumpTool tool;
+  ASSERT_TRUE(!tool.Run(4, usage, opts));
+
+  cleanup(opts, file_path);
+  for (int i = 0; i < 4; i++) {
+    delete[] usage[i];
+  }
+}
+
 TEST_F(SSTDumpToolTest, ReadaheadSize) {
   Options opts;
   opts.env = env();
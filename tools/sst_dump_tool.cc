@@ -8,6 +8,7 @@
 
 #include <cinttypes>
 #include <iostream>
+#include <thread>
 
 #include "options/options_helper.h"
 #include "port/port.h"
@@ -43,7 +44,7 @@ void print_help(bool to_stderr) {
   }
   fprintf(
       to_stderr ? stderr : stdout,
-      R"(sst_dump --file=<data_dir_OR_sst_file> [--command=check|scan|raw|recompress|identify]
+      R"(sst_dump --file=<data_dir_OR_sst_file> [--command=check|scan|raw|recompress|identify|analyze]
     --file=<data_dir_OR_sst_file>
       Path to SST file or directory containing SST files
 
@@ -53,7 +54,7 @@ void print_help(bool to_stderr) {
     --fs_uri=<uri of underlying FileSystem>
       URI of underlying FileSystem, mutually exclusive with env_uri
 
-    --command=check|scan|raw|verify|identify
+    --command=check|scan|raw|verify|identify|analyze
         check: Iterate over entries in files but don't print anything except if an error is encountered (default command)
                When read_num, from and to are not set, it compares the number of keys read with num_entries in table
                property and will report corruption if there is a mismatch.
@@ -63,6 +64,9 @@ void print_help(bool to_stderr) {
         recompress: reports the SST file size if recompressed with different
                     compression types
         identify: Reports a file is a valid SST file or lists all valid SST files under a directory
+        analyze: Decode all data blocks in parallel and print a JSON summary of per-block statistics
+                 (compression ratio, entries per block, restart-interval efficiency, key-prefix
+                 cardinality, tombstone density) for tuning block_size/compression_opts
 
     --output_hex
       Can be combined with scan command to print the keys and values in Hex
@@ -103,6 +107,10 @@ void print_help(bool to_stderr) {
       list of compression types
       Supported compression types: %s
 
+    --analyze_threads=<num>
+      Number of worker threads used to decode blocks when executing analyze.
+      Defaults to the number of CPU cores
+
     --parse_internal_key=<0xKEY>
       Convenience option to parse an internal key on the command line. Dumps the
       internal key in hex format {'key' @ SN: type}
@@ -178,6 +186,8 @@ int SSTDumpTool::Run(int argc, char const* const* argv, Options options) {
   std::string compression_level_to_str;
   size_t block_size = 0;
   size_t readahead_size = 2 * 1024 * 1024;
+  size_t analyze_threads =
+      std::max(std::thread::hardware_concurrency(), 1u);
   std::vector<std::pair<CompressionType, const char*>> compression_types;
   uint64_t total_num_files = 0;
   uint64_t total_num_data_blocks = 0;
@@ -237,6 +247,9 @@ int SSTDumpTool::Run(int argc, char const* const* argv, Options options) {
     } else if (ParseIntArg(argv[i], "--readahead_size=",
                            "readahead_size must be numeric", &tmp_val)) {
       readahead_size = static_cast<size_t>(tmp_val);
+    } else if (ParseIntArg(argv[i], "--analyze_threads=",
+                           "analyze_threads must be numeric", &tmp_val)) {
+      analyze_threads = static_cast<size_t>(tmp_val);
     } else if (strncmp(argv[i], "--compression_types=", 20) == 0) {
       std::string compression_types_csv = argv[i] + 20;
       std::istringstream iss(compression_types_csv);
@@ -461,6 +474,17 @@ int SSTDumpTool::Run(int argc, char const* const* argv, Options options) {
       return 0;
     }
 
+    if (command == "analyze") {
+      std::string json;
+      st = dumper.AnalyzeBlocks(analyze_threads, &json);
+      if (!st.ok()) {
+        fprintf(stderr, "%s: %s\n", filename.c_str(), st.ToString().c_str());
+        exit(1);
+      }
+      fprintf(stdout, "%s\n", json.c_str());
+      continue;
+    }
+
     if (command == "raw") {
       std::string out_filename = filename.substr(0, filename.length() - 4);
       out_filename.append("_dump.txt");
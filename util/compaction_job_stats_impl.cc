@@ -53,6 +53,9 @@ void CompactionJobStats::Reset() {
 
   num_single_del_fallthru = 0;
   num_single_del_mismatch = 0;
+
+  num_key_buffer_reallocations = 0;
+  num_value_buffer_reallocations = 0;
 }
 
 void CompactionJobStats::Add(const CompactionJobStats& stats) {
@@ -96,6 +99,9 @@ void CompactionJobStats::Add(const CompactionJobStats& stats) {
   num_single_del_fallthru += stats.num_single_del_fallthru;
   num_single_del_mismatch += stats.num_single_del_mismatch;
 
+  num_key_buffer_reallocations += stats.num_key_buffer_reallocations;
+  num_value_buffer_reallocations += stats.num_value_buffer_reallocations;
+
   is_remote_compaction |= stats.is_remote_compaction;
 }
 
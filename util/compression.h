@@ -136,6 +136,62 @@ class ZSTDUncompressCachedData {
   ZSTDNativeContext zstd_ctx_ = nullptr;
   int64_t cache_idx_ = -1;  // -1 means this instance owns the context
 };
+
+// Same as above, for compression contexts. Recycling these across output
+// files lets ZSTD reuse its internal workspace instead of reallocating it
+// for every file a compaction or flush writes.
+class ZSTDCompressCachedData {
+ public:
+#if defined(ZSTD)
+  using ZSTDNativeContext = ZSTD_CCtx*;
+#else
+  using ZSTDNativeContext = void*;
+#endif  // ZSTD
+  ZSTDCompressCachedData() {}
+  // Init from cache
+  ZSTDCompressCachedData(const ZSTDCompressCachedData& o) = delete;
+  ZSTDCompressCachedData& operator=(const ZSTDCompressCachedData&) = delete;
+  ZSTDCompressCachedData(ZSTDCompressCachedData&& o) noexcept
+      : ZSTDCompressCachedData() {
+    *this = std::move(o);
+  }
+  ZSTDCompressCachedData& operator=(ZSTDCompressCachedData&& o) noexcept {
+    assert(zstd_ctx_ == nullptr);
+    std::swap(zstd_ctx_, o.zstd_ctx_);
+    std::swap(cache_idx_, o.cache_idx_);
+    return *this;
+  }
+  ZSTDNativeContext Get() const { return zstd_ctx_; }
+  int64_t GetCacheIndex() const { return cache_idx_; }
+  void CreateIfNeeded() {
+    if (zstd_ctx_ == nullptr) {
+#if !defined(ZSTD)
+      zstd_ctx_ = nullptr;
+#elif defined(ROCKSDB_ZSTD_CUSTOM_MEM)
+      zstd_ctx_ =
+          ZSTD_createCCtx_advanced(port::GetJeZstdAllocationOverrides());
+#else  // ZSTD && !ROCKSDB_ZSTD_CUSTOM_MEM
+      zstd_ctx_ = ZSTD_createCCtx();
+#endif
+      cache_idx_ = -1;
+    }
+  }
+  void InitFromCache(const ZSTDCompressCachedData& o, int64_t idx) {
+    zstd_ctx_ = o.zstd_ctx_;
+    cache_idx_ = idx;
+  }
+  ~ZSTDCompressCachedData() {
+#if defined(ZSTD)
+    if (zstd_ctx_ != nullptr && cache_idx_ == -1) {
+      ZSTD_freeCCtx(zstd_ctx_);
+    }
+#endif  // ZSTD
+  }
+
+ private:
+  ZSTDNativeContext zstd_ctx_ = nullptr;
+  int64_t cache_idx_ = -1;  // -1 means this instance owns the context
+};
 }  // namespace ROCKSDB_NAMESPACE
 
 #if defined(XPRESS)
@@ -341,14 +397,8 @@ class CompressionContext {
  private:
 #ifdef ZSTD
   ZSTD_CCtx* zstd_ctx_ = nullptr;
-
-  ZSTD_CCtx* CreateZSTDContext() {
-#ifdef ROCKSDB_ZSTD_CUSTOM_MEM
-    return ZSTD_createCCtx_advanced(port::GetJeZstdAllocationOverrides());
-#else   // ROCKSDB_ZSTD_CUSTOM_MEM
-    return ZSTD_createCCtx();
-#endif  // ROCKSDB_ZSTD_CUSTOM_MEM
-  }
+  CompressionContextCache* ctx_cache_ = nullptr;
+  ZSTDCompressCachedData comp_cached_data_;
 
  public:
   // callable inside ZSTD_Compress
@@ -363,7 +413,15 @@ class CompressionContext {
   void CreateNativeContext(CompressionType type, int level, bool checksum) {
 #ifdef ZSTD
     if (type == kZSTD) {
-      zstd_ctx_ = CreateZSTDContext();
+      // Borrow a recycled context so ZSTD can reuse the workspace it
+      // allocated for the previous SST file compressed on this core.
+      ctx_cache_ = CompressionContextCache::Instance();
+      comp_cached_data_ = ctx_cache_->GetCachedZSTDCompressData();
+      zstd_ctx_ = comp_cached_data_.Get();
+      // A recycled context carries the previous user's parameters; clear
+      // them before applying ours. This is cheap relative to context
+      // (workspace) allocation.
+      ZSTD_CCtx_reset(zstd_ctx_, ZSTD_reset_session_and_parameters);
       if (level == CompressionOptions::kDefaultCompressionLevel) {
         // NB: ZSTD_CLEVEL_DEFAULT is historically == 3
         level = ZSTD_CLEVEL_DEFAULT;
@@ -372,15 +430,13 @@ class CompressionContext {
           ZSTD_CCtx_setParameter(zstd_ctx_, ZSTD_c_compressionLevel, level);
       if (ZSTD_isError(err)) {
         assert(false);
-        ZSTD_freeCCtx(zstd_ctx_);
-        zstd_ctx_ = CreateZSTDContext();
+        ZSTD_CCtx_reset(zstd_ctx_, ZSTD_reset_session_and_parameters);
       }
       if (checksum) {
         err = ZSTD_CCtx_setParameter(zstd_ctx_, ZSTD_c_checksumFlag, 1);
         if (ZSTD_isError(err)) {
           assert(false);
-          ZSTD_freeCCtx(zstd_ctx_);
-          zstd_ctx_ = CreateZSTDContext();
+          ZSTD_CCtx_reset(zstd_ctx_, ZSTD_reset_session_and_parameters);
         }
       }
     }
@@ -392,9 +448,13 @@ class CompressionContext {
   }
   void DestroyNativeContext() {
 #ifdef ZSTD
-    if (zstd_ctx_ != nullptr) {
-      ZSTD_freeCCtx(zstd_ctx_);
+    if (comp_cached_data_.GetCacheIndex() != -1) {
+      assert(ctx_cache_ != nullptr);
+      ctx_cache_->ReturnCachedZSTDCompressData(
+          comp_cached_data_.GetCacheIndex());
     }
+    // When the context was created for one-time use (another thread held
+    // this core's cached entry), ~ZSTDCompressCachedData() frees it.
 #endif  // ZSTD
   }
 
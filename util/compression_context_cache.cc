@@ -18,23 +18,28 @@ namespace ROCKSDB_NAMESPACE {
 namespace compression_cache {
 
 void* const SentinelValue = nullptr;
-// Cache ZSTD uncompression contexts for reads
-// if needed we can add ZSTD compression context caching
-// which is currently is not done since BlockBasedTableBuilder
-// simply creates one compression context per new SST file.
+// Cache ZSTD uncompression contexts for reads and compression contexts
+// for writes. BlockBasedTableBuilder creates one compression context per
+// new SST file; recycling the context lets ZSTD reuse its workspace
+// across output files instead of reallocating it each time.
 struct ZSTDCachedData {
   // We choose to cache the below structure instead of a ptr
   // because we want to avoid a) native types leak b) make
   // cache use transparent for the user
   ZSTDUncompressCachedData uncomp_cached_data_;
   std::atomic<void*> zstd_uncomp_sentinel_;
-
-  char
-      padding[(CACHE_LINE_SIZE -
-               (sizeof(ZSTDUncompressCachedData) + sizeof(std::atomic<void*>)) %
-                   CACHE_LINE_SIZE)];  // unused padding field
-
-  ZSTDCachedData() : zstd_uncomp_sentinel_(&uncomp_cached_data_) {}
+  ZSTDCompressCachedData comp_cached_data_;
+  std::atomic<void*> zstd_comp_sentinel_;
+
+  char padding[(CACHE_LINE_SIZE - (sizeof(ZSTDUncompressCachedData) +
+                                   sizeof(ZSTDCompressCachedData) +
+                                   2 * sizeof(std::atomic<void*>)) %
+                                      CACHE_LINE_SIZE)];  // unused padding
+                                                          // field
+
+  ZSTDCachedData()
+      : zstd_uncomp_sentinel_(&uncomp_cached_data_),
+        zstd_comp_sentinel_(&comp_cached_data_) {}
   ZSTDCachedData(const ZSTDCachedData&) = delete;
   ZSTDCachedData& operator=(const ZSTDCachedData&) = delete;
 
@@ -60,6 +65,28 @@ struct ZSTDCachedData {
       assert(false);
     }
   }
+
+  ZSTDCompressCachedData GetCompressData(int64_t idx) {
+    ZSTDCompressCachedData result;
+    void* expected = &comp_cached_data_;
+    if (zstd_comp_sentinel_.compare_exchange_strong(expected, SentinelValue)) {
+      comp_cached_data_.CreateIfNeeded();
+      result.InitFromCache(comp_cached_data_, idx);
+    } else {
+      // Creates one time use data
+      result.CreateIfNeeded();
+    }
+    return result;
+  }
+  // Return the entry back into circulation
+  // This is executed only when we successfully obtained
+  // in the first place
+  void ReturnCompressData() {
+    if (zstd_comp_sentinel_.exchange(&comp_cached_data_) != SentinelValue) {
+      // Means we are returning while not having it acquired.
+      assert(false);
+    }
+  }
 };
 static_assert(sizeof(ZSTDCachedData) % CACHE_LINE_SIZE == 0,
               "Expected CACHE_LINE_SIZE alignment");
@@ -78,6 +105,16 @@ class CompressionContextCache::Rep {
     auto* cn = per_core_uncompr_.AccessAtCore(static_cast<size_t>(idx));
     cn->ReturnUncompressData();
   }
+  ZSTDCompressCachedData GetZSTDCompressData() {
+    auto p = per_core_uncompr_.AccessElementAndIndex();
+    int64_t idx = static_cast<int64_t>(p.second);
+    return p.first->GetCompressData(idx);
+  }
+  void ReturnZSTDCompressData(int64_t idx) {
+    assert(idx >= 0);
+    auto* cn = per_core_uncompr_.AccessAtCore(static_cast<size_t>(idx));
+    cn->ReturnCompressData();
+  }
 
  private:
   CoreLocalArray<compression_cache::ZSTDCachedData> per_core_uncompr_;
@@ -101,6 +138,14 @@ void CompressionContextCache::ReturnCachedZSTDUncompressData(int64_t idx) {
   rep_->ReturnZSTDUncompressData(idx);
 }
 
+ZSTDCompressCachedData CompressionContextCache::GetCachedZSTDCompressData() {
+  return rep_->GetZSTDCompressData();
+}
+
+void CompressionContextCache::ReturnCachedZSTDCompressData(int64_t idx) {
+  rep_->ReturnZSTDCompressData(idx);
+}
+
 CompressionContextCache::~CompressionContextCache() { delete rep_; }
 
 }  // namespace ROCKSDB_NAMESPACE
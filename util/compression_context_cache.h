@@ -23,6 +23,7 @@
 
 namespace ROCKSDB_NAMESPACE {
 class ZSTDUncompressCachedData;
+class ZSTDCompressCachedData;
 
 class CompressionContextCache {
  public:
@@ -35,6 +36,9 @@ class CompressionContextCache {
   ZSTDUncompressCachedData GetCachedZSTDUncompressData();
   void ReturnCachedZSTDUncompressData(int64_t idx);
 
+  ZSTDCompressCachedData GetCachedZSTDCompressData();
+  void ReturnCachedZSTDCompressData(int64_t idx);
+
  private:
   // Singleton
   CompressionContextCache();
@@ -9,7 +9,10 @@
 
 #include "util/concurrent_task_limiter_impl.h"
 
+#include <algorithm>
+
 #include "rocksdb/concurrent_task_limiter.h"
+#include "util/mutexlock.h"
 
 namespace ROCKSDB_NAMESPACE {
 
@@ -51,14 +54,81 @@ std::unique_ptr<TaskLimiterToken> ConcurrentTaskLimiterImpl::GetToken(
   return nullptr;
 }
 
+std::unique_ptr<TaskLimiterToken> ConcurrentTaskLimiterImpl::GetToken(
+    bool force, const void* /* client */) {
+  return GetToken(force);
+}
+
+void ConcurrentTaskLimiterImpl::ReleaseToken(const void* /* client */) {
+  --outstanding_tasks_;
+  assert(outstanding_tasks_ >= 0);
+}
+
+FairConcurrentTaskLimiterImpl::FairConcurrentTaskLimiterImpl(
+    const std::string& name, int32_t max_outstanding_task,
+    int32_t min_tasks_per_client)
+    : ConcurrentTaskLimiterImpl(name, max_outstanding_task),
+      min_tasks_per_client_(std::max(min_tasks_per_client, int32_t{1})) {}
+
+std::unique_ptr<TaskLimiterToken> FairConcurrentTaskLimiterImpl::GetToken(
+    bool force, const void* client) {
+  MutexLock l(&mutex_);
+
+  const int32_t limit = max_outstanding_tasks_.load(std::memory_order_relaxed);
+  const int32_t tasks = outstanding_tasks_.load(std::memory_order_relaxed);
+
+  // force = true, bypass the throttle.
+  // limit < 0 means unlimited tasks.
+  if (!force && limit >= 0) {
+    if (tasks >= limit) {
+      return nullptr;
+    }
+
+    const auto it = client_tasks_.find(client);
+    const int32_t client_tasks = it != client_tasks_.end() ? it->second : 0;
+    const int32_t active_clients =
+        static_cast<int32_t>(client_tasks_.size()) +
+        (it == client_tasks_.end() ? 1 : 0);
+    const int32_t fair_share =
+        std::max(min_tasks_per_client_, limit / active_clients);
+
+    if (client_tasks >= fair_share) {
+      return nullptr;
+    }
+  }
+
+  ++client_tasks_[client];
+  ++outstanding_tasks_;
+
+  return std::unique_ptr<TaskLimiterToken>(new TaskLimiterToken(this, client));
+}
+
+void FairConcurrentTaskLimiterImpl::ReleaseToken(const void* client) {
+  {
+    MutexLock l(&mutex_);
+
+    const auto it = client_tasks_.find(client);
+    assert(it != client_tasks_.end());
+    if (it != client_tasks_.end() && --it->second == 0) {
+      client_tasks_.erase(it);
+    }
+  }
+
+  --outstanding_tasks_;
+  assert(outstanding_tasks_ >= 0);
+}
+
 ConcurrentTaskLimiter* NewConcurrentTaskLimiter(const std::string& name,
                                                 int32_t limit) {
   return new ConcurrentTaskLimiterImpl(name, limit);
 }
 
-TaskLimiterToken::~TaskLimiterToken() {
-  --limiter_->outstanding_tasks_;
-  assert(limiter_->outstanding_tasks_ >= 0);
+ConcurrentTaskLimiter* NewFairConcurrentTaskLimiter(
+    const std::string& name, int32_t limit, int32_t min_tasks_per_instance) {
+  return new FairConcurrentTaskLimiterImpl(name, limit,
+                                           min_tasks_per_instance);
 }
 
+TaskLimiterToken::~TaskLimiterToken() { limiter_->ReleaseToken(client_); }
+
 }  // namespace ROCKSDB_NAMESPACE
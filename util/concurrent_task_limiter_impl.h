@@ -10,7 +10,9 @@
 #pragma once
 #include <atomic>
 #include <memory>
+#include <unordered_map>
 
+#include "port/port.h"
 #include "rocksdb/concurrent_task_limiter.h"
 #include "rocksdb/env.h"
 
@@ -42,22 +44,61 @@ class ConcurrentTaskLimiterImpl : public ConcurrentTaskLimiter {
   // Returns nullptr if it got throttled.
   virtual std::unique_ptr<TaskLimiterToken> GetToken(bool force);
 
- private:
+  // Same as above, additionally identifying the requesting client (typically
+  // the DB instance) for limiter implementations that balance tasks across
+  // clients. The base implementation ignores the client.
+  virtual std::unique_ptr<TaskLimiterToken> GetToken(bool force,
+                                                     const void* client);
+
+ protected:
   friend class TaskLimiterToken;
 
+  // Called when a token goes away, with the client it was handed out to
+  // (nullptr if none).
+  virtual void ReleaseToken(const void* client);
+
   std::string name_;
   std::atomic<int32_t> max_outstanding_tasks_;
   std::atomic<int32_t> outstanding_tasks_;
 };
 
+// A ConcurrentTaskLimiterImpl that, in addition to the global limit,
+// balances the task budget across the clients sharing the limiter: a
+// non-forced request from a client is only admitted while the client's own
+// outstanding task count is below max(min_tasks_per_client, limit / number
+// of active clients). Clients with no outstanding tasks do not count as
+// active, so the budget of idle clients is redistributed to busy ones.
+class FairConcurrentTaskLimiterImpl : public ConcurrentTaskLimiterImpl {
+ public:
+  FairConcurrentTaskLimiterImpl(const std::string& name,
+                                int32_t max_outstanding_task,
+                                int32_t min_tasks_per_client);
+
+  std::unique_ptr<TaskLimiterToken> GetToken(bool force,
+                                             const void* client) override;
+
+ protected:
+  void ReleaseToken(const void* client) override;
+
+ private:
+  const int32_t min_tasks_per_client_;
+
+  mutable port::Mutex mutex_;
+  // Outstanding task count per active client; entries are erased when the
+  // count drops to zero. Guarded by mutex_.
+  std::unordered_map<const void*, int32_t> client_tasks_;
+};
+
 class TaskLimiterToken {
  public:
-  explicit TaskLimiterToken(ConcurrentTaskLimiterImpl* limiter)
-      : limiter_(limiter) {}
+  explicit TaskLimiterToken(ConcurrentTaskLimiterImpl* limiter,
+                            const void* client = nullptr)
+      : limiter_(limiter), client_(client) {}
   ~TaskLimiterToken();
 
  private:
   ConcurrentTaskLimiterImpl* limiter_;
+  const void* client_;
 
   // no copying allowed
   TaskLimiterToken(const TaskLimiterToken&) = delete;
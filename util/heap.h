@@ -21,8 +21,8 @@ namespace ROCKSDB_NAMESPACE {
 // - std::priority_queue does not have a replace-top operation, requiring a
 //   pop+push.  If the replacement element is the new top, this requires
 //   around 2logN comparisons.
-// - This heap's pop() uses a "schoolbook" downheap which requires up to ~2logN
-//   comparisons.
+// - This heap's pop() uses a bottom-up hole-sifting strategy which requires
+//   about logN comparisons, versus up to ~2logN for a "schoolbook" downheap.
 // - This heap provides a replace_top() operation which requires [1, 2logN]
 //   comparisons.  When the replacement element is also the new top, this
 //   takes just 1 or 2 comparisons.
@@ -54,6 +54,19 @@ class BinaryHeap {
     upheap(data_.size() - 1);
   }
 
+  // Adds value without restoring the heap property. Useful when building a
+  // heap from scratch: after the last push_unordered(), restore_heap() must
+  // be called before any other operation. Building an n-element heap this
+  // way costs O(n) comparisons versus O(n logn) for ordered push() calls.
+  void push_unordered(const T& value) { data_.push_back(value); }
+
+  void restore_heap() {
+    reset_root_cmp_cache();
+    for (size_t index = data_.size() / 2; index-- > get_root();) {
+      downheap(index);
+    }
+  }
+
   const T& top() const {
     assert(!empty());
     return data_.front();
@@ -73,18 +86,37 @@ class BinaryHeap {
 
   void pop() {
     assert(!empty());
-    if (data_.size() > 1) {
-      // Avoid self-move-assign, because it could cause problems with
-      // classes which are not prepared for this and it trips up the
-      // STL debugger when activated.
-      data_.front() = std::move(data_.back());
-    }
+    T v = std::move(data_.back());
     data_.pop_back();
-    if (!empty()) {
-      downheap(get_root());
-    } else {
-      reset_root_cmp_cache();
+    reset_root_cmp_cache();
+    if (empty()) {
+      return;
+    }
+    // Sift the hole left by the root down to a leaf, promoting the larger
+    // child at each level -- one comparison per level instead of the two a
+    // top-down downheap needs.  The displaced back element then bubbles up
+    // from the leaf; since it came from the bottom of the heap it rarely
+    // moves more than a step, so pop() costs about logN comparisons total.
+    size_t index = get_root();
+    size_t child;
+    while ((child = get_left(index)) < data_.size()) {
+      const size_t right_child = child + 1;
+      if (right_child < data_.size() &&
+          cmp_(data_[child], data_[right_child])) {
+        child = right_child;
+      }
+      data_[index] = std::move(data_[child]);
+      index = child;
+    }
+    while (index > get_root()) {
+      const size_t parent = get_parent(index);
+      if (!cmp_(data_[parent], v)) {
+        break;
+      }
+      data_[index] = std::move(data_[parent]);
+      index = parent;
     }
+    data_[index] = std::move(v);
   }
 
   void swap(BinaryHeap& other) {
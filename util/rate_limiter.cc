@@ -128,6 +128,13 @@ void GenericRateLimiter::Request(int64_t bytes, const Env::IOPriority pri,
                            &rate_bytes_per_sec_);
   MutexLock g(&request_mutex_);
 
+  if (stop_) {
+    // It is now in the clean-up of ~GenericRateLimiter().
+    // Therefore any new incoming request will exit from here
+    // and not get satiesfied.
+    return;
+  }
+
   if (auto_tuned_) {
     static const int kRefillsPerTune = 100;
     std::chrono::microseconds now(NowMicrosMonotonicLocked());
@@ -138,13 +145,6 @@ void GenericRateLimiter::Request(int64_t bytes, const Env::IOPriority pri,
     }
   }
 
-  if (stop_) {
-    // It is now in the clean-up of ~GenericRateLimiter().
-    // Therefore any new incoming request will exit from here
-    // and not get satiesfied.
-    return;
-  }
-
   ++total_requests_[pri];
 
   if (available_bytes_ > 0) {
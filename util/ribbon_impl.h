@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include "port/port.h"  // for PREFETCH
@@ -492,13 +493,14 @@ class StandardBanding : public StandardHasher<TypesAndSettings> {
         }
         num_slots_allocated_ = num_slots;
       } else {
-        for (Index i = 0; i < num_slots; ++i) {
-          coeff_rows_[i] = 0;
-          if (!TypesAndSettings::kHomogeneous) {
-            // Note: don't strictly have to zero-init result_rows,
-            // except possible information leakage, etc ;)
-            result_rows_[i] = 0;
-          }
+        // Zero each array in one pass (lowers to memset) rather than with an
+        // interleaved element-by-element loop; this runs once per re-seed
+        // attempt over potentially hundreds of MBs.
+        std::fill_n(coeff_rows_.get(), num_slots, CoeffRow{0});
+        if (!TypesAndSettings::kHomogeneous) {
+          // Note: don't strictly have to zero-init result_rows,
+          // except possible information leakage, etc ;)
+          std::fill_n(result_rows_.get(), num_slots, ResultRow{0});
         }
       }
       num_starts_ = num_slots - kCoeffBits + 1;
@@ -46,6 +46,10 @@ static const char* msgs[static_cast<int>(Status::kMaxSubCode)] = {
     "IO fenced off",          // kIOFenced
     "Merge operator failed",  // kMergeOperatorFailed
     "Number of operands merged exceeded threshold",  // kMergeOperandThresholdExceeded
+    "No blocking I/O allowed in this read tier",  // kBlockingIoNotAllowed
+    "Write stall",                                // kWriteStall
+    "Key already exists with this sequence number",  // kKeySeqExists
+    "Too many internal keys skipped",  // kTooManyInternalKeysSkipped
 };
 
 Status::Status(Code _code, SubCode _subcode, const Slice& msg,
@@ -14,6 +14,7 @@
 #endif
 
 #ifdef OS_LINUX
+#include <sched.h>
 #include <sys/resource.h>
 #include <sys/syscall.h>
 #endif
@@ -59,6 +60,8 @@ struct ThreadPoolImpl::Impl {
 
   void LowerCPUPriority(CpuPriority pri);
 
+  Status SetCpuAffinity(const std::vector<int>& cpus);
+
   void WakeUpAllThreads() { bgsignal_.notify_all(); }
 
   void BGThread(size_t thread_id);
@@ -125,6 +128,11 @@ struct ThreadPoolImpl::Impl {
 
   bool low_io_priority_;
   CpuPriority cpu_priority_;
+  // CPUs the pool's threads are restricted to; empty means unrestricted.
+  // cpu_affinity_gen_ is bumped on every change so threads can detect a new
+  // setting before picking up their next job.
+  std::vector<int> cpu_affinity_;
+  uint64_t cpu_affinity_gen_;
   Env::Priority priority_;
   Env* env_;
 
@@ -161,6 +169,8 @@ struct ThreadPoolImpl::Impl {
 inline ThreadPoolImpl::Impl::Impl()
     : low_io_priority_(false),
       cpu_priority_(CpuPriority::kNormal),
+      cpu_affinity_(),
+      cpu_affinity_gen_(0),
       priority_(Env::LOW),
       env_(nullptr),
       total_threads_limit_(0),
@@ -212,9 +222,29 @@ inline void ThreadPoolImpl::Impl::LowerCPUPriority(CpuPriority pri) {
   cpu_priority_ = pri;
 }
 
+Status ThreadPoolImpl::Impl::SetCpuAffinity(const std::vector<int>& cpus) {
+#ifdef OS_LINUX
+  for (int cpu : cpus) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+      return Status::InvalidArgument("Invalid CPU id: " + std::to_string(cpu));
+    }
+  }
+  std::lock_guard<std::mutex> lock(mu_);
+  cpu_affinity_ = cpus;
+  ++cpu_affinity_gen_;
+  return Status::OK();
+#else
+  (void)cpus;
+  return Status::NotSupported("SetCpuAffinity is only supported on Linux");
+#endif
+}
+
 void ThreadPoolImpl::Impl::BGThread(size_t thread_id) {
   bool low_io_priority = false;
   CpuPriority current_cpu_priority = CpuPriority::kNormal;
+#ifdef OS_LINUX
+  uint64_t applied_affinity_gen = 0;
+#endif
 
   while (true) {
     // Wait until there is an item that is ready to run
@@ -270,6 +300,14 @@ void ThreadPoolImpl::Impl::BGThread(size_t thread_id) {
 
     bool decrease_io_priority = (low_io_priority != low_io_priority_);
     CpuPriority cpu_priority = cpu_priority_;
+#ifdef OS_LINUX
+    bool set_affinity = (applied_affinity_gen != cpu_affinity_gen_);
+    std::vector<int> cpu_affinity;
+    if (set_affinity) {
+      applied_affinity_gen = cpu_affinity_gen_;
+      cpu_affinity = cpu_affinity_;
+    }
+#endif
     lock.unlock();
 
     if (cpu_priority < current_cpu_priority) {
@@ -301,6 +339,24 @@ void ThreadPoolImpl::Impl::BGThread(size_t thread_id) {
               IOPRIO_PRIO_VALUE(3, 0));
       low_io_priority = true;
     }
+
+    if (set_affinity) {
+      cpu_set_t cpu_set;
+      CPU_ZERO(&cpu_set);
+      if (cpu_affinity.empty()) {
+        // Remove the restriction.
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+          CPU_SET(cpu, &cpu_set);
+        }
+      } else {
+        for (int cpu : cpu_affinity) {
+          CPU_SET(cpu, &cpu_set);
+        }
+      }
+      // 0 means current thread. On failure (e.g. none of the CPUs is
+      // online) the previous affinity stays in place.
+      sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+    }
 #else
     (void)decrease_io_priority;  // avoid 'unused variable' error
 #endif
@@ -401,26 +457,32 @@ void ThreadPoolImpl::Impl::StartBGThreads() {
 void ThreadPoolImpl::Impl::Submit(std::function<void()>&& schedule,
                                   std::function<void()>&& unschedule,
                                   void* tag) {
-  std::lock_guard<std::mutex> lock(mu_);
+  bool wake_all;
+  {
+    std::lock_guard<std::mutex> lock(mu_);
 
-  if (exit_all_threads_) {
-    return;
-  }
+    if (exit_all_threads_) {
+      return;
+    }
 
-  StartBGThreads();
+    StartBGThreads();
 
-  // Add to priority queue
-  queue_.push_back(BGItem());
-  TEST_SYNC_POINT("ThreadPoolImpl::Submit::Enqueue");
-  auto& item = queue_.back();
-  item.tag = tag;
-  item.function = std::move(schedule);
-  item.unschedFunction = std::move(unschedule);
+    // Add to priority queue
+    queue_.push_back(BGItem());
+    TEST_SYNC_POINT("ThreadPoolImpl::Submit::Enqueue");
+    auto& item = queue_.back();
+    item.tag = tag;
+    item.function = std::move(schedule);
+    item.unschedFunction = std::move(unschedule);
 
-  queue_len_.store(static_cast<unsigned int>(queue_.size()),
-                   std::memory_order_relaxed);
+    queue_len_.store(static_cast<unsigned int>(queue_.size()),
+                     std::memory_order_relaxed);
 
-  if (!HasExcessiveThread()) {
+    wake_all = HasExcessiveThread();
+  }
+  // Notify after releasing the mutex so the woken thread doesn't immediately
+  // block on a mutex the submitter still holds.
+  if (!wake_all) {
     // Wake up at least one waiting thread.
     bgsignal_.notify_one();
   } else {
@@ -490,6 +552,10 @@ void ThreadPoolImpl::LowerCPUPriority(CpuPriority pri) {
   impl_->LowerCPUPriority(pri);
 }
 
+Status ThreadPoolImpl::SetCpuAffinity(const std::vector<int>& cpus) {
+  return impl_->SetCpuAffinity(cpus);
+}
+
 void ThreadPoolImpl::IncBackgroundThreadsIfNeeded(int num) {
   impl_->SetBackgroundThreadsInternal(num, false);
 }
@@ -10,6 +10,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "rocksdb/env.h"
 #include "rocksdb/threadpool.h"
@@ -53,6 +54,13 @@ class ThreadPoolImpl : public ThreadPool {
   // Currently only has effect on Linux
   void LowerCPUPriority(CpuPriority pri);
 
+  // Restrict the pool's threads to the given set of CPUs, e.g. the CPUs of
+  // the NUMA node holding the DB's memtables and block cache so background
+  // work stays node-local. An empty set removes the restriction. The new
+  // affinity takes effect on each thread before it picks up its next job.
+  // Only has effect on Linux; returns NotSupported elsewhere.
+  Status SetCpuAffinity(const std::vector<int>& cpus);
+
   // Ensure there is at aleast num threads in the pool
   // but do not kill threads if there are more
   void IncBackgroundThreadsIfNeeded(int num);
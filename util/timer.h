@@ -66,8 +66,7 @@ class Timer {
     // the new task start time should never before the current task executing
     // time, as the executing task can only be running if it's next_run_time_us
     // is due (<= clock_->NowMicros()).
-    if (executing_task_ &&
-        fn_info->next_run_time_us < heap_.top()->next_run_time_us) {
+    if (executing_task_ && fn_info->next_run_time_us < executing_batch_due_us_) {
       return false;
     }
     auto it = map_.find(fn_name);
@@ -92,15 +91,15 @@ class Timer {
       it->second->Cancel();
     }
 
-    // If the currently running function is fn_name, then we need to wait
-    // until it finishes before returning to caller.
-    while (!heap_.empty() && executing_task_) {
-      FunctionInfo* func_info = heap_.top();
-      assert(func_info);
-      if (func_info->name == fn_name) {
-        WaitForTaskCompleteIfNecessary();
-      } else {
-        break;
+    // If fn_name is part of the currently running batch, then we need to
+    // wait until it finishes before returning to caller.
+    if (executing_task_) {
+      for (const FunctionInfo* func_info : executing_batch_) {
+        assert(func_info);
+        if (func_info->name == fn_name) {
+          WaitForTaskCompleteIfNecessary();
+          break;
+        }
       }
     }
   }
@@ -215,39 +214,58 @@ class Timer {
       }
 
       if (current_fn->next_run_time_us <= clock_->NowMicros()) {
-        // make a copy of the function so it won't be changed after
-        // mutex_.unlock.
-        std::function<void()> fn = current_fn->fn;
+        // Gather every function that is due at this wakeup and run them as
+        // one batch, so that N tasks aligned on the same tick (e.g. per-CF
+        // periodic work at coarse alignment) cost a single unlock/lock cycle
+        // and one round of signaling instead of N.
+        const uint64_t due_us = clock_->NowMicros();
+        assert(executing_batch_.empty());
+        std::vector<std::function<void()>> fns;
+        while (!heap_.empty() && heap_.top()->next_run_time_us <= due_us) {
+          FunctionInfo* fn_info = heap_.top();
+          // Note that we are just removing the pointer from the heap. Its
+          // memory is still managed in the map (as it holds a unique ptr).
+          // So fn_info is still a valid ptr.
+          heap_.pop();
+          if (!fn_info->IsValid()) {
+            map_.erase(fn_info->name);
+            continue;
+          }
+          // make a copy of the function so it won't be changed after
+          // mutex_.unlock.
+          fns.push_back(fn_info->fn);
+          executing_batch_.push_back(fn_info);
+        }
+        if (executing_batch_.empty()) {
+          continue;
+        }
+        executing_batch_due_us_ = due_us;
         executing_task_ = true;
         mutex_.Unlock();
         // Execute the work
-        fn();
+        for (auto& fn : fns) {
+          fn();
+        }
         mutex_.Lock();
         executing_task_ = false;
         cond_var_.SignalAll();
 
-        // Remove the work from the heap once it is done executing, make sure
-        // it's the same function after executing the work while mutex is
-        // released.
-        // Note that we are just removing the pointer from the heap. Its
-        // memory is still managed in the map (as it holds a unique ptr).
-        // So current_fn is still a valid ptr.
-        assert(heap_.top() == current_fn);
-        heap_.pop();
-
-        // current_fn may be cancelled already.
-        if (current_fn->IsValid() && current_fn->repeat_every_us > 0) {
-          assert(running_);
-          current_fn->next_run_time_us =
-              clock_->NowMicros() + current_fn->repeat_every_us;
-
-          // Schedule new work into the heap with new time.
-          heap_.push(current_fn);
-        } else {
-          // if current_fn is cancelled or no need to repeat, remove it from the
-          // map to avoid leak.
-          map_.erase(current_fn->name);
+        for (FunctionInfo* fn_info : executing_batch_) {
+          // fn_info may be cancelled while the batch was running.
+          if (fn_info->IsValid() && fn_info->repeat_every_us > 0) {
+            assert(running_);
+            fn_info->next_run_time_us =
+                clock_->NowMicros() + fn_info->repeat_every_us;
+
+            // Schedule new work into the heap with new time.
+            heap_.push(fn_info);
+          } else {
+            // if fn_info is cancelled or no need to repeat, remove it from
+            // the map to avoid leak.
+            map_.erase(fn_info->name);
+          }
         }
+        executing_batch_.clear();
       } else {
         cond_var_.TimedWait(current_fn->next_run_time_us);
       }
@@ -328,6 +346,11 @@ class Timer {
   std::unique_ptr<port::Thread> thread_;
   bool running_;
   bool executing_task_;
+  // The functions currently being executed as one batch (all due at the same
+  // wakeup), and the time at which the batch became due. Only non-empty while
+  // executing_task_ is true; entries are owned by map_.
+  std::vector<FunctionInfo*> executing_batch_;
+  uint64_t executing_batch_due_us_ = 0;
 
   std::priority_queue<FunctionInfo*, std::vector<FunctionInfo*>, RunTimeOrder>
       heap_;
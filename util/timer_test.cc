@@ -159,6 +159,46 @@ TEST_F(TimerTest, MultipleScheduleRepeatedly) {
   ASSERT_TRUE(timer.Shutdown());
 }
 
+TEST_F(TimerTest, BatchSameTickTasks) {
+  const int kInitDelayUs = 1 * kUsPerSec;
+  const int kRepeatUs = 1 * kUsPerSec;
+
+  Timer timer(mock_clock_.get());
+
+  int count1 = 0;
+  timer.Add([&] { count1++; }, "fn_sch_test1", kInitDelayUs, kRepeatUs);
+
+  int count2 = 0;
+  timer.Add([&] { count2++; }, "fn_sch_test2", kInitDelayUs, kRepeatUs);
+
+  int count3 = 0;
+  timer.Add([&] { count3++; }, "fn_sch_test3", kInitDelayUs, kRepeatUs);
+
+  ASSERT_TRUE(timer.Start());
+
+  // All three functions are due at the same tick, so a single wakeup runs
+  // them all as one batch.
+  timer.TEST_WaitForRun(
+      [&] { mock_clock_->SleepForMicroseconds(kInitDelayUs); });
+  ASSERT_EQ(1, count1);
+  ASSERT_EQ(1, count2);
+  ASSERT_EQ(1, count3);
+
+  timer.TEST_WaitForRun([&] { mock_clock_->SleepForMicroseconds(kRepeatUs); });
+  ASSERT_EQ(2, count1);
+  ASSERT_EQ(2, count2);
+  ASSERT_EQ(2, count3);
+
+  // Cancelling one batch member must not affect the others.
+  timer.Cancel("fn_sch_test2");
+  timer.TEST_WaitForRun([&] { mock_clock_->SleepForMicroseconds(kRepeatUs); });
+  ASSERT_EQ(3, count1);
+  ASSERT_EQ(2, count2);
+  ASSERT_EQ(3, count3);
+
+  ASSERT_TRUE(timer.Shutdown());
+}
+
 TEST_F(TimerTest, AddAfterStartTest) {
   const int kIterations = 5;
   const int kInitDelayUs = 1 * kUsPerSec;
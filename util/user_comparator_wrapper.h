@@ -10,11 +10,24 @@
 
 #include "monitoring/perf_context_imp.h"
 #include "rocksdb/comparator.h"
+#include "util/coding_lean.h"
+#include "util/math.h"
 
 namespace ROCKSDB_NAMESPACE {
 
 // Wrapper of user comparator, with auto increment to
 // perf_context.user_key_comparison_count.
+//
+// When the wrapped comparator is the built-in bytewise (or reverse bytewise)
+// singleton, comparisons bypass the virtual call and use the inlinable
+// Slice::compare directly. Key comparison is hot enough in the iterator and
+// memtable paths (everything funnels through InternalKeyComparator, which
+// holds one of these) that the virtual dispatch itself is measurable, and
+// the singleton check only needs to be done once at construction.
+//
+// Comparators that declare 16 byte fixed-width, memcmp-ordered keys via
+// Comparator::FixedKeyWidth() are additionally routed to a width-specialized
+// compare kernel, also selected once at construction.
 class UserComparatorWrapper {
  public:
   // `UserComparatorWrapper`s constructed with the default constructor are not
@@ -22,7 +35,11 @@ class UserComparatorWrapper {
   UserComparatorWrapper() : user_comparator_(nullptr) {}
 
   explicit UserComparatorWrapper(const Comparator* const user_cmp)
-      : user_comparator_(user_cmp) {}
+      : user_comparator_(user_cmp),
+        is_forward_bytewise_(user_cmp == BytewiseComparator()),
+        is_reverse_bytewise_(user_cmp == ReverseBytewiseComparator()),
+        is_fixed16_bytewise_(user_cmp->FixedKeyWidth() == 16 &&
+                             user_cmp->timestamp_size() == 0) {}
 
   ~UserComparatorWrapper() = default;
 
@@ -30,11 +47,23 @@ class UserComparatorWrapper {
 
   int Compare(const Slice& a, const Slice& b) const {
     PERF_COUNTER_ADD(user_key_comparison_count, 1);
+    if (is_fixed16_bytewise_) {
+      return CompareFixed16(a, b);
+    }
+    if (is_forward_bytewise_) {
+      return a.compare(b);
+    }
+    if (is_reverse_bytewise_) {
+      return b.compare(a);
+    }
     return user_comparator_->Compare(a, b);
   }
 
   bool Equal(const Slice& a, const Slice& b) const {
     PERF_COUNTER_ADD(user_key_comparison_count, 1);
+    if (is_forward_bytewise_ || is_reverse_bytewise_) {
+      return a == b;
+    }
     return user_comparator_->Equal(a, b);
   }
 
@@ -44,21 +73,66 @@ class UserComparatorWrapper {
 
   int CompareWithoutTimestamp(const Slice& a, const Slice& b) const {
     PERF_COUNTER_ADD(user_key_comparison_count, 1);
+    if (is_fixed16_bytewise_) {
+      // FixedKeyWidth() comparators are only recognized without timestamps,
+      // so this is the same comparison as Compare().
+      return CompareFixed16(a, b);
+    }
+    if (is_forward_bytewise_) {
+      return a.compare(b);
+    }
+    if (is_reverse_bytewise_) {
+      return b.compare(a);
+    }
     return user_comparator_->CompareWithoutTimestamp(a, b);
   }
 
   int CompareWithoutTimestamp(const Slice& a, bool a_has_ts, const Slice& b,
                               bool b_has_ts) const {
     PERF_COUNTER_ADD(user_key_comparison_count, 1);
+    if (is_forward_bytewise_ || is_reverse_bytewise_) {
+      // The built-in bytewise comparators have no timestamp.
+      assert(!a_has_ts && !b_has_ts);
+      return is_forward_bytewise_ ? a.compare(b) : b.compare(a);
+    }
     return user_comparator_->CompareWithoutTimestamp(a, a_has_ts, b, b_has_ts);
   }
 
   bool EqualWithoutTimestamp(const Slice& a, const Slice& b) const {
+    if (is_forward_bytewise_ || is_reverse_bytewise_) {
+      return a == b;
+    }
     return user_comparator_->EqualWithoutTimestamp(a, b);
   }
 
  private:
+  // Compare two 16 byte keys as two big-endian words each. For keys of a
+  // known fixed width this beats the length-generic libc memcmp: no call, no
+  // length dispatch, and the result is computed without byte loops.
+  static int CompareFixed16(const Slice& a, const Slice& b) {
+    assert(a.size() == 16 && b.size() == 16);
+    // DecodeFixed64 + EndianSwapValue yields the big-endian (lexicographic)
+    // interpretation of the bytes on both little- and big-endian platforms.
+    const uint64_t a0 = EndianSwapValue(DecodeFixed64(a.data()));
+    const uint64_t b0 = EndianSwapValue(DecodeFixed64(b.data()));
+    if (a0 != b0) {
+      return a0 < b0 ? -1 : 1;
+    }
+    const uint64_t a1 = EndianSwapValue(DecodeFixed64(a.data() + 8));
+    const uint64_t b1 = EndianSwapValue(DecodeFixed64(b.data() + 8));
+    if (a1 != b1) {
+      return a1 < b1 ? -1 : 1;
+    }
+    return 0;
+  }
+
   const Comparator* user_comparator_;
+  bool is_forward_bytewise_ = false;
+  bool is_reverse_bytewise_ = false;
+  // Set when the user comparator declares 16 byte fixed-width, memcmp-ordered
+  // keys via Comparator::FixedKeyWidth(). Evaluated once at construction so
+  // hot call sites dispatch straight to the specialized kernel.
+  bool is_fixed16_bytewise_ = false;
 };
 
 }  // namespace ROCKSDB_NAMESPACE
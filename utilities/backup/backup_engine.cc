@@ -595,6 +595,9 @@ class BackupEngineImpl {
   // @param contents If non-empty, the file will be created with these contents.
   // @param src_temperature Pass in expected temperature of src, return back
   // temperature reported by FileSystem
+  // @param io_buf Reusable copy buffer owned by the calling worker thread;
+  // (re)allocated here as needed so backups of many files don't pay a large
+  // allocation per file
   IOStatus CopyOrCreateFile(const std::string& src, const std::string& dst,
                             const std::string& contents, uint64_t size_limit,
                             Env* src_env, Env* dst_env,
@@ -604,7 +607,9 @@ class BackupEngineImpl {
                             Temperature* src_temperature,
                             Temperature dst_temperature,
                             uint64_t* bytes_toward_next_callback,
-                            uint64_t* size, std::string* checksum_hex);
+                            uint64_t* size, std::string* checksum_hex,
+                            std::unique_ptr<char[]>* io_buf,
+                            size_t* io_buf_size);
 
   uint64_t CalculateIOBufferSize(RateLimiter* rate_limiter) const;
 
@@ -1338,6 +1343,9 @@ IOStatus BackupEngineImpl::Initialize() {
       CpuPriority current_priority = CpuPriority::kNormal;
       WorkItem work_item;
       uint64_t bytes_toward_next_callback = 0;
+      // Copy buffer reused across this worker's files
+      std::unique_ptr<char[]> io_buf;
+      size_t io_buf_size = 0;
       while (work_items_.read(work_item)) {
         CpuPriority priority = threads_cpu_priority_;
         if (current_priority != priority) {
@@ -1361,7 +1369,8 @@ IOStatus BackupEngineImpl::Initialize() {
               work_item.size_limit, work_item.src_env, work_item.dst_env,
               work_item.src_env_options, work_item.sync, work_item.rate_limiter,
               work_item.progress_callback, &temp, work_item.dst_temperature,
-              &bytes_toward_next_callback, &result.size, &result.checksum_hex);
+              &bytes_toward_next_callback, &result.size, &result.checksum_hex,
+              &io_buf, &io_buf_size);
 
           RecordTick(work_item.stats, BACKUP_READ_BYTES,
                      IOSTATS(bytes_read) - prev_bytes_read);
@@ -2351,8 +2360,11 @@ IOStatus BackupEngineImpl::CopyOrCreateFile(
     const EnvOptions& src_env_options, bool sync, RateLimiter* rate_limiter,
     std::function<void()> progress_callback, Temperature* src_temperature,
     Temperature dst_temperature, uint64_t* bytes_toward_next_callback,
-    uint64_t* size, std::string* checksum_hex) {
+    uint64_t* size, std::string* checksum_hex, std::unique_ptr<char[]>* io_buf,
+    size_t* io_buf_size) {
   assert(src.empty() != contents.empty());
+  assert(io_buf != nullptr);
+  assert(io_buf_size != nullptr);
   IOStatus io_s;
   std::unique_ptr<FSWritableFile> dst_file;
   std::unique_ptr<FSSequentialFile> src_file;
@@ -2396,14 +2408,16 @@ IOStatus BackupEngineImpl::CopyOrCreateFile(
   std::unique_ptr<WritableFileWriter> dest_writer(
       new WritableFileWriter(std::move(dst_file), dst, dst_file_options));
   std::unique_ptr<SequentialFileReader> src_reader;
-  std::unique_ptr<char[]> buf;
   if (!src.empty()) {
     // Return back current temperature in FileSystem
     *src_temperature = src_file->GetTemperature();
 
     src_reader.reset(new SequentialFileReader(
         std::move(src_file), src, nullptr /* io_tracer */, {}, rate_limiter));
-    buf.reset(new char[buf_size]);
+    if (*io_buf == nullptr || *io_buf_size < buf_size) {
+      io_buf->reset(new char[buf_size]);
+      *io_buf_size = buf_size;
+    }
   }
 
   Slice data;
@@ -2415,7 +2429,7 @@ IOStatus BackupEngineImpl::CopyOrCreateFile(
     if (!src.empty()) {
       size_t buffer_to_read =
           (buf_size < size_limit) ? buf_size : static_cast<size_t>(size_limit);
-      io_s = src_reader->Read(buffer_to_read, &data, buf.get(),
+      io_s = src_reader->Read(buffer_to_read, &data, io_buf->get(),
                               Env::IO_LOW /* rate_limiter_priority */);
       *bytes_toward_next_callback += data.size();
     } else {
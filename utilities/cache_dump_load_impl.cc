@@ -254,8 +254,6 @@ IOStatus CacheDumperImpl::WriteFooter() {
 // First, we check if all the arguments are valid. Then, we read the block
 // sequentially from the reader and insert them to the secondary cache.
 IOStatus CacheDumpedLoaderImpl::RestoreCacheEntriesToSecondaryCache() {
-  // TODO: remove this line when options are used in the loader
-  (void)options_;
   // Step 1: we check if all the arguments are valid
   if (secondary_cache_ == nullptr) {
     return IOStatus::InvalidArgument("Secondary Cache is null");
@@ -263,6 +261,10 @@ IOStatus CacheDumpedLoaderImpl::RestoreCacheEntriesToSecondaryCache() {
   if (reader_ == nullptr) {
     return IOStatus::InvalidArgument("CacheDumpReader is null");
   }
+  if (options_.deadline.count() > 0 && options_.clock == nullptr) {
+    return IOStatus::InvalidArgument("System clock is null");
+  }
+  uint64_t loaded_size_bytes = 0;
 
   // Step 2: read the header
   // TODO: we need to check the cache dump format version and RocksDB version
@@ -276,8 +278,20 @@ IOStatus CacheDumpedLoaderImpl::RestoreCacheEntriesToSecondaryCache() {
   }
 
   // Step 3: read out the rest of the blocks from the reader. The loop will stop
-  // either I/O status is not ok or we reach to the the end.
+  // either I/O status is not ok or we reach to the the end. A load deadline or
+  // size limit in the options bounds how long a cache warm-up can delay DB
+  // open; hitting either limit ends the load successfully with a partially
+  // warmed cache.
   while (io_s.ok()) {
+    if (options_.max_size_bytes > 0 &&
+        loaded_size_bytes > options_.max_size_bytes) {
+      return IOStatus::OK();
+    }
+    if (options_.deadline.count() > 0 &&
+        std::chrono::microseconds(options_.clock->NowMicros()) >=
+            options_.deadline) {
+      return IOStatus::OK();
+    }
     dump_unit.reset();
     data.clear();
     // read the content and store in the dump_unit
@@ -295,6 +309,8 @@ IOStatus CacheDumpedLoaderImpl::RestoreCacheEntriesToSecondaryCache() {
     Status s = secondary_cache_->InsertSaved(dump_unit.key, content);
     if (!s.ok()) {
       io_s = status_to_io_status(std::move(s));
+    } else {
+      loaded_size_bytes += dump_unit.value_len;
     }
   }
   if (dump_unit.type == CacheDumpUnitType::kFooter) {
@@ -0,0 +1,131 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "utilities/cache_scrubber.h"
+
+#include <cassert>
+
+#include "rocksdb/system_clock.h"
+#include "util/hash.h"
+#include "util/mutexlock.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+CacheScrubber::CacheScrubber(std::shared_ptr<Cache> cache)
+    : cache_(std::move(cache)), cv_(&mu_) {
+  assert(cache_ != nullptr);
+}
+
+CacheScrubber::~CacheScrubber() { Stop(); }
+
+void CacheScrubber::ScrubOnce(SweepResults* results) {
+  SweepResults sweep;
+  for (auto& kv : baselines_) {
+    kv.second.seen = false;
+  }
+  std::string buf;
+  auto callback = [&](const Slice& key, Cache::ObjectPtr obj, size_t /*charge*/,
+                      const Cache::CacheItemHelper* helper) {
+    ++sweep.entries_scanned;
+    if (helper == nullptr || helper->size_cb == nullptr ||
+        helper->saveto_cb == nullptr || obj == nullptr) {
+      // Placeholder or otherwise opaque entry; nothing to verify.
+      return;
+    }
+    // Hash the persistable bytes while the shard lock protects the object.
+    size_t len = helper->size_cb(obj);
+    buf.assign(len, '\0');
+    Status s = helper->saveto_cb(obj, /*from_offset=*/0, len, buf.data());
+    if (!s.ok()) {
+      return;
+    }
+    uint64_t hash = GetSliceHash64(Slice(buf.data(), len));
+    auto it = baselines_.find(key.ToString());
+    if (it != baselines_.end() && it->second.obj == obj) {
+      it->second.seen = true;
+      ++sweep.entries_verified;
+      if (it->second.hash != hash) {
+        ++sweep.mismatches;
+        // Re-baseline so one corrupted entry is not reported on every
+        // subsequent sweep.
+        it->second.hash = hash;
+      }
+    } else {
+      EntryBaseline& baseline = baselines_[key.ToString()];
+      baseline.obj = obj;
+      baseline.hash = hash;
+      baseline.seen = true;
+      ++sweep.entries_baselined;
+    }
+  };
+  Cache::ApplyToAllEntriesOptions opts;
+  // Keep shard lock hold times short; hashing entry bytes is much more
+  // expensive than the usual per-entry callbacks.
+  opts.average_entries_per_lock = 16;
+  cache_->ApplyToAllEntries(callback, opts);
+  // Forget entries that were evicted since the previous sweep.
+  for (auto it = baselines_.begin(); it != baselines_.end();) {
+    if (!it->second.seen) {
+      it = baselines_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  total_mismatches_.fetch_add(sweep.mismatches, std::memory_order_relaxed);
+  if (results != nullptr) {
+    *results = sweep;
+  }
+}
+
+Status CacheScrubber::Start(uint64_t period_sec) {
+  if (period_sec == 0) {
+    return Status::InvalidArgument("period_sec must be positive");
+  }
+  MutexLock l(&mu_);
+  if (bg_thread_) {
+    return Status::Busy("scrubber already started");
+  }
+  shutting_down_ = false;
+  bg_thread_.reset(
+      new port::Thread(&CacheScrubber::BackgroundLoop, this, period_sec));
+  return Status::OK();
+}
+
+void CacheScrubber::Stop() {
+  std::unique_ptr<port::Thread> thread;
+  {
+    MutexLock l(&mu_);
+    if (!bg_thread_) {
+      return;
+    }
+    shutting_down_ = true;
+    cv_.SignalAll();
+    thread = std::move(bg_thread_);
+  }
+  thread->join();
+}
+
+uint64_t CacheScrubber::TotalMismatches() const {
+  return total_mismatches_.load(std::memory_order_relaxed);
+}
+
+void CacheScrubber::BackgroundLoop(uint64_t period_sec) {
+  SystemClock* clock = SystemClock::Default().get();
+  for (;;) {
+    {
+      MutexLock l(&mu_);
+      uint64_t deadline_us = clock->NowMicros() + period_sec * 1000000U;
+      while (!shutting_down_ && clock->NowMicros() < deadline_us) {
+        cv_.TimedWait(deadline_us);
+      }
+      if (shutting_down_) {
+        return;
+      }
+    }
+    ScrubOnce(/*results=*/nullptr);
+  }
+}
+
+}  // namespace ROCKSDB_NAMESPACE
@@ -0,0 +1,107 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "port/port.h"
+#include "rocksdb/advanced_cache.h"
+#include "rocksdb/status.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+// CacheScrubber re-verifies long-resident cache entries at a configurable
+// cadence to detect in-memory corruption ("bit rot") of blocks that stay in
+// the block cache for hours or days. Block checksums are verified once when
+// a block is read from disk; the parsed in-memory representation does not
+// retain the on-disk checksum, so the scrubber self-baselines: the first
+// time it sees an entry it records a hash of the entry's persistable bytes
+// (obtained through the entry's CacheItemHelper, the same mechanism used by
+// cache dumping), and on later sweeps it recomputes the hash for entries
+// still resident and counts mismatches. A mismatch for an unchanged entry
+// (same key and same object pointer) indicates the cached bytes were
+// modified in memory after insertion.
+//
+// Entries whose helpers do not support byte extraction (no size_cb /
+// saveto_cb, e.g. placeholder reservations) are skipped. Sweeps use
+// Cache::ApplyToAllEntries with a small average_entries_per_lock so shard
+// locks are not held for long; hashing happens inside the callback because
+// the object may be freed once the shard lock is released.
+//
+// Thread safety: ScrubOnce() must not be called concurrently with itself or
+// with Start()/Stop(). The background mode started by Start() runs sweeps
+// on a dedicated thread until Stop() or destruction.
+class CacheScrubber {
+ public:
+  struct SweepResults {
+    // Entries visited by the sweep, including unsupported ones.
+    size_t entries_scanned = 0;
+    // Entries whose hash was compared against a baseline from an earlier
+    // sweep.
+    size_t entries_verified = 0;
+    // Entries seen for the first time; a baseline hash was recorded.
+    size_t entries_baselined = 0;
+    // Entries whose recomputed hash did not match the baseline.
+    size_t mismatches = 0;
+  };
+
+  explicit CacheScrubber(std::shared_ptr<Cache> cache);
+
+  // Stops the background thread, if running.
+  ~CacheScrubber();
+
+  // No copying
+  CacheScrubber(const CacheScrubber&) = delete;
+  CacheScrubber& operator=(const CacheScrubber&) = delete;
+
+  // Performs one full sweep over the cache. Baselines new entries, verifies
+  // previously seen ones, and forgets entries that are no longer resident.
+  // `results`, if non-null, receives counts for this sweep.
+  void ScrubOnce(SweepResults* results);
+
+  // Starts a background thread that sweeps the cache every `period_sec`
+  // seconds. Returns InvalidArgument for a zero period and Busy if already
+  // started.
+  Status Start(uint64_t period_sec);
+
+  // Stops the background thread started by Start(). Blocks until the thread
+  // exits; a no-op when not started.
+  void Stop();
+
+  // Total mismatches detected over the lifetime of this scrubber, across
+  // ScrubOnce() calls and background sweeps.
+  uint64_t TotalMismatches() const;
+
+ private:
+  // Baseline recorded the first time an entry is seen. The object pointer
+  // distinguishes re-insertions under the same key from entries that stayed
+  // resident between sweeps.
+  struct EntryBaseline {
+    const void* obj = nullptr;
+    uint64_t hash = 0;
+    // Cleared before each sweep; entries not marked were evicted and are
+    // forgotten afterwards.
+    bool seen = false;
+  };
+
+  void BackgroundLoop(uint64_t period_sec);
+
+  std::shared_ptr<Cache> cache_;
+  std::unordered_map<std::string, EntryBaseline> baselines_;
+  std::atomic<uint64_t> total_mismatches_{0};
+
+  // Protects the background thread state below.
+  mutable port::Mutex mu_;
+  port::CondVar cv_;
+  bool shutting_down_ = false;
+  std::unique_ptr<port::Thread> bg_thread_;
+};
+
+}  // namespace ROCKSDB_NAMESPACE
@@ -0,0 +1,223 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "utilities/options_tuner.h"
+
+#include <cinttypes>
+#include <cstdio>
+
+#include "logging/logging.h"
+#include "rocksdb/convenience.h"
+#include "rocksdb/system_clock.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+std::string OptionsTrialResult::ToString() const {
+  char buf[512];
+  snprintf(buf, sizeof(buf),
+           "decision: %s (%s); "
+           "read_avg_us %.2f -> %.2f (%" PRIu64 " -> %" PRIu64
+           " ops); "
+           "write_avg_us %.2f -> %.2f (%" PRIu64 " -> %" PRIu64
+           " ops); "
+           "write_amp %.2f -> %.2f",
+           kept ? "kept" : "reverted", reason.c_str(),
+           baseline.read_latency_avg_us, trial.read_latency_avg_us,
+           baseline.read_ops, trial.read_ops, baseline.write_latency_avg_us,
+           trial.write_latency_avg_us, baseline.write_ops, trial.write_ops,
+           baseline.write_amp, trial.write_amp);
+  return std::string(buf);
+}
+
+OptionsTuner::OptionsTuner(DB* db, ColumnFamilyHandle* cfh,
+                           std::shared_ptr<OptionsTunerListener> listener)
+    : db_(db),
+      cfh_(cfh != nullptr ? cfh : db->DefaultColumnFamily()),
+      stats_(db->GetDBOptions().statistics),
+      listener_(std::move(listener)) {}
+
+OptionsTuner::StatsSnapshot OptionsTuner::Snapshot() const {
+  StatsSnapshot snap;
+  stats_->histogramData(DB_GET, &snap.get);
+  stats_->histogramData(DB_WRITE, &snap.write);
+  snap.user_bytes = stats_->getTickerCount(BYTES_WRITTEN);
+  snap.bg_bytes = stats_->getTickerCount(FLUSH_WRITE_BYTES) +
+                  stats_->getTickerCount(COMPACT_WRITE_BYTES);
+  return snap;
+}
+
+OptionsTrialMetrics OptionsTuner::WindowMetrics(const StatsSnapshot& begin,
+                                                const StatsSnapshot& end) {
+  OptionsTrialMetrics metrics;
+  metrics.read_ops = end.get.count - begin.get.count;
+  if (metrics.read_ops > 0) {
+    metrics.read_latency_avg_us =
+        static_cast<double>(end.get.sum - begin.get.sum) / metrics.read_ops;
+  }
+  metrics.write_ops = end.write.count - begin.write.count;
+  if (metrics.write_ops > 0) {
+    metrics.write_latency_avg_us =
+        static_cast<double>(end.write.sum - begin.write.sum) /
+        metrics.write_ops;
+  }
+  uint64_t user_bytes = end.user_bytes - begin.user_bytes;
+  if (user_bytes > 0) {
+    metrics.write_amp =
+        static_cast<double>(end.bg_bytes - begin.bg_bytes) / user_bytes;
+  }
+  return metrics;
+}
+
+Status OptionsTuner::CaptureRevertValues(
+    const OptionsTrialConfig& config,
+    std::unordered_map<std::string, std::string>* revert_cf_options,
+    std::unordered_map<std::string, std::string>* revert_db_options) const {
+  if (!config.candidate_cf_options.empty()) {
+    std::string opts_str;
+    Status s =
+        GetStringFromColumnFamilyOptions(&opts_str, db_->GetOptions(cfh_));
+    if (!s.ok()) {
+      return s;
+    }
+    std::unordered_map<std::string, std::string> current;
+    s = StringToMap(opts_str, &current);
+    if (!s.ok()) {
+      return s;
+    }
+    for (const auto& candidate : config.candidate_cf_options) {
+      auto it = current.find(candidate.first);
+      if (it == current.end()) {
+        return Status::InvalidArgument(
+            "Cannot capture current value of CF option for revert: " +
+            candidate.first);
+      }
+      (*revert_cf_options)[candidate.first] = it->second;
+    }
+  }
+  if (!config.candidate_db_options.empty()) {
+    std::string opts_str;
+    Status s = GetStringFromDBOptions(&opts_str, db_->GetDBOptions());
+    if (!s.ok()) {
+      return s;
+    }
+    std::unordered_map<std::string, std::string> current;
+    s = StringToMap(opts_str, &current);
+    if (!s.ok()) {
+      return s;
+    }
+    for (const auto& candidate : config.candidate_db_options) {
+      auto it = current.find(candidate.first);
+      if (it == current.end()) {
+        return Status::InvalidArgument(
+            "Cannot capture current value of DB option for revert: " +
+            candidate.first);
+      }
+      (*revert_db_options)[candidate.first] = it->second;
+    }
+  }
+  return Status::OK();
+}
+
+Status OptionsTuner::RunTrial(const OptionsTrialConfig& config,
+                              OptionsTrialResult* result) {
+  if (stats_ == nullptr) {
+    return Status::InvalidArgument(
+        "OptionsTuner requires DBOptions::statistics");
+  }
+  if (config.candidate_cf_options.empty() &&
+      config.candidate_db_options.empty()) {
+    return Status::InvalidArgument("Empty candidate option set");
+  }
+
+  // Capture revert values before touching anything so a failure here leaves
+  // the DB untouched. This also rejects unknown option names up front.
+  std::unordered_map<std::string, std::string> revert_cf_options;
+  std::unordered_map<std::string, std::string> revert_db_options;
+  Status s = CaptureRevertValues(config, &revert_cf_options,
+                                 &revert_db_options);
+  if (!s.ok()) {
+    return s;
+  }
+
+  SystemClock* clock = db_->GetEnv()->GetSystemClock().get();
+
+  // Baseline window.
+  StatsSnapshot before = Snapshot();
+  clock->SleepForMicroseconds(static_cast<int>(config.window_us));
+  StatsSnapshot mid = Snapshot();
+
+  // Apply the candidate.
+  if (!config.candidate_cf_options.empty()) {
+    s = db_->SetOptions(cfh_, config.candidate_cf_options);
+    if (!s.ok()) {
+      return s;
+    }
+  }
+  if (!config.candidate_db_options.empty()) {
+    s = db_->SetDBOptions(config.candidate_db_options);
+    if (!s.ok()) {
+      // Restore the CF options that were already applied.
+      if (!config.candidate_cf_options.empty()) {
+        db_->SetOptions(cfh_, revert_cf_options).PermitUncheckedError();
+      }
+      return s;
+    }
+  }
+
+  // Trial window.
+  clock->SleepForMicroseconds(static_cast<int>(config.window_us));
+  StatsSnapshot after = Snapshot();
+
+  OptionsTrialResult local_result;
+  local_result.baseline = WindowMetrics(before, mid);
+  local_result.trial = WindowMetrics(mid, after);
+
+  // A metric is only compared when both windows saw traffic for it; an idle
+  // window carries no signal.
+  const double limit = 1.0 + config.max_regression_pct / 100.0;
+  const OptionsTrialMetrics& b = local_result.baseline;
+  const OptionsTrialMetrics& t = local_result.trial;
+  std::string regressed;
+  if (b.read_ops > 0 && t.read_ops > 0 &&
+      t.read_latency_avg_us > b.read_latency_avg_us * limit) {
+    regressed = "read latency";
+  } else if (b.write_ops > 0 && t.write_ops > 0 &&
+             t.write_latency_avg_us > b.write_latency_avg_us * limit) {
+    regressed = "write latency";
+  } else if (b.write_amp > 0 && t.write_amp > b.write_amp * limit) {
+    regressed = "write amplification";
+  }
+
+  if (regressed.empty()) {
+    local_result.kept = true;
+    local_result.reason = "no regression beyond tolerance";
+  } else {
+    local_result.kept = false;
+    local_result.reason = regressed + " regressed beyond tolerance";
+    if (!config.candidate_cf_options.empty()) {
+      s = db_->SetOptions(cfh_, revert_cf_options);
+    }
+    if (s.ok() && !config.candidate_db_options.empty()) {
+      s = db_->SetDBOptions(revert_db_options);
+    }
+    if (!s.ok()) {
+      // The candidate is (partially) still applied; surface the failure
+      // rather than reporting a clean revert.
+      return s;
+    }
+  }
+
+  ROCKS_LOG_INFO(db_->GetDBOptions().info_log, "OptionsTuner trial %s",
+                 local_result.ToString().c_str());
+  if (listener_) {
+    listener_->OnOptionsTrialFinished(local_result);
+  }
+  if (result != nullptr) {
+    *result = local_result;
+  }
+  return Status::OK();
+}
+
+}  // namespace ROCKSDB_NAMESPACE
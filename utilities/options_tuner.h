@@ -0,0 +1,127 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "rocksdb/db.h"
+#include "rocksdb/statistics.h"
+#include "rocksdb/status.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+// Configuration for one guarded options trial. See OptionsTuner.
+struct OptionsTrialConfig {
+  // Mutable column family options to try, in the form accepted by
+  // DB::SetOptions().
+  std::unordered_map<std::string, std::string> candidate_cf_options;
+
+  // Mutable DB options to try, in the form accepted by DB::SetDBOptions().
+  std::unordered_map<std::string, std::string> candidate_db_options;
+
+  // Length of the baseline window measured before the candidate is applied,
+  // and of the trial window measured after. Default 10 minutes.
+  uint64_t window_us = 600ULL * 1000 * 1000;
+
+  // Maximum tolerated regression, in percent, of mean read latency, mean
+  // write latency and write amplification during the trial window relative
+  // to the baseline window. If any measured metric exceeds its baseline by
+  // more than this, the candidate is reverted. Negative values demand an
+  // improvement (e.g. -20 reverts unless the trial is at least 20% better).
+  double max_regression_pct = 10.0;
+};
+
+// Performance of one measurement window, derived from the deltas of the
+// DB's Statistics object over the window.
+struct OptionsTrialMetrics {
+  // Mean DB::Get / write latency in microseconds over the window. Only
+  // meaningful when the corresponding op count is non-zero.
+  double read_latency_avg_us = 0.0;
+  double write_latency_avg_us = 0.0;
+  // (flush + compaction bytes written) / user bytes written. 0 when no user
+  // bytes were written in the window.
+  double write_amp = 0.0;
+  uint64_t read_ops = 0;
+  uint64_t write_ops = 0;
+};
+
+// Outcome of one trial: whether the candidate was kept, why, and the
+// measurements the decision was based on.
+struct OptionsTrialResult {
+  bool kept = false;
+  std::string reason;
+  OptionsTrialMetrics baseline;
+  OptionsTrialMetrics trial;
+
+  std::string ToString() const;
+};
+
+// Receives the decision of each finished trial. Invoked on the thread
+// running the trial, after the candidate has been kept or reverted.
+class OptionsTunerListener {
+ public:
+  virtual ~OptionsTunerListener() {}
+
+  virtual void OnOptionsTrialFinished(const OptionsTrialResult& result) = 0;
+};
+
+// OptionsTuner guards DB::SetOptions()/DB::SetDBOptions() behind a measured
+// A/B trial: it measures a baseline window, applies the candidate options,
+// measures a trial window of the same length, and automatically reverts the
+// candidate if read latency, write latency or write amplification regressed
+// beyond the configured tolerance. The decision is logged to the DB's info
+// log and reported through an optional OptionsTunerListener.
+//
+// Measurements come from the DB's Statistics object (DB_GET and DB_WRITE
+// histograms, BYTES_WRITTEN / FLUSH_WRITE_BYTES / COMPACT_WRITE_BYTES
+// tickers), so `DBOptions::statistics` must be set. Metrics with no traffic
+// in either window are not compared; a completely idle trial therefore
+// keeps the candidate. Windowed mean latencies are used rather than
+// percentiles because cumulative histograms cannot be differenced at a
+// given percentile.
+//
+// RunTrial() blocks the calling thread for two windows and must not be
+// called concurrently on the same OptionsTuner.
+class OptionsTuner {
+ public:
+  // `cfh` may be nullptr to tune the default column family. `listener` may
+  // be nullptr.
+  OptionsTuner(DB* db, ColumnFamilyHandle* cfh,
+               std::shared_ptr<OptionsTunerListener> listener = nullptr);
+
+  // Runs one guarded trial. Returns non-OK and changes nothing if the
+  // candidate contains options that cannot be captured for revert or fail
+  // to apply; returns OK with result->kept indicating the decision
+  // otherwise. `result` may be nullptr.
+  Status RunTrial(const OptionsTrialConfig& config, OptionsTrialResult* result);
+
+ private:
+  struct StatsSnapshot {
+    HistogramData get;
+    HistogramData write;
+    uint64_t user_bytes = 0;
+    uint64_t bg_bytes = 0;
+  };
+
+  StatsSnapshot Snapshot() const;
+  static OptionsTrialMetrics WindowMetrics(const StatsSnapshot& begin,
+                                           const StatsSnapshot& end);
+  // Captures the current values of the candidate's keys so they can be
+  // restored on revert.
+  Status CaptureRevertValues(
+      const OptionsTrialConfig& config,
+      std::unordered_map<std::string, std::string>* revert_cf_options,
+      std::unordered_map<std::string, std::string>* revert_db_options) const;
+
+  DB* const db_;
+  ColumnFamilyHandle* const cfh_;
+  std::shared_ptr<Statistics> stats_;
+  std::shared_ptr<OptionsTunerListener> listener_;
+};
+
+}  // namespace ROCKSDB_NAMESPACE
@@ -0,0 +1,213 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "utilities/path_routing_fs.h"
+
+#include <algorithm>
+
+namespace ROCKSDB_NAMESPACE {
+
+namespace {
+
+// Remembers which FileSystem issued a lock so UnlockFile() can release it on
+// the same instance.
+class RoutedFileLock : public FileLock {
+ public:
+  RoutedFileLock(FileLock* target, FileSystem* fs) : target_(target), fs_(fs) {}
+
+  FileLock* target() const { return target_; }
+  FileSystem* fs() const { return fs_; }
+
+ private:
+  FileLock* target_;
+  FileSystem* fs_;
+};
+
+}  // namespace
+
+PathRoutingFileSystem::PathRoutingFileSystem(
+    const std::shared_ptr<FileSystem>& base,
+    std::vector<std::pair<std::string, std::shared_ptr<FileSystem>>> routes)
+    : FileSystemWrapper(base), routes_(std::move(routes)) {
+  std::stable_sort(routes_.begin(), routes_.end(),
+                   [](const auto& a, const auto& b) {
+                     return a.first.size() > b.first.size();
+                   });
+}
+
+FileSystem* PathRoutingFileSystem::Route(const std::string& path) const {
+  for (const auto& route : routes_) {
+    const std::string& prefix = route.first;
+    if (path.size() >= prefix.size() &&
+        path.compare(0, prefix.size(), prefix) == 0) {
+      return route.second.get();
+    }
+  }
+  return target();
+}
+
+IOStatus PathRoutingFileSystem::NewSequentialFile(
+    const std::string& fname, const FileOptions& options,
+    std::unique_ptr<FSSequentialFile>* result, IODebugContext* dbg) {
+  return Route(fname)->NewSequentialFile(fname, options, result, dbg);
+}
+
+IOStatus PathRoutingFileSystem::NewRandomAccessFile(
+    const std::string& fname, const FileOptions& options,
+    std::unique_ptr<FSRandomAccessFile>* result, IODebugContext* dbg) {
+  return Route(fname)->NewRandomAccessFile(fname, options, result, dbg);
+}
+
+IOStatus PathRoutingFileSystem::NewWritableFile(
+    const std::string& fname, const FileOptions& options,
+    std::unique_ptr<FSWritableFile>* result, IODebugContext* dbg) {
+  return Route(fname)->NewWritableFile(fname, options, result, dbg);
+}
+
+IOStatus PathRoutingFileSystem::ReopenWritableFile(
+    const std::string& fname, const FileOptions& options,
+    std::unique_ptr<FSWritableFile>* result, IODebugContext* dbg) {
+  return Route(fname)->ReopenWritableFile(fname, options, result, dbg);
+}
+
+IOStatus PathRoutingFileSystem::ReuseWritableFile(
+    const std::string& fname, const std::string& old_fname,
+    const FileOptions& options, std::unique_ptr<FSWritableFile>* result,
+    IODebugContext* dbg) {
+  return Route(fname)->ReuseWritableFile(fname, old_fname, options, result,
+                                         dbg);
+}
+
+IOStatus PathRoutingFileSystem::NewRandomRWFile(
+    const std::string& fname, const FileOptions& options,
+    std::unique_ptr<FSRandomRWFile>* result, IODebugContext* dbg) {
+  return Route(fname)->NewRandomRWFile(fname, options, result, dbg);
+}
+
+IOStatus PathRoutingFileSystem::NewDirectory(
+    const std::string& name, const IOOptions& options,
+    std::unique_ptr<FSDirectory>* result, IODebugContext* dbg) {
+  return Route(name)->NewDirectory(name, options, result, dbg);
+}
+
+IOStatus PathRoutingFileSystem::FileExists(const std::string& fname,
+                                           const IOOptions& options,
+                                           IODebugContext* dbg) {
+  return Route(fname)->FileExists(fname, options, dbg);
+}
+
+IOStatus PathRoutingFileSystem::GetChildren(const std::string& dir,
+                                            const IOOptions& options,
+                                            std::vector<std::string>* result,
+                                            IODebugContext* dbg) {
+  return Route(dir)->GetChildren(dir, options, result, dbg);
+}
+
+IOStatus PathRoutingFileSystem::GetChildrenFileAttributes(
+    const std::string& dir, const IOOptions& options,
+    std::vector<FileAttributes>* result, IODebugContext* dbg) {
+  return Route(dir)->GetChildrenFileAttributes(dir, options, result, dbg);
+}
+
+IOStatus PathRoutingFileSystem::DeleteFile(const std::string& fname,
+                                           const IOOptions& options,
+                                           IODebugContext* dbg) {
+  return Route(fname)->DeleteFile(fname, options, dbg);
+}
+
+IOStatus PathRoutingFileSystem::Truncate(const std::string& fname, size_t size,
+                                         const IOOptions& options,
+                                         IODebugContext* dbg) {
+  return Route(fname)->Truncate(fname, size, options, dbg);
+}
+
+IOStatus PathRoutingFileSystem::CreateDir(const std::string& dirname,
+                                          const IOOptions& options,
+                                          IODebugContext* dbg) {
+  return Route(dirname)->CreateDir(dirname, options, dbg);
+}
+
+IOStatus PathRoutingFileSystem::CreateDirIfMissing(const std::string& dirname,
+                                                   const IOOptions& options,
+                                                   IODebugContext* dbg) {
+  return Route(dirname)->CreateDirIfMissing(dirname, options, dbg);
+}
+
+IOStatus PathRoutingFileSystem::DeleteDir(const std::string& dirname,
+                                          const IOOptions& options,
+                                          IODebugContext* dbg) {
+  return Route(dirname)->DeleteDir(dirname, options, dbg);
+}
+
+IOStatus PathRoutingFileSystem::GetFileSize(const std::string& fname,
+                                            const IOOptions& options,
+                                            uint64_t* file_size,
+                                            IODebugContext* dbg) {
+  return Route(fname)->GetFileSize(fname, options, file_size, dbg);
+}
+
+IOStatus PathRoutingFileSystem::GetFileModificationTime(
+    const std::string& fname, const IOOptions& options, uint64_t* file_mtime,
+    IODebugContext* dbg) {
+  return Route(fname)->GetFileModificationTime(fname, options, file_mtime, dbg);
+}
+
+IOStatus PathRoutingFileSystem::RenameFile(const std::string& src,
+                                           const std::string& dst,
+                                           const IOOptions& options,
+                                           IODebugContext* dbg) {
+  return Route(src)->RenameFile(src, dst, options, dbg);
+}
+
+IOStatus PathRoutingFileSystem::LinkFile(const std::string& src,
+                                         const std::string& dst,
+                                         const IOOptions& options,
+                                         IODebugContext* dbg) {
+  return Route(src)->LinkFile(src, dst, options, dbg);
+}
+
+IOStatus PathRoutingFileSystem::LockFile(const std::string& fname,
+                                         const IOOptions& options,
+                                         FileLock** lock, IODebugContext* dbg) {
+  FileSystem* fs = Route(fname);
+  FileLock* target_lock = nullptr;
+  IOStatus s = fs->LockFile(fname, options, &target_lock, dbg);
+  if (s.ok()) {
+    *lock = new RoutedFileLock(target_lock, fs);
+  }
+  return s;
+}
+
+IOStatus PathRoutingFileSystem::UnlockFile(FileLock* lock,
+                                           const IOOptions& options,
+                                           IODebugContext* dbg) {
+  auto* routed_lock = static_cast<RoutedFileLock*>(lock);
+  IOStatus s = routed_lock->fs()->UnlockFile(routed_lock->target(), options,
+                                             dbg);
+  delete routed_lock;
+  return s;
+}
+
+IOStatus PathRoutingFileSystem::GetFreeSpace(const std::string& path,
+                                             const IOOptions& options,
+                                             uint64_t* diskfree,
+                                             IODebugContext* dbg) {
+  return Route(path)->GetFreeSpace(path, options, diskfree, dbg);
+}
+
+IOStatus PathRoutingFileSystem::IsDirectory(const std::string& path,
+                                            const IOOptions& options,
+                                            bool* is_dir, IODebugContext* dbg) {
+  return Route(path)->IsDirectory(path, options, is_dir, dbg);
+}
+
+IOStatus PathRoutingFileSystem::NewLogger(const std::string& fname,
+                                          const IOOptions& options,
+                                          std::shared_ptr<Logger>* result,
+                                          IODebugContext* dbg) {
+  return Route(fname)->NewLogger(fname, options, result, dbg);
+}
+
+}  // namespace ROCKSDB_NAMESPACE
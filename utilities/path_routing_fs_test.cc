@@ -0,0 +1,85 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "utilities/path_routing_fs.h"
+
+#include <memory>
+
+#include "env/mock_env.h"
+#include "rocksdb/system_clock.h"
+#include "test_util/testharness.h"
+#include "utilities/counted_fs.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+class PathRoutingFileSystemTest : public testing::Test {};
+
+TEST_F(PathRoutingFileSystemTest, RoutesByLongestPrefix) {
+  std::shared_ptr<FileSystem> mem_fs =
+      std::make_shared<MockFileSystem>(SystemClock::Default());
+  auto base = std::make_shared<CountedFileSystem>(mem_fs);
+  auto wal_fs = std::make_shared<CountedFileSystem>(mem_fs);
+  auto cold_fs = std::make_shared<CountedFileSystem>(mem_fs);
+
+  PathRoutingFileSystem fs(base, {{"/mnt/wal/", wal_fs},
+                                  {"/mnt/", cold_fs}});
+
+  const IOOptions io_opts;
+  const FileOptions file_opts;
+  ASSERT_OK(fs.CreateDirIfMissing("/mnt/wal", io_opts, nullptr));
+  ASSERT_OK(fs.CreateDirIfMissing("/mnt/cold", io_opts, nullptr));
+  ASSERT_OK(fs.CreateDirIfMissing("/db", io_opts, nullptr));
+
+  std::unique_ptr<FSWritableFile> file;
+  // Longest matching prefix wins over the shorter "/mnt/" route.
+  ASSERT_OK(fs.NewWritableFile("/mnt/wal/000001.log", file_opts, &file,
+                               nullptr));
+  file.reset();
+  ASSERT_EQ(1, wal_fs->counters()->opens);
+  ASSERT_EQ(0, cold_fs->counters()->opens);
+
+  ASSERT_OK(fs.NewWritableFile("/mnt/cold/000002.sst", file_opts, &file,
+                               nullptr));
+  file.reset();
+  ASSERT_EQ(1, cold_fs->counters()->opens);
+
+  // Paths matching no route go to the base FileSystem.
+  ASSERT_OK(fs.NewWritableFile("/db/MANIFEST-000003", file_opts, &file,
+                               nullptr));
+  file.reset();
+  ASSERT_EQ(1, wal_fs->counters()->opens);
+  ASSERT_EQ(1, cold_fs->counters()->opens);
+  ASSERT_GT(base->counters()->opens, 0);
+
+  // Deletes route the same way as creates.
+  ASSERT_OK(fs.DeleteFile("/mnt/wal/000001.log", io_opts, nullptr));
+  ASSERT_EQ(1, wal_fs->counters()->deletes);
+  ASSERT_EQ(0, cold_fs->counters()->deletes);
+}
+
+TEST_F(PathRoutingFileSystemTest, LockRoutesAndUnlocks) {
+  std::shared_ptr<FileSystem> mem_fs =
+      std::make_shared<MockFileSystem>(SystemClock::Default());
+  auto base = std::make_shared<CountedFileSystem>(mem_fs);
+  auto routed = std::make_shared<CountedFileSystem>(mem_fs);
+
+  PathRoutingFileSystem fs(base, {{"/routed/", routed}});
+
+  const IOOptions io_opts;
+  ASSERT_OK(fs.CreateDirIfMissing("/routed", io_opts, nullptr));
+  FileLock* lock = nullptr;
+  ASSERT_OK(fs.LockFile("/routed/LOCK", io_opts, &lock, nullptr));
+  ASSERT_NE(nullptr, lock);
+  // The unlock must reach the FileSystem that issued the lock.
+  ASSERT_OK(fs.UnlockFile(lock, io_opts, nullptr));
+}
+
+}  // namespace ROCKSDB_NAMESPACE
+
+int main(int argc, char** argv) {
+  ROCKSDB_NAMESPACE::port::InstallStackTraceHandler();
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
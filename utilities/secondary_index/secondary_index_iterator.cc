@@ -3,7 +3,10 @@
 //  COPYING file in the root directory) and Apache 2.0 License
 //  (found in the LICENSE.Apache file in the root directory).
 
+#include "db/wide/wide_columns_helper.h"
+#include "rocksdb/db.h"
 #include "rocksdb/utilities/secondary_index.h"
+#include "rocksdb/wide_columns.h"
 #include "utilities/secondary_index/secondary_index_helper.h"
 
 namespace ROCKSDB_NAMESPACE {
@@ -15,6 +18,18 @@ SecondaryIndexIterator::SecondaryIndexIterator(
   assert(underlying_it_);
 }
 
+SecondaryIndexIterator::SecondaryIndexIterator(
+    const SecondaryIndex* index, std::unique_ptr<Iterator>&& underlying_it,
+    DB* db, const ReadOptions& read_options)
+    : index_(index),
+      underlying_it_(std::move(underlying_it)),
+      db_(db),
+      read_options_(read_options) {
+  assert(index_);
+  assert(underlying_it_);
+  assert(db_);
+}
+
 bool SecondaryIndexIterator::Valid() const {
   return status_.ok() && underlying_it_->Valid() &&
          underlying_it_->key().starts_with(prefix_);
@@ -44,18 +59,104 @@ void SecondaryIndexIterator::Seek(const Slice& target) {
   // FIXME: this works for BytewiseComparator but not for all comparators in
   // general
   underlying_it_->Seek(prefix_);
+
+  if (db_) {
+    SkipStaleEntries(/* forward */ true);
+  }
 }
 
 void SecondaryIndexIterator::Next() {
   assert(Valid());
 
   underlying_it_->Next();
+
+  if (db_) {
+    SkipStaleEntries(/* forward */ true);
+  }
 }
 
 void SecondaryIndexIterator::Prev() {
   assert(Valid());
 
   underlying_it_->Prev();
+
+  if (db_) {
+    SkipStaleEntries(/* forward */ false);
+  }
+}
+
+Status SecondaryIndexIterator::CheckEntryUpToDate(bool* up_to_date) const {
+  assert(db_);
+  assert(up_to_date);
+
+  *up_to_date = false;
+
+  Slice primary_key = underlying_it_->key();
+  primary_key.remove_prefix(prefix_.size());
+
+  PinnableWideColumns primary_columns;
+
+  {
+    const Status s =
+        db_->GetEntity(read_options_, index_->GetPrimaryColumnFamily(),
+                       primary_key, &primary_columns);
+    if (!s.ok()) {
+      // A missing primary entry means the index entry is stale
+      return s.IsNotFound() ? Status::OK() : s;
+    }
+  }
+
+  const WideColumns& columns = primary_columns.columns();
+  const auto it = WideColumnsHelper::Find(columns.cbegin(), columns.cend(),
+                                          index_->GetPrimaryColumnName());
+  if (it == columns.cend()) {
+    return Status::OK();
+  }
+
+  std::variant<Slice, std::string> secondary_key_prefix;
+
+  {
+    const Status s = index_->GetSecondaryKeyPrefix(primary_key, it->value(),
+                                                   &secondary_key_prefix);
+    if (!s.ok()) {
+      return s;
+    }
+  }
+
+  {
+    const Status s = index_->FinalizeSecondaryKeyPrefix(&secondary_key_prefix);
+    if (!s.ok()) {
+      return s;
+    }
+  }
+
+  *up_to_date =
+      SecondaryIndexHelper::AsSlice(secondary_key_prefix) == Slice(prefix_);
+
+  return Status::OK();
+}
+
+void SecondaryIndexIterator::SkipStaleEntries(bool forward) {
+  while (status_.ok() && underlying_it_->Valid() &&
+         underlying_it_->key().starts_with(prefix_)) {
+    bool up_to_date = false;
+
+    const Status s = CheckEntryUpToDate(&up_to_date);
+    if (!s.ok()) {
+      status_ = s;
+      return;
+    }
+
+    if (up_to_date) {
+      return;
+    }
+
+    if (forward) {
+      underlying_it_->Next();
+    } else {
+      underlying_it_->Prev();
+    }
+  }
 }
 
 bool SecondaryIndexIterator::PrepareValue() {
@@ -257,25 +257,53 @@ class SecondaryIndexMixin : public Txn {
   }
 
   Status AddPrimaryEntry(ColumnFamilyHandle* column_family,
-                         const Slice& primary_key, const Slice& primary_value) {
+                         const Slice& primary_key, const Slice& primary_value,
+                         bool assume_tracked) {
     assert(column_family);
 
-    constexpr bool assume_tracked = true;
-
     return Txn::Put(column_family, primary_key, primary_value, assume_tracked);
   }
 
   Status AddPrimaryEntry(ColumnFamilyHandle* column_family,
                          const Slice& primary_key,
-                         const WideColumns& primary_columns) {
+                         const WideColumns& primary_columns,
+                         bool assume_tracked) {
     assert(column_family);
 
-    constexpr bool assume_tracked = true;
-
     return Txn::PutEntity(column_family, primary_key, primary_columns,
                           assume_tracked);
   }
 
+  Status AddPrimaryEntryUntracked(ColumnFamilyHandle* column_family,
+                                  const Slice& primary_key,
+                                  const Slice& primary_value) {
+    assert(column_family);
+
+    return Txn::PutUntracked(column_family, primary_key, primary_value);
+  }
+
+  Status AddPrimaryEntryUntracked(ColumnFamilyHandle* column_family,
+                                  const Slice& primary_key,
+                                  const WideColumns& primary_columns) {
+    assert(column_family);
+
+    return Txn::PutEntityUntracked(column_family, primary_key,
+                                   primary_columns);
+  }
+
+  bool HasEagerIndexOnColumnFamily(ColumnFamilyHandle* column_family) const {
+    for (const auto& secondary_index : *secondary_indices_) {
+      assert(secondary_index);
+
+      if (secondary_index->GetPrimaryColumnFamily() == column_family &&
+          !secondary_index->IsLazilyMaintained()) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
   Status AddSecondaryEntry(const SecondaryIndex* secondary_index,
                            const Slice& primary_key,
                            const Slice& primary_column_value,
@@ -341,6 +369,12 @@ class SecondaryIndexMixin : public Txn {
         continue;
       }
 
+      if (secondary_index->IsLazilyMaintained()) {
+        // Stale entries for the previous primary column value are left
+        // behind and filtered out at query time
+        continue;
+      }
+
       const auto it = WideColumnsHelper::Find(
           existing_columns.cbegin(), existing_columns.cend(),
           secondary_index->GetPrimaryColumnName());
@@ -469,7 +503,13 @@ class SecondaryIndexMixin : public Txn {
 
     const Slice& primary_key = key;
 
-    {
+    // With only lazily maintained indices on this column family, the
+    // existing primary entry does not have to be read and its secondary
+    // entries do not have to be removed, so the write path performs no
+    // point lookup
+    const bool has_eager_indices = HasEagerIndexOnColumnFamily(column_family);
+
+    if (has_eager_indices) {
       PinnableWideColumns existing_primary_columns;
 
       const Status s = GetPrimaryEntryForUpdate(
@@ -500,8 +540,25 @@ class SecondaryIndexMixin : public Txn {
     }
 
     {
-      const Status s =
-          AddPrimaryEntry(column_family, primary_key, primary_value_or_columns);
+      // GetPrimaryEntryForUpdate has already tracked the key, so the primary
+      // write can assume so. When the lookup was skipped, the key is not
+      // tracked: a validating caller gets a regular tracked write, while a
+      // do_validate=false caller (e.g. PutUntracked) gets a genuinely
+      // untracked write, since claiming an untracked key is tracked is
+      // rejected by the transaction.
+      Status s;
+      if (has_eager_indices) {
+        constexpr bool assume_tracked = true;
+        s = AddPrimaryEntry(column_family, primary_key,
+                            primary_value_or_columns, assume_tracked);
+      } else if (do_validate) {
+        constexpr bool assume_tracked = false;
+        s = AddPrimaryEntry(column_family, primary_key,
+                            primary_value_or_columns, assume_tracked);
+      } else {
+        s = AddPrimaryEntryUntracked(column_family, primary_key,
+                                     primary_value_or_columns);
+      }
       if (!s.ok()) {
         return s;
       }
@@ -531,15 +588,20 @@ class SecondaryIndexMixin : public Txn {
                                        do_validate);
   }
 
-  template <typename Operation>
-  Status DeleteWithSecondaryIndicesImpl(ColumnFamilyHandle* column_family,
-                                        const Slice& key, bool do_validate,
-                                        Operation&& operation) {
+  template <typename Operation, typename UntrackedOperation>
+  Status DeleteWithSecondaryIndicesImpl(
+      ColumnFamilyHandle* column_family, const Slice& key, bool do_validate,
+      Operation&& operation, UntrackedOperation&& untracked_operation) {
     if (!column_family) {
       column_family = Txn::DefaultColumnFamily();
     }
 
-    {
+    // With only lazily maintained indices on this column family, the
+    // existing primary entry does not have to be read and its secondary
+    // entries are left to be filtered out at query time
+    const bool has_eager_indices = HasEagerIndexOnColumnFamily(column_family);
+
+    if (has_eager_indices) {
       PinnableWideColumns existing_primary_columns;
 
       const Status s = GetPrimaryEntryForUpdate(
@@ -560,7 +622,22 @@ class SecondaryIndexMixin : public Txn {
     }
 
     {
-      const Status s = operation(column_family, key);
+      // GetPrimaryEntryForUpdate has already tracked the key, so the primary
+      // write can assume so. When the lookup was skipped, the key is not
+      // tracked: a validating caller gets a regular tracked write, while a
+      // do_validate=false caller (e.g. DeleteUntracked) gets a genuinely
+      // untracked write, since claiming an untracked key is tracked is
+      // rejected by the transaction.
+      Status s;
+      if (has_eager_indices) {
+        constexpr bool assume_tracked = true;
+        s = operation(column_family, key, assume_tracked);
+      } else if (do_validate) {
+        constexpr bool assume_tracked = false;
+        s = operation(column_family, key, assume_tracked);
+      } else {
+        s = untracked_operation(column_family, key);
+      }
       if (!s.ok()) {
         return s;
       }
@@ -573,12 +650,16 @@ class SecondaryIndexMixin : public Txn {
                                     const Slice& key, bool do_validate) {
     return DeleteWithSecondaryIndicesImpl(
         column_family, key, do_validate,
-        [&](ColumnFamilyHandle* cfh, const Slice& primary_key) {
+        [&](ColumnFamilyHandle* cfh, const Slice& primary_key,
+            bool assume_tracked) {
           assert(cfh);
 
-          constexpr bool assume_tracked = true;
-
           return Txn::Delete(cfh, primary_key, assume_tracked);
+        },
+        [&](ColumnFamilyHandle* cfh, const Slice& primary_key) {
+          assert(cfh);
+
+          return Txn::DeleteUntracked(cfh, primary_key);
         });
   }
 
@@ -586,12 +667,16 @@ class SecondaryIndexMixin : public Txn {
                                           const Slice& key, bool do_validate) {
     return DeleteWithSecondaryIndicesImpl(
         column_family, key, do_validate,
-        [&](ColumnFamilyHandle* cfh, const Slice& primary_key) {
+        [&](ColumnFamilyHandle* cfh, const Slice& primary_key,
+            bool assume_tracked) {
           assert(cfh);
 
-          constexpr bool assume_tracked = true;
-
           return Txn::SingleDelete(cfh, primary_key, assume_tracked);
+        },
+        [&](ColumnFamilyHandle* cfh, const Slice& primary_key) {
+          assert(cfh);
+
+          return Txn::SingleDeleteUntracked(cfh, primary_key);
         });
   }
 
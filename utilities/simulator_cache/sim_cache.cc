@@ -150,12 +150,22 @@ class SimCacheImpl : public SimCache {
  public:
   // capacity for real cache (ShardedLRUCache)
   // test_capacity for key only cache
-  SimCacheImpl(std::shared_ptr<Cache> sim_cache, std::shared_ptr<Cache> cache)
+  // extra_shadow_caches are additional key-only caches (typically with
+  // different capacities than sim_cache) tracked alongside the primary one to
+  // produce a miss-ratio curve; they do not affect the hit/miss counters or
+  // the SIM_BLOCK_CACHE_* tickers.
+  SimCacheImpl(std::shared_ptr<Cache> sim_cache, std::shared_ptr<Cache> cache,
+               std::vector<std::shared_ptr<Cache>> extra_shadow_caches = {})
       : SimCache(cache),
         key_only_cache_(sim_cache),
         miss_times_(0),
         hit_times_(0),
-        stats_(nullptr) {}
+        stats_(nullptr) {
+    shadow_caches_.reserve(extra_shadow_caches.size());
+    for (auto& shadow_cache : extra_shadow_caches) {
+      shadow_caches_.emplace_back(new ShadowCache(std::move(shadow_cache)));
+    }
+  }
 
   ~SimCacheImpl() override = default;
 
@@ -187,6 +197,18 @@ class SimCacheImpl : public SimCache {
       key_only_cache_->Release(h);
     }
 
+    for (auto& shadow : shadow_caches_) {
+      Handle* sh = shadow->cache->Lookup(key);
+      if (sh == nullptr) {
+        auto s =
+            shadow->cache->Insert(key, nullptr, &kNoopCacheItemHelper, charge,
+                                  nullptr, priority, compressed, type);
+        s.PermitUncheckedError();
+      } else {
+        shadow->cache->Release(sh);
+      }
+    }
+
     cache_activity_logger_.ReportAdd(key, charge);
     if (!target_) {
       return Status::OK();
@@ -223,6 +245,9 @@ class SimCacheImpl : public SimCache {
   void Erase(const Slice& key) override {
     target_->Erase(key);
     key_only_cache_->Erase(key);
+    for (auto& shadow : shadow_caches_) {
+      shadow->cache->Erase(key);
+    }
   }
 
   Cache::ObjectPtr Value(Handle* handle) override {
@@ -256,6 +281,9 @@ class SimCacheImpl : public SimCache {
   void DisownData() override {
     target_->DisownData();
     key_only_cache_->DisownData();
+    for (auto& shadow : shadow_caches_) {
+      shadow->cache->DisownData();
+    }
   }
 
   void ApplyToAllEntries(
@@ -268,6 +296,9 @@ class SimCacheImpl : public SimCache {
   void EraseUnRefEntries() override {
     target_->EraseUnRefEntries();
     key_only_cache_->EraseUnRefEntries();
+    for (auto& shadow : shadow_caches_) {
+      shadow->cache->EraseUnRefEntries();
+    }
   }
 
   size_t GetSimCapacity() const override {
@@ -291,6 +322,10 @@ class SimCacheImpl : public SimCache {
     hit_times_.store(0, std::memory_order_relaxed);
     SetTickerCount(stats_, SIM_BLOCK_CACHE_HIT, 0);
     SetTickerCount(stats_, SIM_BLOCK_CACHE_MISS, 0);
+    for (auto& shadow : shadow_caches_) {
+      shadow->miss_times.store(0, std::memory_order_relaxed);
+      shadow->hit_times.store(0, std::memory_order_relaxed);
+    }
   }
 
   std::string ToString() const override {
@@ -301,6 +336,23 @@ class SimCacheImpl : public SimCache {
     oss << "SimCache HITRATE: " << std::fixed << std::setprecision(2)
         << (lookups == 0 ? 0 : get_hit_counter() * 100.0f / lookups)
         << std::endl;
+    // Miss-ratio curve: hit rate at each simulated capacity, the primary
+    // simulated capacity first.
+    if (!shadow_caches_.empty()) {
+      oss << "SimCache HITRATE @ " << GetSimCapacity() << " bytes: "
+          << std::fixed << std::setprecision(2)
+          << (lookups == 0 ? 0 : get_hit_counter() * 100.0f / lookups)
+          << std::endl;
+      for (auto& shadow : shadow_caches_) {
+        uint64_t hits = shadow->hit_times.load(std::memory_order_relaxed);
+        uint64_t misses = shadow->miss_times.load(std::memory_order_relaxed);
+        uint64_t shadow_lookups = hits + misses;
+        oss << "SimCache HITRATE @ " << shadow->cache->GetCapacity()
+            << " bytes: " << std::fixed << std::setprecision(2)
+            << (shadow_lookups == 0 ? 0 : hits * 100.0f / shadow_lookups)
+            << std::endl;
+      }
+    }
     return oss.str();
   }
 
@@ -326,7 +378,17 @@ class SimCacheImpl : public SimCache {
   }
 
  private:
+  // A key-only cache simulating an alternative capacity, with its own hit and
+  // miss counters.
+  struct ShadowCache {
+    explicit ShadowCache(std::shared_ptr<Cache> c) : cache(std::move(c)) {}
+    std::shared_ptr<Cache> cache;
+    std::atomic<uint64_t> hit_times{0};
+    std::atomic<uint64_t> miss_times{0};
+  };
+
   std::shared_ptr<Cache> key_only_cache_;
+  std::vector<std::unique_ptr<ShadowCache>> shadow_caches_;
   std::atomic<uint64_t> miss_times_;
   std::atomic<uint64_t> hit_times_;
   Statistics* stats_;
@@ -347,6 +409,15 @@ class SimCacheImpl : public SimCache {
       inc_miss_counter();
       RecordTick(stats, SIM_BLOCK_CACHE_MISS);
     }
+    for (auto& shadow : shadow_caches_) {
+      Handle* sh = shadow->cache->Lookup(key);
+      if (sh != nullptr) {
+        shadow->cache->Release(sh);
+        shadow->hit_times.fetch_add(1, std::memory_order_relaxed);
+      } else {
+        shadow->miss_times.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
     cache_activity_logger_.ReportLookup(key);
   }
 };
@@ -372,4 +443,28 @@ std::shared_ptr<SimCache> NewSimCache(std::shared_ptr<Cache> sim_cache,
   return std::make_shared<SimCacheImpl>(sim_cache, cache);
 }
 
+std::shared_ptr<SimCache> NewSimCache(std::shared_ptr<Cache> cache,
+                                      const std::vector<size_t>& sim_capacities,
+                                      int num_shard_bits) {
+  if (sim_capacities.empty()) {
+    return nullptr;
+  }
+  if (num_shard_bits >= 20) {
+    return nullptr;  // the cache cannot be sharded into too many fine pieces
+  }
+  LRUCacheOptions co;
+  co.num_shard_bits = num_shard_bits;
+  co.metadata_charge_policy = kDontChargeCacheMetadata;
+  co.capacity = sim_capacities[0];
+  std::shared_ptr<Cache> primary = NewLRUCache(co);
+  std::vector<std::shared_ptr<Cache>> extra_shadow_caches;
+  extra_shadow_caches.reserve(sim_capacities.size() - 1);
+  for (size_t i = 1; i < sim_capacities.size(); ++i) {
+    co.capacity = sim_capacities[i];
+    extra_shadow_caches.push_back(NewLRUCache(co));
+  }
+  return std::make_shared<SimCacheImpl>(primary, cache,
+                                        std::move(extra_shadow_caches));
+}
+
 }  // namespace ROCKSDB_NAMESPACE
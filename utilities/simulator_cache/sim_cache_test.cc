@@ -146,6 +146,51 @@ TEST_F(SimCacheTest, SimCache) {
   ASSERT_EQ(6, simCache->get_hit_counter());
 }
 
+TEST_F(SimCacheTest, MissRatioCurve) {
+  ReadOptions read_options;
+  auto table_options = GetTableOptions();
+  auto options = GetOptions(table_options);
+  InitTable(options);
+
+  // No simulated capacities is an invalid configuration.
+  ASSERT_EQ(nullptr, NewSimCache(NewLRUCache(1024), std::vector<size_t>(), 0));
+
+  // Simulate 0.5x, 1x, 2x and 4x of a 20000-byte cache.
+  const std::vector<size_t> sim_capacities{20000, 10000, 40000, 80000};
+  std::shared_ptr<SimCache> simCache =
+      NewSimCache(NewLRUCache(1024 /* capacity */), sim_capacities, 0);
+  ASSERT_NE(nullptr, simCache);
+  ASSERT_EQ(sim_capacities[0], simCache->GetSimCapacity());
+
+  table_options.block_cache = simCache;
+  options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+  Reopen(options);
+
+  for (size_t i = 0; i < kNumBlocks; i++) {
+    std::unique_ptr<Iterator> it(db_->NewIterator(read_options));
+    it->Seek(std::to_string(i));
+    ASSERT_OK(it->status());
+  }
+  for (size_t i = 0; i < kNumBlocks; i++) {
+    std::unique_ptr<Iterator> it(db_->NewIterator(read_options));
+    it->Seek(std::to_string(i));
+    ASSERT_OK(it->status());
+  }
+  ASSERT_GT(simCache->get_hit_counter(), 0);
+
+  // The report covers all simulated capacities.
+  std::string report = simCache->ToString();
+  for (size_t sim_capacity : sim_capacities) {
+    std::ostringstream oss;
+    oss << "HITRATE @ " << sim_capacity << " bytes";
+    ASSERT_NE(report.find(oss.str()), std::string::npos) << report;
+  }
+
+  simCache->reset_counter();
+  ASSERT_EQ(0, simCache->get_hit_counter());
+  ASSERT_EQ(0, simCache->get_miss_counter());
+}
+
 TEST_F(SimCacheTest, SimCacheLogging) {
   auto table_options = GetTableOptions();
   auto options = GetOptions(table_options);
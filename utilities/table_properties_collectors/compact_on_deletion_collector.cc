@@ -214,6 +214,17 @@ static int RegisterTablePropertiesCollectorFactories(
         guard->reset(new CompactForTieringCollectorFactory(0));
         return guard->get();
       });
+  library.AddFactory<TablePropertiesCollectorFactory>(
+      CompactOnLongMergeChainCollectorFactory::kClassName(),
+      [](const std::string& /*uri*/,
+         std::unique_ptr<TablePropertiesCollectorFactory>* guard,
+         std::string* /* errmsg */) {
+        // By default, create a `CompactOnLongMergeChainCollectorFactory` that
+        // is disabled. Users will need to provide configuration parameters or
+        // call the corresponding setter to enable the factory.
+        guard->reset(new CompactOnLongMergeChainCollectorFactory(0));
+        return guard->get();
+      });
   return 1;
 }
 }  // namespace
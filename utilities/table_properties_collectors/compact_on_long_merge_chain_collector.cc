@@ -0,0 +1,129 @@
+//  Copyright (c) 2011-present, Facebook, Inc.  All rights reserved.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "utilities/table_properties_collectors/compact_on_long_merge_chain_collector.h"
+
+#include <sstream>
+
+#include "rocksdb/utilities/options_type.h"
+#include "rocksdb/utilities/table_properties_collectors.h"
+#include "util/string_util.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+const std::string
+    CompactOnLongMergeChainCollector::kMaxMergeChainLengthPropertyName =
+        "rocksdb.max.merge.chain.length";
+
+CompactOnLongMergeChainCollector::CompactOnLongMergeChainCollector(
+    size_t merge_chain_length_trigger)
+    : merge_chain_length_trigger_(merge_chain_length_trigger) {}
+
+Status CompactOnLongMergeChainCollector::AddUserKey(const Slice& key,
+                                                    const Slice& /*value*/,
+                                                    EntryType type,
+                                                    SequenceNumber /*seq*/,
+                                                    uint64_t /*file_size*/) {
+  assert(!finish_called_);
+  if (merge_chain_length_trigger_ == 0) {
+    // This collector is disabled.
+    return Status::OK();
+  }
+
+  if (type != kEntryMerge) {
+    // Any other entry type (a base value, a tombstone, ...) ends the chain of
+    // merge operands for the current key.
+    current_chain_key_.clear();
+    current_chain_length_ = 0;
+    return Status::OK();
+  }
+
+  if (current_chain_length_ > 0 && key == current_chain_key_) {
+    ++current_chain_length_;
+  } else {
+    current_chain_key_.assign(key.data(), key.size());
+    current_chain_length_ = 1;
+  }
+  if (current_chain_length_ > max_chain_length_) {
+    max_chain_length_ = current_chain_length_;
+    if (max_chain_length_ >= merge_chain_length_trigger_) {
+      need_compaction_ = true;
+    }
+  }
+  return Status::OK();
+}
+
+Status CompactOnLongMergeChainCollector::Finish(
+    UserCollectedProperties* properties) {
+  assert(!finish_called_);
+  finish_called_ = true;
+  if (merge_chain_length_trigger_ == 0) {
+    return Status::OK();
+  }
+  assert(properties);
+  *properties = GetReadableProperties();
+  return Status::OK();
+}
+
+UserCollectedProperties
+CompactOnLongMergeChainCollector::GetReadableProperties() const {
+  if (merge_chain_length_trigger_ == 0) {
+    return UserCollectedProperties();
+  }
+  return UserCollectedProperties{
+      {kMaxMergeChainLengthPropertyName, std::to_string(max_chain_length_)}};
+}
+
+static std::unordered_map<std::string, OptionTypeInfo>
+    on_long_merge_chain_type_info = {
+        {"merge_chain_length_trigger",
+         {0, OptionType::kUnknown, OptionVerificationType::kNormal,
+          OptionTypeFlags::kCompareNever | OptionTypeFlags::kMutable,
+          [](const ConfigOptions&, const std::string&, const std::string& value,
+             void* addr) {
+            auto* factory =
+                static_cast<CompactOnLongMergeChainCollectorFactory*>(addr);
+            factory->SetMergeChainLengthTrigger(ParseSizeT(value));
+            return Status::OK();
+          },
+          [](const ConfigOptions&, const std::string&, const void* addr,
+             std::string* value) {
+            const auto* factory =
+                static_cast<const CompactOnLongMergeChainCollectorFactory*>(
+                    addr);
+            *value = std::to_string(factory->GetMergeChainLengthTrigger());
+            return Status::OK();
+          },
+          nullptr}},
+
+};
+
+CompactOnLongMergeChainCollectorFactory::
+    CompactOnLongMergeChainCollectorFactory(size_t merge_chain_length_trigger)
+    : merge_chain_length_trigger_(merge_chain_length_trigger) {
+  RegisterOptions("", this, &on_long_merge_chain_type_info);
+}
+
+TablePropertiesCollector*
+CompactOnLongMergeChainCollectorFactory::CreateTablePropertiesCollector(
+    TablePropertiesCollectorFactory::Context /*context*/) {
+  return new CompactOnLongMergeChainCollector(
+      merge_chain_length_trigger_.load());
+}
+
+std::string CompactOnLongMergeChainCollectorFactory::ToString() const {
+  std::ostringstream cfg;
+  cfg << Name() << " (Merge chain length trigger = "
+      << merge_chain_length_trigger_.load() << ')';
+  return cfg.str();
+}
+
+std::shared_ptr<CompactOnLongMergeChainCollectorFactory>
+NewCompactOnLongMergeChainCollectorFactory(size_t merge_chain_length_trigger) {
+  return std::make_shared<CompactOnLongMergeChainCollectorFactory>(
+      merge_chain_length_trigger);
+}
+
+}  // namespace ROCKSDB_NAMESPACE
@@ -0,0 +1,47 @@
+//  Copyright (c) 2011-present, Facebook, Inc.  All rights reserved.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#pragma once
+
+#include <string>
+
+#include "rocksdb/utilities/table_properties_collectors.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+// A user property collector that marks a SST file as need-compaction when it
+// observes a long chain of merge operands for a single key. See documentation
+// for `CompactOnLongMergeChainCollectorFactory`.
+class CompactOnLongMergeChainCollector : public TablePropertiesCollector {
+ public:
+  static const std::string kMaxMergeChainLengthPropertyName;
+
+  explicit CompactOnLongMergeChainCollector(size_t merge_chain_length_trigger);
+
+  Status AddUserKey(const Slice& key, const Slice& value, EntryType type,
+                    SequenceNumber seq, uint64_t file_size) override;
+
+  Status Finish(UserCollectedProperties* properties) override;
+
+  UserCollectedProperties GetReadableProperties() const override;
+
+  const char* Name() const override {
+    return "CompactOnLongMergeChainCollector";
+  }
+
+  bool NeedCompact() const override { return need_compaction_; }
+
+ private:
+  size_t merge_chain_length_trigger_;
+  // The user key of the most recently observed merge entry, and the number of
+  // consecutive merge entries seen for it so far. Entries are added in key
+  // order, so all merge operands of one user key are observed back to back.
+  std::string current_chain_key_;
+  size_t current_chain_length_ = 0;
+  size_t max_chain_length_ = 0;
+  bool finish_called_ = false;
+  bool need_compaction_ = false;
+};
+}  // namespace ROCKSDB_NAMESPACE
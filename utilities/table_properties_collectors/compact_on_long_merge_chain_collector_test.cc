@@ -0,0 +1,104 @@
+//  Copyright (c) 2011-present, Facebook, Inc.  All rights reserved.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "utilities/table_properties_collectors/compact_on_long_merge_chain_collector.h"
+
+#include <memory>
+#include <string>
+
+#include "port/stack_trace.h"
+#include "rocksdb/table_properties.h"
+#include "rocksdb/utilities/table_properties_collectors.h"
+#include "test_util/testharness.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+namespace {
+
+void AddMergeChain(TablePropertiesCollector* collector, const std::string& key,
+                   size_t chain_length, SequenceNumber* seq) {
+  for (size_t i = 0; i < chain_length; ++i) {
+    ASSERT_OK(collector->AddUserKey(key, "operand", kEntryMerge, (*seq)++,
+                                    0 /* file_size */));
+  }
+}
+
+}  // namespace
+
+TEST(CompactOnLongMergeChainCollector, Disabled) {
+  auto factory = NewCompactOnLongMergeChainCollectorFactory(0);
+  std::unique_ptr<TablePropertiesCollector> collector(
+      factory->CreateTablePropertiesCollector(
+          TablePropertiesCollectorFactory::Context()));
+  SequenceNumber seq = 100;
+  AddMergeChain(collector.get(), "key", 1000, &seq);
+  ASSERT_FALSE(collector->NeedCompact());
+  UserCollectedProperties properties;
+  ASSERT_OK(collector->Finish(&properties));
+  ASSERT_EQ(0, properties.count(
+                   CompactOnLongMergeChainCollector::
+                       kMaxMergeChainLengthPropertyName));
+}
+
+TEST(CompactOnLongMergeChainCollector, ChainBelowTrigger) {
+  auto factory = NewCompactOnLongMergeChainCollectorFactory(10);
+  std::unique_ptr<TablePropertiesCollector> collector(
+      factory->CreateTablePropertiesCollector(
+          TablePropertiesCollectorFactory::Context()));
+  SequenceNumber seq = 100;
+  // Several keys with short chains; the per-key chains never reach the
+  // trigger even though the file-wide operand count does.
+  for (int i = 0; i < 100; ++i) {
+    AddMergeChain(collector.get(), "key" + std::to_string(i), 9, &seq);
+  }
+  ASSERT_FALSE(collector->NeedCompact());
+  UserCollectedProperties properties;
+  ASSERT_OK(collector->Finish(&properties));
+  ASSERT_EQ("9", properties.at(CompactOnLongMergeChainCollector::
+                                   kMaxMergeChainLengthPropertyName));
+}
+
+TEST(CompactOnLongMergeChainCollector, ChainReachesTrigger) {
+  auto factory = NewCompactOnLongMergeChainCollectorFactory(10);
+  std::unique_ptr<TablePropertiesCollector> collector(
+      factory->CreateTablePropertiesCollector(
+          TablePropertiesCollectorFactory::Context()));
+  SequenceNumber seq = 100;
+  AddMergeChain(collector.get(), "a", 5, &seq);
+  AddMergeChain(collector.get(), "b", 12, &seq);
+  AddMergeChain(collector.get(), "c", 3, &seq);
+  ASSERT_TRUE(collector->NeedCompact());
+  UserCollectedProperties properties;
+  ASSERT_OK(collector->Finish(&properties));
+  ASSERT_EQ("12", properties.at(CompactOnLongMergeChainCollector::
+                                    kMaxMergeChainLengthPropertyName));
+}
+
+TEST(CompactOnLongMergeChainCollector, BaseValueEndsChain) {
+  auto factory = NewCompactOnLongMergeChainCollectorFactory(10);
+  std::unique_ptr<TablePropertiesCollector> collector(
+      factory->CreateTablePropertiesCollector(
+          TablePropertiesCollectorFactory::Context()));
+  SequenceNumber seq = 100;
+  // Operands of one key interrupted by its base value: the two runs count as
+  // separate chains.
+  AddMergeChain(collector.get(), "key", 6, &seq);
+  ASSERT_OK(collector->AddUserKey("key", "base", kEntryPut, seq++,
+                                  0 /* file_size */));
+  AddMergeChain(collector.get(), "key", 6, &seq);
+  ASSERT_FALSE(collector->NeedCompact());
+  UserCollectedProperties properties;
+  ASSERT_OK(collector->Finish(&properties));
+  ASSERT_EQ("6", properties.at(CompactOnLongMergeChainCollector::
+                                   kMaxMergeChainLengthPropertyName));
+}
+
+}  // namespace ROCKSDB_NAMESPACE
+
+int main(int argc, char** argv) {
+  ROCKSDB_NAMESPACE::port::InstallStackTraceHandler();
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -6,6 +6,7 @@
 #include "utilities/trace/replayer_impl.h"
 
 #include <cmath>
+#include <condition_variable>
 #include <thread>
 
 #include "rocksdb/options.h"
@@ -179,6 +180,12 @@ Status ReplayerImpl::Replay(
       }
     };
 
+    // Number of scheduled write traces that have not finished executing yet.
+    // Only maintained when preserve_write_read_order is enabled; protected by
+    // mtx.
+    uint64_t pending_writes = 0;
+    std::condition_variable pending_writes_cv;
+
     std::chrono::system_clock::time_point replay_epoch =
         std::chrono::system_clock::now();
 
@@ -219,6 +226,28 @@ Status ReplayerImpl::Replay(
         ra->trace_file_version = trace_file_version_;
         ra->error_cb = error_cb;
         ra->result_cb = result_callback;
+        if (options.preserve_write_read_order) {
+          if (trace_type == kTraceWrite) {
+            std::lock_guard<std::mutex> gd(mtx);
+            ++pending_writes;
+            ra->write_complete_cb = [&mtx, &pending_writes,
+                                     &pending_writes_cv]() {
+              std::lock_guard<std::mutex> cb_gd(mtx);
+              assert(pending_writes > 0);
+              --pending_writes;
+              pending_writes_cv.notify_all();
+            };
+          } else {
+            // Traces are scheduled in trace timestamp order, so once all the
+            // previously scheduled writes have finished, this read cannot run
+            // before any write it observed during tracing.
+            std::unique_lock<std::mutex> lk(mtx);
+            pending_writes_cv.wait(lk,
+                                   [&pending_writes]() {
+                                     return pending_writes == 0;
+                                   });
+          }
+        }
         thread_pool.Schedule(&ReplayerImpl::BackgroundWork, ra.release(),
                              nullptr, nullptr);
       } else {
@@ -296,6 +325,10 @@ void ReplayerImpl::BackgroundWork(void* arg) {
     if (ra->result_cb != nullptr) {
       ra->result_cb(s, nullptr);
     }
+    // Unblock any reads waiting for this write to finish.
+    if (ra->write_complete_cb != nullptr) {
+      ra->write_complete_cb();
+    }
     return;
   }
 
@@ -307,6 +340,10 @@ void ReplayerImpl::BackgroundWork(void* arg) {
     ra->result_cb(s, std::move(res));
   }
   record.reset();
+
+  if (ra->write_complete_cb != nullptr) {
+    ra->write_complete_cb();
+  }
 }
 
 }  // namespace ROCKSDB_NAMESPACE
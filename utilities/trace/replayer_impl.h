@@ -79,6 +79,11 @@ struct ReplayerWorkerArg {
   // Callback function to report the trace execution status and operation
   // execution status/result(s).
   std::function<void(Status, std::unique_ptr<TraceRecordResult>&&)> result_cb;
+  // Callback function invoked once the TraceRecord has finished executing
+  // (successfully or not). Only set for write traces when
+  // ReplayOptions::preserve_write_read_order is enabled; used to unblock
+  // read traces with later trace timestamps.
+  std::function<void()> write_complete_cb;
 };
 
 }  // namespace ROCKSDB_NAMESPACE
@@ -46,6 +46,17 @@ class LockManager {
   virtual Status TryLock(PessimisticTransaction* txn,
                          ColumnFamilyId column_family_id, const Endpoint& start,
                          const Endpoint& end, Env* env, bool exclusive) = 0;
+  // Attempt to lock several distinct keys of one column family in a single
+  // call. All-or-nothing: on a non-OK status, no key in `keys` is left newly
+  // locked. The keys must not already be locked by `txn` (implementations may
+  // not count re-acquisitions, so a failure could otherwise release a lock
+  // the transaction still relies on). The default implementation locks the
+  // keys one at a time; implementations may batch for fewer mutex
+  // acquisitions.
+  virtual Status TryLock(PessimisticTransaction* txn,
+                         ColumnFamilyId column_family_id,
+                         const std::vector<std::string>& keys, Env* env,
+                         bool exclusive);
 
   // Unlock a key or a range locked by TryLock().  txn must be the same
   // Transaction that locked this key.
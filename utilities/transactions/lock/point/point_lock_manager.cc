@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <cinttypes>
+#include <map>
 #include <mutex>
 
 #include "monitoring/perf_context_imp.h"
@@ -57,6 +58,11 @@ struct LockMapStripe {
   // Condition Variable per stripe for waiting on a lock
   std::shared_ptr<TransactionDBCondVar> stripe_cv;
 
+  // Number of threads blocked on stripe_cv. Incremented under stripe_mutex
+  // before waiting, so an unlocker that checks it after releasing the mutex
+  // cannot miss a waiter; lets the uncontended unlock path skip NotifyAll().
+  std::atomic<uint32_t> num_waiters{0};
+
   // Locked keys mapped to the info about the transactions that locked them.
   // TODO(agiardullo): Explore performance of other data structures.
   UnorderedMap<std::string, LockInfo> keys;
@@ -247,6 +253,86 @@ Status PointLockManager::TryLock(PessimisticTransaction* txn,
                             timeout, lock_info);
 }
 
+Status PointLockManager::TryLock(PessimisticTransaction* txn,
+                                 ColumnFamilyId column_family_id,
+                                 const std::vector<std::string>& keys, Env* env,
+                                 bool exclusive) {
+  std::shared_ptr<LockMap> lock_map_ptr = GetLockMap(column_family_id);
+  LockMap* lock_map = lock_map_ptr.get();
+  if (lock_map == nullptr) {
+    char msg[255];
+    snprintf(msg, sizeof(msg), "Column family id not found: %" PRIu32,
+             column_family_id);
+
+    return Status::InvalidArgument(msg);
+  }
+
+  LockInfo lock_info(txn->GetID(), txn->GetExpirationTime(), exclusive);
+  int64_t timeout = txn->GetLockTimeout();
+
+  // Group the keys by stripe, in ascending stripe order (consistent with the
+  // lock ordering documented in the header, though only one stripe mutex is
+  // held at a time), so that each stripe mutex is acquired once per call
+  // instead of once per key.
+  std::map<size_t, autovector<const std::string*>> stripe_keys;
+  for (const auto& key : keys) {
+    stripe_keys[lock_map->GetStripe(key)].push_back(&key);
+  }
+
+  Status result;
+  autovector<const std::string*> conflicting;
+  autovector<const std::string*> acquired;
+  for (const auto& entry : stripe_keys) {
+    LockMapStripe* stripe = lock_map->lock_map_stripes_.at(entry.first);
+    if (timeout < 0) {
+      result = stripe->stripe_mutex->Lock();
+    } else {
+      result = stripe->stripe_mutex->TryLockFor(timeout);
+    }
+    if (!result.ok()) {
+      // failed to acquire mutex
+      break;
+    }
+    for (const std::string* key : entry.second) {
+      uint64_t expire_time_hint = 0;
+      autovector<TransactionID> wait_ids;
+      Status s = AcquireLocked(lock_map, stripe, *key, env, lock_info,
+                               &expire_time_hint, &wait_ids);
+      if (s.ok()) {
+        acquired.push_back(key);
+      } else {
+        // Contended; retried below with the full waiting path.
+        conflicting.push_back(key);
+      }
+    }
+    stripe->stripe_mutex->UnLock();
+  }
+
+  // Only the contended keys take the per-key path with waiting, timeouts and
+  // deadlock detection.
+  if (result.ok()) {
+    for (const std::string* key : conflicting) {
+      size_t stripe_num = lock_map->GetStripe(*key);
+      assert(lock_map->lock_map_stripes_.size() > stripe_num);
+      LockMapStripe* stripe = lock_map->lock_map_stripes_.at(stripe_num);
+      result = AcquireWithTimeout(txn, lock_map, stripe, column_family_id, *key,
+                                  env, timeout, lock_info);
+      if (!result.ok()) {
+        break;
+      }
+      acquired.push_back(key);
+    }
+  }
+
+  if (!result.ok()) {
+    // Keep the all-or-nothing contract: release what this call acquired.
+    for (const std::string* key : acquired) {
+      UnLock(txn, column_family_id, *key, env);
+    }
+  }
+  return result;
+}
+
 // Helper function for TryLock().
 Status PointLockManager::AcquireWithTimeout(
     PessimisticTransaction* txn, LockMap* lock_map, LockMapStripe* stripe,
@@ -312,6 +398,7 @@ Status PointLockManager::AcquireWithTimeout(
       }
 
       TEST_SYNC_POINT("PointLockManager::AcquireWithTimeout:WaitingTxn");
+      stripe->num_waiters.fetch_add(1, std::memory_order_relaxed);
       if (cv_end_time < 0) {
         // Wait indefinitely
         result = stripe->stripe_cv->Wait(stripe->stripe_mutex);
@@ -325,6 +412,7 @@ Status PointLockManager::AcquireWithTimeout(
                                               cv_end_time - now);
         }
       }
+      stripe->num_waiters.fetch_sub(1, std::memory_order_relaxed);
 
       if (wait_ids.size() != 0) {
         txn->ClearWaitingTxn();
@@ -596,8 +684,12 @@ void PointLockManager::UnLock(PessimisticTransaction* txn,
   UnLockKey(txn, key, stripe, lock_map, env);
   stripe->stripe_mutex->UnLock();
 
-  // Signal waiting threads to retry locking
-  stripe->stripe_cv->NotifyAll();
+  // Signal waiting threads to retry locking. Any waiter registers itself
+  // before releasing the stripe mutex, so if the count is zero here there is
+  // no one to wake.
+  if (stripe->num_waiters.load(std::memory_order_relaxed) > 0) {
+    stripe->stripe_cv->NotifyAll();
+  }
 }
 
 void PointLockManager::UnLock(PessimisticTransaction* txn,
@@ -643,7 +735,9 @@ void PointLockManager::UnLock(PessimisticTransaction* txn,
       stripe->stripe_mutex->UnLock();
 
       // Signal waiting threads to retry locking
-      stripe->stripe_cv->NotifyAll();
+      if (stripe->num_waiters.load(std::memory_order_relaxed) > 0) {
+        stripe->stripe_cv->NotifyAll();
+      }
     }
   }
 }
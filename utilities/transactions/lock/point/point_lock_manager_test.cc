@@ -61,6 +61,43 @@ TEST_F(PointLockManagerTest, LockStatus) {
   delete txn2;
 }
 
+TEST_F(PointLockManagerTest, BatchTryLock) {
+  MockColumnFamilyHandle cf(1);
+  locker_->AddColumnFamily(&cf);
+
+  auto txn1 = NewTxn();
+  std::vector<std::string> keys = {"k1", "k2", "k3", "k4"};
+  ASSERT_OK(locker_->TryLock(txn1, 1, keys, env_, true));
+  auto status = locker_->GetPointLockStatus();
+  ASSERT_EQ(status.size(), 4u);
+
+  // A conflicting key makes the whole batch fail (lock timeout is zero) and
+  // leaves none of the other keys locked.
+  auto txn2 = NewTxn();
+  std::vector<std::string> keys2 = {"k5", "k2", "k6"};
+  auto s = locker_->TryLock(txn2, 1, keys2, env_, true);
+  ASSERT_TRUE(s.IsTimedOut());
+  status = locker_->GetPointLockStatus();
+  ASSERT_EQ(status.size(), 4u);
+
+  // After the conflict goes away, the same batch succeeds.
+  locker_->UnLock(txn1, 1, "k2", env_);
+  ASSERT_OK(locker_->TryLock(txn2, 1, keys2, env_, true));
+  status = locker_->GetPointLockStatus();
+  ASSERT_EQ(status.size(), 6u);
+
+  // Cleanup
+  for (const auto& key : {"k1", "k3", "k4"}) {
+    locker_->UnLock(txn1, 1, key, env_);
+  }
+  for (const auto& key : keys2) {
+    locker_->UnLock(txn2, 1, key, env_);
+  }
+
+  delete txn1;
+  delete txn2;
+}
+
 TEST_F(PointLockManagerTest, UnlockExclusive) {
   MockColumnFamilyHandle cf(1);
   locker_->AddColumnFamily(&cf);
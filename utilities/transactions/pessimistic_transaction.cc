@@ -809,11 +809,32 @@ Status WriteCommittedTxn::CommitWithoutPrepareInternal() {
       post_mem_cb = &snapshot_creation_cb;
     }
   }
-  auto s = db_impl_->WriteImpl(
-      write_options_, wb,
-      /*callback*/ nullptr, /*user_write_cb=*/nullptr, /*wal_used*/ nullptr,
-      /*log_ref*/ 0, /*disable_memtable*/ false, &seq_used, /*batch_cnt=*/0,
-      /*pre_release_callback=*/nullptr, post_mem_cb);
+  const bool bypass_memtable =
+      !needs_ts && !db_impl_->immutable_db_options().two_write_queues &&
+      wb->Count() > commit_bypass_memtable_threshold_;
+  Status s;
+  if (bypass_memtable) {
+    // The batch is written to WAL as usual but not inserted into the active
+    // memtable; instead the transaction's index is ingested as an immutable
+    // memtable covering the same sequence numbers.
+    s = db_impl_->WriteImpl(
+        write_options_, wb,
+        /*callback*/ nullptr, /*user_write_cb=*/nullptr, /*wal_used*/ nullptr,
+        /*log_ref*/ 0, /*disable_memtable*/ true, &seq_used, /*batch_cnt=*/0,
+        /*pre_release_callback=*/nullptr, post_mem_cb,
+        /*wbwi=*/std::make_shared<WriteBatchWithIndex>(std::move(write_batch_)),
+        /*min_prep_log=*/0);
+    // Reset write_batch_ since it's accessed in transaction clean up and
+    // might be used for transaction reuse.
+    write_batch_ = WriteBatchWithIndex(cmp_, 0, true, 0,
+                                       write_options_.protection_bytes_per_key);
+  } else {
+    s = db_impl_->WriteImpl(
+        write_options_, wb,
+        /*callback*/ nullptr, /*user_write_cb=*/nullptr, /*wal_used*/ nullptr,
+        /*log_ref*/ 0, /*disable_memtable*/ false, &seq_used, /*batch_cnt=*/0,
+        /*pre_release_callback=*/nullptr, post_mem_cb);
+  }
   assert(!s.ok() || seq_used != kMaxSequenceNumber);
   if (s.ok()) {
     SetId(seq_used);
@@ -1126,6 +1147,19 @@ Status PessimisticTransaction::TryLock(ColumnFamilyHandle* column_family,
     s = txn_db_impl_->TryLock(this, cfh_id, key_str, exclusive);
   }
 
+  return PostAcquireLock(column_family, key, cfh_id, key_str, previously_locked,
+                         lock_upgrade, status, read_only, exclusive,
+                         do_validate, assume_tracked, std::move(s));
+}
+
+// Validation and tracking performed after the lock manager has been asked for
+// the key's lock; factored out of TryLock() so that TryLockBatch() can run it
+// for keys whose locks were acquired in a batch.
+Status PessimisticTransaction::PostAcquireLock(
+    ColumnFamilyHandle* column_family, const Slice& key, uint32_t cfh_id,
+    const std::string& key_str, bool previously_locked, bool lock_upgrade,
+    const PointLockStatus& status, bool read_only, bool exclusive,
+    const bool do_validate, const bool assume_tracked, Status s) {
   const ColumnFamilyHandle* const cfh =
       column_family ? column_family : db_impl_->DefaultColumnFamily();
   assert(cfh);
@@ -1213,6 +1247,106 @@ Status PessimisticTransaction::TryLock(ColumnFamilyHandle* column_family,
   return s;
 }
 
+Status PessimisticTransaction::TryLockBatch(
+    const std::vector<ColumnFamilyHandle*>& column_family,
+    const std::vector<Slice>& keys, bool read_only, bool exclusive,
+    const bool do_validate) {
+  assert(column_family.size() == keys.size());
+  if (UNLIKELY(skip_concurrency_control_)) {
+    return Status::OK();
+  }
+  if (!tracked_locks_->IsPointLockSupported()) {
+    // Without point lock tracking we cannot distinguish re-acquisitions from
+    // fresh locks, which the batched lock manager contract requires.
+    return TransactionBaseImpl::TryLockBatch(column_family, keys, read_only,
+                                             exclusive, do_validate);
+  }
+
+  // Partition the keys: distinct keys this transaction does not hold yet are
+  // acquired in one lock manager call per column family (one stripe-mutex
+  // hold per stripe instead of per key); re-locks, lock upgrades and
+  // duplicates take the regular per-key path below.
+  struct KeyState {
+    uint32_t cfh_id;
+    std::string key_str;
+    PointLockStatus status;
+    bool batched;
+  };
+  std::vector<KeyState> states;
+  states.reserve(keys.size());
+  std::map<uint32_t, std::vector<std::string>> batch_keys;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    uint32_t cfh_id = GetColumnFamilyID(column_family[i]);
+    std::string key_str = keys[i].ToString();
+    PointLockStatus status = tracked_locks_->GetPointLockStatus(cfh_id, key_str);
+    bool lock_upgrade = status.locked && exclusive && !status.exclusive;
+    bool batched = false;
+    if (!status.locked && !lock_upgrade) {
+      auto& cf_keys = batch_keys[cfh_id];
+      if (std::find(cf_keys.begin(), cf_keys.end(), key_str) ==
+          cf_keys.end()) {
+        cf_keys.push_back(key_str);
+        batched = true;
+      }
+    }
+    states.push_back({cfh_id, std::move(key_str), status, batched});
+  }
+
+  Status s;
+  for (const auto& entry : batch_keys) {
+    s = txn_db_impl_->TryLock(this, entry.first, entry.second, exclusive);
+    if (!s.ok()) {
+      // The failed call held nothing (all-or-nothing), but earlier column
+      // families' batches are locked and not yet tracked; release them.
+      for (const auto& done : batch_keys) {
+        if (done.first == entry.first) {
+          break;
+        }
+        for (const auto& key : done.second) {
+          txn_db_impl_->UnLock(this, done.first, key);
+        }
+      }
+      return s;
+    }
+  }
+
+  // Validate and track each key. Keys whose locks were just batch-acquired
+  // skip the per-key trip through the lock manager.
+  const KeyState* failed_state = nullptr;
+  for (size_t i = 0; i < keys.size() && s.ok(); ++i) {
+    KeyState& state = states[i];
+    if (state.batched) {
+      s = PostAcquireLock(column_family[i], keys[i], state.cfh_id,
+                          state.key_str, false /* previously_locked */,
+                          false /* lock_upgrade */, state.status, read_only,
+                          exclusive, do_validate, false /* assume_tracked */,
+                          Status::OK());
+      if (!s.ok()) {
+        // PostAcquireLock has already released the key it failed on.
+        failed_state = &state;
+      }
+    } else {
+      s = TryLock(column_family[i], keys[i], read_only, exclusive, do_validate);
+    }
+  }
+  if (!s.ok()) {
+    // On failure, locks that were batch-acquired but never tracked would be
+    // invisible to the rollback path; release them here.
+    for (const auto& entry : batch_keys) {
+      for (const auto& key : entry.second) {
+        if (failed_state != nullptr && failed_state->cfh_id == entry.first &&
+            failed_state->key_str == key) {
+          continue;
+        }
+        if (!tracked_locks_->GetPointLockStatus(entry.first, key).locked) {
+          txn_db_impl_->UnLock(this, entry.first, key);
+        }
+      }
+    }
+  }
+  return s;
+}
+
 Status PessimisticTransaction::GetRangeLock(ColumnFamilyHandle* column_family,
                                             const Endpoint& start_endp,
                                             const Endpoint& end_endp) {
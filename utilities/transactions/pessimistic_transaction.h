@@ -143,6 +143,21 @@ class PessimisticTransaction : public TransactionBaseImpl {
                  bool read_only, bool exclusive, const bool do_validate = true,
                  const bool assume_tracked = false) override;
 
+  Status TryLockBatch(const std::vector<ColumnFamilyHandle*>& column_family,
+                      const std::vector<Slice>& keys, bool read_only,
+                      bool exclusive, const bool do_validate = true) override;
+
+  // The validation and tracking half of TryLock(), run after the lock
+  // manager has granted (or failed to grant) the key's lock. `status` is the
+  // tracked lock status observed before acquisition and `s` the acquisition
+  // result.
+  Status PostAcquireLock(ColumnFamilyHandle* column_family, const Slice& key,
+                         uint32_t cfh_id, const std::string& key_str,
+                         bool previously_locked, bool lock_upgrade,
+                         const PointLockStatus& status, bool read_only,
+                         bool exclusive, const bool do_validate,
+                         const bool assume_tracked, Status s);
+
   void Clear() override;
 
   PessimisticTransactionDB* txn_db_impl_;
@@ -145,6 +145,9 @@ class PessimisticTransactionDB : public TransactionDB {
 
   Status TryLock(PessimisticTransaction* txn, uint32_t cfh_id,
                  const std::string& key, bool exclusive);
+  // Batched variant; see LockManager::TryLock for the contract.
+  Status TryLock(PessimisticTransaction* txn, uint32_t cfh_id,
+                 const std::vector<std::string>& keys, bool exclusive);
   Status TryRangeLock(PessimisticTransaction* txn, uint32_t cfh_id,
                       const Endpoint& start_endp, const Endpoint& end_endp);
 
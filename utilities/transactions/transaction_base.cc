@@ -437,6 +437,21 @@ void TransactionBaseImpl::MultiGetEntity(const ReadOptions& read_options,
                      statuses, sorted_input);
 }
 
+Status TransactionBaseImpl::TryLockBatch(
+    const std::vector<ColumnFamilyHandle*>& column_family,
+    const std::vector<Slice>& keys, bool read_only, bool exclusive,
+    const bool do_validate) {
+  assert(column_family.size() == keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    Status s = TryLock(column_family[i], keys[i], read_only, exclusive,
+                       do_validate);
+    if (!s.ok()) {
+      return s;
+    }
+  }
+  return Status::OK();
+}
+
 std::vector<Status> TransactionBaseImpl::MultiGetForUpdate(
     const ReadOptions& read_options,
     const std::vector<ColumnFamilyHandle*>& column_family,
@@ -452,13 +467,11 @@ std::vector<Status> TransactionBaseImpl::MultiGetForUpdate(
   values->resize(num_keys);
 
   // Lock all keys
-  for (size_t i = 0; i < num_keys; ++i) {
-    Status s = TryLock(column_family[i], keys[i], true /* read_only */,
-                       true /* exclusive */);
-    if (!s.ok()) {
-      // Fail entire multiget if we cannot lock all keys
-      return std::vector<Status>(num_keys, s);
-    }
+  Status s = TryLockBatch(column_family, keys, true /* read_only */,
+                          true /* exclusive */);
+  if (!s.ok()) {
+    // Fail entire multiget if we cannot lock all keys
+    return std::vector<Status>(num_keys, s);
   }
 
   // TODO(agiardullo): optimize multiget?
@@ -46,6 +46,14 @@ class TransactionBaseImpl : public Transaction {
                          const bool do_validate = true,
                          const bool assume_tracked = false) = 0;
 
+  // Batched counterpart of TryLock(), used by MultiGetForUpdate(). The
+  // default implementation locks the keys one at a time; implementations
+  // may acquire the locks in fewer trips through the lock manager.
+  virtual Status TryLockBatch(
+      const std::vector<ColumnFamilyHandle*>& column_family,
+      const std::vector<Slice>& keys, bool read_only, bool exclusive,
+      const bool do_validate = true);
+
   void SetSavePoint() override;
 
   Status RollbackToSavePoint() override;
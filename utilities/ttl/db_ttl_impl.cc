@@ -169,6 +169,25 @@ void DBWithTTLImpl::SanitizeOptions(int32_t ttl, ColumnFamilyOptions* options,
     options->merge_operator.reset(
         new TtlMergeOperator(options->merge_operator, clock));
   }
+
+  // The compaction filter only drops expired entries when compaction happens
+  // to visit them. Tighten the age-based compaction options so files are
+  // proactively revisited within roughly one TTL period instead of the
+  // 30-day default: the `ttl` option recompacts non-bottom-level files whose
+  // keys are all older than it, and periodic compaction covers the bottom
+  // level. Only the "unset" defaults are adjusted; explicit user settings
+  // are left alone.
+  if (ttl > 0) {
+    // Matches kDefaultTtl/kDefaultPeriodicCompSecs in db/column_family.cc:
+    // the sentinel meaning the user did not set the option.
+    constexpr uint64_t kUnsetSentinel = 0xfffffffffffffffe;
+    if (options->ttl == kUnsetSentinel) {
+      options->ttl = static_cast<uint64_t>(ttl);
+    }
+    if (options->periodic_compaction_seconds == kUnsetSentinel) {
+      options->periodic_compaction_seconds = static_cast<uint64_t>(ttl);
+    }
+  }
 }
 
 static std::unordered_map<std::string, OptionTypeInfo> ttl_type_info = {
@@ -5,6 +5,7 @@
 
 #include "rocksdb/utilities/write_batch_with_index.h"
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 
@@ -17,6 +18,7 @@
 #include "memory/arena.h"
 #include "rocksdb/comparator.h"
 #include "rocksdb/iterator.h"
+#include "util/autovector.h"
 #include "util/cast_util.h"
 #include "util/string_util.h"
 #include "utilities/write_batch_with_index/write_batch_with_index_internal.h"
@@ -38,6 +40,15 @@ struct WriteBatchWithIndex::Rep {
   WriteBatchEntryComparator comparator;
   Arena arena;
   WriteBatchEntrySkipList skip_list;
+  // Small batches keep their index entries in this sorted vector instead of
+  // the skip list: insertion is a binary search plus memmove, which beats
+  // building skip list towers while the batch fits in a few cache lines.
+  // The entries are migrated into the skip list when the batch outgrows
+  // kVecIndexThreshold or when an iterator is created (skip list iterators
+  // stay valid across later writes; vector iterators would not).
+  static const size_t kVecIndexThreshold = 32;
+  autovector<WriteBatchIndexEntry*, kVecIndexThreshold> vec_index;
+  bool use_vec_index = true;
   // The starting offset of the last sub-batch. A sub-batch starts right before
   // inserting a key that is a duplicate of a key in the last sub-batch. Zero,
   // the default, means that no duplicate key is detected so far.
@@ -47,6 +58,11 @@ struct WriteBatchWithIndex::Rep {
 
   bool overwrite_key;
   bool track_cf_stat;
+  // False iff the skip list has at least one entry. Lets Clear() skip
+  // tearing down and reconstructing the arena and skip list when the index
+  // was never populated, e.g. a commit-time batch cleared after every
+  // transaction.
+  bool index_empty = true;
   // Tracks ids of CFs that have updates in this WBWI, number of updates and
   // number of overwritten single deletions per cf.
   std::unordered_map<uint32_t, CFStat> cf_id_to_stat;
@@ -91,6 +107,15 @@ struct WriteBatchWithIndex::Rep {
                    size_t last_entry_offset,
                    uint32_t most_recent_entry_update_count);
 
+  // Move all entries from vec_index into the skip list and stop using the
+  // vector for the rest of this batch's lifetime (until ClearIndex()).
+  void MigrateToSkipList();
+
+  // In vector mode, return the most recent index entry for `key` in
+  // `column_family_id`, or nullptr if the key has no entry.
+  WriteBatchIndexEntry* FindInVecIndex(uint32_t column_family_id,
+                                       const Slice& key);
+
   // Clear all updates buffered in this batch.
   void Clear();
   void ClearIndex();
@@ -108,18 +133,22 @@ bool WriteBatchWithIndex::Rep::UpdateExistingEntryWithCfId(
     return false;
   }
 
-  WBWIIteratorImpl iter(column_family_id, &skip_list, &write_batch,
-                        &comparator);
-  iter.Seek(key);
-  if (!iter.Valid()) {
-    return false;
-  } else if (!iter.MatchesKey(column_family_id, key)) {
+  WriteBatchIndexEntry* most_recent_entry = nullptr;
+  if (use_vec_index) {
+    most_recent_entry = FindInVecIndex(column_family_id, key);
+  } else {
+    WBWIIteratorImpl iter(column_family_id, &skip_list, &write_batch,
+                          &comparator);
+    iter.Seek(key);
+    if (iter.Valid() && iter.MatchesKey(column_family_id, key)) {
+      // Seek() and MatchesKey() guarantees that we are at the first entry with
+      // key == `key`, which is the most recently update to `key`.
+      most_recent_entry = const_cast<WriteBatchIndexEntry*>(iter.GetRawEntry());
+    }
+  }
+  if (most_recent_entry == nullptr) {
     return false;
   }
-  // Seek() and MatchesKey() guarantees that we are at the first entry with
-  // key == `key`, which is the most recently update to `key`.
-  WriteBatchIndexEntry* most_recent_entry =
-      const_cast<WriteBatchIndexEntry*>(iter.GetRawEntry());
   *most_recent_entry_update_count = most_recent_entry->update_count;
 
   if (LIKELY(last_sub_batch_offset <= most_recent_entry->offset)) {
@@ -136,12 +165,17 @@ bool WriteBatchWithIndex::Rep::UpdateExistingEntryWithCfId(
       most_recent_entry->has_single_del = true;
     }
   }
-  // Some sanity check for using Merge and SD on the same key.
-  if (iter.Entry().type == kSingleDeleteRecord) {
-    assert(type != kMergeRecord);
-  }
   if (type == kMergeRecord) {
-    assert(iter.Entry().type != kSingleDeleteRecord);
+#ifndef NDEBUG
+    // Some sanity check for using Merge and SD on the same key.
+    WriteType existing_type = kPutRecord;
+    Slice existing_key, existing_value, existing_blob, existing_xid;
+    Status s = write_batch.GetEntryFromDataOffset(
+        most_recent_entry->offset, &existing_type, &existing_key,
+        &existing_value, &existing_blob, &existing_xid);
+    assert(s.ok());
+    assert(existing_type != kSingleDeleteRecord);
+#endif
     return false;
   } else {
     // We still increment the update count when updating in-place. This is
@@ -194,7 +228,30 @@ void WriteBatchWithIndex::Rep::AddNewEntry(uint32_t column_family_id,
   auto* index_entry = new (mem) WriteBatchIndexEntry(
       last_entry_offset, column_family_id, key.data() - wb_data.data(),
       key.size(), update_count);
-  skip_list.Insert(index_entry);
+  if (use_vec_index) {
+    if (vec_index.size() >= kVecIndexThreshold) {
+      MigrateToSkipList();
+      skip_list.Insert(index_entry);
+    } else {
+      // autovector has no insert(); append and shift the tail over. The
+      // vector never exceeds kVecIndexThreshold entries so this is cheap.
+      auto pos = static_cast<size_t>(
+          std::lower_bound(vec_index.begin(), vec_index.end(), index_entry,
+                           [this](const WriteBatchIndexEntry* l,
+                                  const WriteBatchIndexEntry* r) {
+                             return comparator(l, r) < 0;
+                           }) -
+          vec_index.begin());
+      vec_index.push_back(index_entry);
+      for (size_t i = vec_index.size() - 1; i > pos; --i) {
+        vec_index[i] = vec_index[i - 1];
+      }
+      vec_index[pos] = index_entry;
+    }
+  } else {
+    skip_list.Insert(index_entry);
+  }
+  index_empty = false;
 
   if (track_cf_stat) {
     if (type == kSingleDeleteRecord) {
@@ -204,6 +261,45 @@ void WriteBatchWithIndex::Rep::AddNewEntry(uint32_t column_family_id,
   }
 }
 
+void WriteBatchWithIndex::Rep::MigrateToSkipList() {
+  if (!use_vec_index) {
+    return;
+  }
+  use_vec_index = false;
+  for (auto* entry : vec_index) {
+    skip_list.Insert(entry);
+  }
+  vec_index.clear();
+}
+
+WriteBatchIndexEntry* WriteBatchWithIndex::Rep::FindInVecIndex(
+    uint32_t column_family_id, const Slice& key) {
+  assert(use_vec_index);
+  WriteBatchIndexEntry search_entry(&key, column_family_id,
+                                    true /* is_forward_direction */,
+                                    false /* is_seek_to_first */);
+  // The search entry sorts before every real entry with the same key, so
+  // lower_bound lands on the most recent update to `key` if there is one.
+  auto it = std::lower_bound(vec_index.begin(), vec_index.end(), &search_entry,
+                             [this](const WriteBatchIndexEntry* l,
+                                    const WriteBatchIndexEntry* r) {
+                               return comparator(l, r) < 0;
+                             });
+  if (it == vec_index.end()) {
+    return nullptr;
+  }
+  WriteBatchIndexEntry* entry = *it;
+  if (entry->column_family != column_family_id) {
+    return nullptr;
+  }
+  Slice entry_key(write_batch.Data().data() + entry->key_offset,
+                  entry->key_size);
+  if (comparator.CompareKey(column_family_id, entry_key, key) != 0) {
+    return nullptr;
+  }
+  return entry;
+}
+
 void WriteBatchWithIndex::Rep::Clear() {
   write_batch.Clear();
   cf_id_to_stat.clear();
@@ -211,10 +307,15 @@ void WriteBatchWithIndex::Rep::Clear() {
 }
 
 void WriteBatchWithIndex::Rep::ClearIndex() {
-  skip_list.~WriteBatchEntrySkipList();
-  arena.~Arena();
-  new (&arena) Arena();
-  new (&skip_list) WriteBatchEntrySkipList(comparator, &arena);
+  if (!index_empty) {
+    skip_list.~WriteBatchEntrySkipList();
+    arena.~Arena();
+    new (&arena) Arena();
+    new (&skip_list) WriteBatchEntrySkipList(comparator, &arena);
+    index_empty = true;
+  }
+  vec_index.clear();
+  use_vec_index = true;
   last_sub_batch_offset = 0;
   sub_batch_cnt = 1;
 }
@@ -330,25 +431,35 @@ WriteBatch* WriteBatchWithIndex::GetWriteBatch() { return &rep->write_batch; }
 size_t WriteBatchWithIndex::SubBatchCnt() { return rep->sub_batch_cnt; }
 
 WBWIIterator* WriteBatchWithIndex::NewIterator() {
+  // Iterators must stay valid across later writes, which the sorted vector
+  // cannot guarantee, so hand the entries over to the skip list first.
+  rep->MigrateToSkipList();
   return new WBWIIteratorImpl(0, &(rep->skip_list), &rep->write_batch,
                               &(rep->comparator));
 }
 
 WBWIIterator* WriteBatchWithIndex::NewIterator(
     ColumnFamilyHandle* column_family) {
+  rep->MigrateToSkipList();
   return new WBWIIteratorImpl(GetColumnFamilyID(column_family),
                               &(rep->skip_list), &rep->write_batch,
                               &(rep->comparator));
 }
 
 WBWIIterator* WriteBatchWithIndex::NewIterator(uint32_t cf_id) const {
+  rep->MigrateToSkipList();
   return new WBWIIteratorImpl(cf_id, &(rep->skip_list), &rep->write_batch,
                               &(rep->comparator));
 }
 
+void WriteBatchWithIndex::MigrateIndexToSkipList() {
+  rep->MigrateToSkipList();
+}
+
 Iterator* WriteBatchWithIndex::NewIteratorWithBase(
     ColumnFamilyHandle* column_family, Iterator* base_iterator,
     const ReadOptions* read_options) {
+  rep->MigrateToSkipList();
   WBWIIteratorImpl* wbwiii;
   if (read_options != nullptr) {
     wbwiii = new WBWIIteratorImpl(
@@ -367,6 +478,7 @@ Iterator* WriteBatchWithIndex::NewIteratorWithBase(
 }
 
 Iterator* WriteBatchWithIndex::NewIteratorWithBase(Iterator* base_iterator) {
+  rep->MigrateToSkipList();
   // default column family's comparator
   auto wbwiii = new WBWIIteratorImpl(0, &(rep->skip_list), &rep->write_batch,
                                      &rep->comparator);
@@ -1067,6 +1067,51 @@ TEST_P(WriteBatchWithIndexTest, TestWBWIIterator) {
   }
 }
 
+TEST_P(WriteBatchWithIndexTest, SmallBatchVecIndexMigration) {
+  // Small batches are indexed by a sorted vector that is migrated into the
+  // skip list once the batch grows past the vector threshold (or an iterator
+  // is created). Cross the threshold and verify lookups and iteration order
+  // are the same on both sides of the migration.
+  constexpr int kNumKeys = 50;  // comfortably above the vector threshold
+  std::string value;
+  for (int i = kNumKeys - 1; i >= 0; i--) {
+    // Descending insertion order exercises sorted inserts at the front.
+    std::string key = "k" + std::to_string(i / 10) + std::to_string(i % 10);
+    ASSERT_OK(batch_->Put(key, key + "v1"));
+    ASSERT_OK(batch_->Put(key, key + "v2"));
+    ASSERT_OK(batch_->GetFromBatch(options_, key, &value));
+    ASSERT_EQ(key + "v2", value);
+  }
+  ASSERT_OK(batch_->Delete("k25"));
+  ASSERT_OK(batch_->Merge("k26", "k26v3"));
+
+  std::vector<std::string> expected_keys;
+  for (int i = 0; i < kNumKeys; i++) {
+    expected_keys.push_back("k" + std::to_string(i / 10) +
+                            std::to_string(i % 10));
+  }
+  std::unique_ptr<WBWIIteratorImpl> iter(
+      static_cast<WBWIIteratorImpl*>(batch_->NewIterator()));
+  AssertIterEqual(iter.get(), expected_keys);
+
+  // Writes after the iterator was created go straight to the skip list and
+  // are still visible to it.
+  ASSERT_OK(batch_->Put("k50", "k50v1"));
+  expected_keys.push_back("k50");
+  AssertIterEqual(iter.get(), expected_keys);
+  ASSERT_OK(batch_->GetFromBatch(options_, "k00", &value));
+  ASSERT_EQ("k00v2", value);
+  ASSERT_TRUE(batch_->GetFromBatch(options_, "k25", &value).IsNotFound());
+
+  // Clear() resets the batch to the vector-indexed state.
+  batch_->Clear();
+  ASSERT_OK(batch_->Put("a", "a1"));
+  ASSERT_OK(batch_->GetFromBatch(options_, "a", &value));
+  ASSERT_EQ("a1", value);
+  iter.reset(static_cast<WBWIIteratorImpl*>(batch_->NewIterator()));
+  AssertIterEqual(iter.get(), {"a"});
+}
+
 TEST_P(WriteBatchWithIndexTest, TestRandomIteraratorWithBase) {
   std::vector<std::string> source_strings = {"a", "b", "c", "d", "e",
                                              "f", "g", "h", "i", "j"};